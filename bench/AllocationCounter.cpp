@@ -0,0 +1,68 @@
+#include "AllocationCounter.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local std::uint64_t allocationCount = 0;
+
+    void* CountedAllocate(std::size_t size)
+    {
+        ++allocationCount;
+        if (size == 0) size = 1;
+        return std::malloc(size);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* p = CountedAllocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* p = CountedAllocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+namespace FootballManagement
+{
+    std::uint64_t ThreadAllocationCount() { return allocationCount; }
+
+    AllocationScope::AllocationScope() : start_(allocationCount)
+    {
+    }
+
+    std::uint64_t AllocationScope::Count() const
+    {
+        return allocationCount - start_;
+    }
+}
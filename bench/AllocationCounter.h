@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FootballManagement
+{
+    /**
+     * @file AllocationCounter.h
+     * @brief Лічильник викликів глобального operator new (лише в бенчмарку).
+     * @details AllocationCounter.cpp замінює operator new/delete виконуваного
+     *          файлу бенчмарку; бібліотека й інші програми його не бачать.
+     *          Лічильник локальний для потоку, тож підрахунок не потребує
+     *          атомарних операцій і не змішує виділення різних потоків.
+     */
+
+    /// @brief Кількість виділень пам'яті в поточному потоці від його старту.
+    [[nodiscard]] std::uint64_t ThreadAllocationCount();
+
+    /**
+     * @class AllocationScope
+     * @brief Виділення пам'яті в поточному потоці від створення об'єкта.
+     */
+    class AllocationScope
+    {
+    private:
+        std::uint64_t start_; ///< Значення лічильника на початку.
+
+    public:
+        AllocationScope();
+
+        /// @brief Скільки виділень відбулося з моменту створення.
+        [[nodiscard]] std::uint64_t Count() const;
+    };
+}
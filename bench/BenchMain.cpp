@@ -0,0 +1,930 @@
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+
+#include "../include/AsyncFileEngine.h"
+#include "../include/ClubManager.h"
+#include "../include/Console.h"
+#include "../include/ContractedPlayer.h"
+#include "../include/FileManager.h"
+#include "../include/FreeAgent.h"
+#include "../include/IngestPipeline.h"
+#include "../include/LeagueManager.h"
+#include "../include/Metrics.h"
+#include "../include/PasswordHasher.h"
+#include "../include/SeedDemo.h"
+#include "../include/SessionCache.h"
+#include "../include/StartupLoader.h"
+#include "../include/TransferMarket.h"
+#include "../include/UserStore.h"
+#include "../include/VariantRoster.h"
+
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    const std::string BENCH_ROSTER_FILE = "bench_players.txt";
+    const std::string BENCH_ARCHIVE_FILE = "bench_players.fmra";
+
+    /// Каталог для файлів бенчмарку (поза робочим data/).
+    std::string BenchDirectory()
+    {
+        return (std::filesystem::temp_directory_path() / "footballmgmt_bench")
+            .string();
+    }
+
+    /// Синтетичні склади кешуються: генерація мільйона гравців дорожча за вимір.
+    std::map<std::int64_t, std::unique_ptr<ClubManager>> rosterCache;
+
+    ClubManager& Roster(std::int64_t size)
+    {
+        auto& club = rosterCache[size];
+        if (!club)
+        {
+            club = std::make_unique<ClubManager>("Bench FC", 1e15);
+            SeedSyntheticRoster(*club, static_cast<std::size_t>(size));
+        }
+        return *club;
+    }
+
+    /// Той самий склад у VariantRoster (вектор на кожен конкретний тип).
+    std::map<std::int64_t, std::unique_ptr<VariantRoster>> variantCache;
+
+    const VariantRoster& VariantRosterOf(std::int64_t size)
+    {
+        auto& roster = variantCache[size];
+        if (!roster) roster = std::make_unique<VariantRoster>(Roster(size));
+        return *roster;
+    }
+
+    /// Клубів у синтетичній лізі (склад Roster(n) ділиться між ними).
+    constexpr int BENCH_LEAGUE_CLUBS = 64;
+
+    /// Та сама кількість гравців, розподілена між клубами шардованої ліги.
+    std::map<std::int64_t, std::unique_ptr<LeagueManager>> leagueCache;
+
+    const LeagueManager& LeagueOf(std::int64_t size)
+    {
+        auto& league = leagueCache[size];
+        if (!league)
+        {
+            league = std::make_unique<LeagueManager>();
+            const auto perClub = static_cast<std::size_t>(
+                std::max<std::int64_t>(1, size / BENCH_LEAGUE_CLUBS));
+            for (int i = 0; i < BENCH_LEAGUE_CLUBS; ++i)
+            {
+                const int id = league->AddClub("Bench FC " + std::to_string(i),
+                                               1e15);
+                league->ExecuteOnClub(id, [perClub, i](ClubManager& club)
+                {
+                    SeedSyntheticRoster(club, perClub,
+                                        static_cast<std::uint64_t>(i));
+                });
+            }
+            league->WaitIdle();
+        }
+        return *league;
+    }
+
+    /// Бенчмарки, у яких кількість виділень пам'яті росла зі складом.
+    std::map<std::string, std::uint64_t> allocationFailures;
+
+    /**
+     * Операція над складом не повинна виділяти пам'ять на кожного гравця:
+     * допустимий лише ріст вектора результатів (≤ log2(n) + 2 виділень).
+     */
+    std::string CheckAllocations(const BenchmarkState& state,
+                                 const std::string& name,
+                                 std::uint64_t allocations)
+    {
+        std::uint64_t limit = 2;
+        for (std::int64_t n = state.GetArg(); n > 1; n >>= 1) ++limit;
+        if (allocations > limit)
+            allocationFailures[name + "/" + std::to_string(state.GetArg())] =
+                allocations;
+        return "allocs=" + std::to_string(allocations);
+    }
+
+    void BM_SaveRoster(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+        const FileManager fm(BenchDirectory());
+
+        while (state.KeepRunning())
+            DoNotOptimize(fm.SaveToFile(BENCH_ROSTER_FILE, club));
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_LoadRoster(BenchmarkState& state)
+    {
+        const FileManager fm(BenchDirectory());
+        fm.SaveToFile(BENCH_ROSTER_FILE, Roster(state.GetArg()));
+
+        while (state.KeepRunning())
+        {
+            ClubManager loaded;
+            loaded.DeserializeAllPlayers(fm.LoadFromFile(BENCH_ROSTER_FILE));
+            DoNotOptimize(loaded.GetAll().size());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_IngestPipeline(BenchmarkState& state)
+    {
+        // Той самий файл, що й у BM_LoadRoster, через етапи конвеєра.
+        // Позначка — пропускна здатність кожного етапу (тис. елементів/с
+        // роботи етапу; read — МБ/с).
+        const FileManager fm(BenchDirectory());
+        fm.SaveToFile(BENCH_ROSTER_FILE, Roster(state.GetArg()));
+        const std::string path = fm.GetFullPath(BENCH_ROSTER_FILE);
+
+        std::vector<IngestStageStats> totals;
+        while (state.KeepRunning())
+        {
+            ClubManager loaded;
+            const IngestReport report = IngestPipeline().Run(path, loaded);
+            DoNotOptimize(report.inserted);
+
+            if (totals.empty()) totals = report.stages;
+            else
+                for (std::size_t i = 0; i < totals.size(); ++i)
+                {
+                    totals[i].items += report.stages[i].items;
+                    totals[i].busyNs += report.stages[i].busyNs;
+                }
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        std::ostringstream label;
+        label << std::fixed << std::setprecision(0);
+        for (const auto& stage : totals)
+        {
+            const bool bytes = std::string_view(stage.name) == "read";
+            if (!bytes) label << ' ';
+            label << stage.name << '='
+                << stage.GetItemsPerSecond() / (bytes ? 1e6 : 1e3)
+                << (bytes ? "MB/s" : "k/s");
+        }
+        state.SetLabel(label.str());
+    }
+
+    void BM_LoadRosterLazy(BenchmarkState& state)
+    {
+        // Лише індекс (id, ім'я, тип): порівнювати з BM_LoadRoster.
+        const FileManager fm(BenchDirectory());
+        fm.SaveToFile(BENCH_ROSTER_FILE, Roster(state.GetArg()));
+
+        while (state.KeepRunning())
+        {
+            ClubManager loaded;
+            loaded.IndexAllPlayers(fm.LoadFileContent(BENCH_ROSTER_FILE));
+            DoNotOptimize(loaded.GetPlayerCount());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    /// Облікових записів у знімку користувачів для BM_StartupLoad.
+    constexpr int BENCH_STARTUP_USERS = 1'000;
+
+    void BM_StartupLoad(BenchmarkState& state)
+    {
+        // Старт меню: користувачі в цьому потоці, склад — у фоні.
+        // Основний час — до готовності складу; login= — до можливості входу.
+        const FileManager fm(BenchDirectory());
+        fm.SaveToFile(PLAYERS_DATA_FILE, Roster(state.GetArg()));
+        {
+            KdfParams params;
+            params.logN = 10;
+            const std::string hash = PasswordHasher::Hash("bench-password",
+                                                          params);
+            std::ofstream users(fm.GetFullPath(USERS_FILE_NAME),
+                                std::ios::out | std::ios::trunc);
+            for (int i = 0; i < BENCH_STARTUP_USERS; ++i)
+                users << "user" << i << ':' << hash << ':'
+                    << static_cast<int>(UserRole::StandardUser) << '\n';
+        }
+        fm.DeleteFile(USERS_LOG_FILE);
+
+        auto& auth = AuthManager::GetInstance();
+        UserStore store(fm);
+        double loginSeconds = 0.0;
+        while (state.KeepRunning())
+        {
+            const auto start = std::chrono::steady_clock::now();
+            auto loader = std::make_unique<StartupLoader>(
+                std::make_shared<ClubManager>(), fm);
+            loader->Start(auth, store);
+            loginSeconds += std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+            DoNotOptimize(loader->Roster().GetPlayerCount());
+
+            state.PauseTiming();
+            loader.reset();
+            state.ResumeTiming();
+        }
+
+        // Синтетичні облікові записи не мають дожити до виходу з програми.
+        auth.DeserializeAllUsers({});
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        std::ostringstream label;
+        label << "login=" << std::fixed << std::setprecision(2)
+            << loginSeconds * 1e3 / static_cast<double>(state.GetIterations())
+            << "ms";
+        state.SetLabel(label.str());
+    }
+
+    /// Файлів у пакеті BM_SaveFiles* (склад, користувачі, журнали, знімки).
+    constexpr int BENCH_SAVE_FILES = 4;
+
+    /// Серіалізований склад, поділений на BENCH_SAVE_FILES записів із fsync.
+    std::vector<FileOp> SaveFileOps(std::int64_t size)
+    {
+        const std::string text = Roster(size).Serialize();
+        const std::size_t part = text.size() / BENCH_SAVE_FILES + 1;
+        const FileManager fm(BenchDirectory());
+        std::vector<FileOp> ops(BENCH_SAVE_FILES);
+        for (int i = 0; i < BENCH_SAVE_FILES; ++i)
+        {
+            ops[i].path = fm.GetFullPath("bench_save_" + std::to_string(i));
+            ops[i].data = text.substr(i * part, part);
+            ops[i].sync = true;
+        }
+        fm.EnsureDirectoryExists();
+        return ops;
+    }
+
+    /// Пакет записів рушієм @p backend; sequential — по одному файлу.
+    void RunSaveFiles(BenchmarkState& state, AsyncFileBackend backend,
+                      bool sequential)
+    {
+        const auto engine = AsyncFileEngine::Create(backend);
+        if (!engine)
+        {
+            state.SetLabel("unavailable");
+            while (state.KeepRunning())
+            {
+            }
+            return;
+        }
+
+        auto ops = SaveFileOps(state.GetArg());
+        while (state.KeepRunning())
+        {
+            if (!sequential)
+            {
+                DoNotOptimize(engine->Execute(ops));
+                continue;
+            }
+            for (auto& op : ops)
+            {
+                std::vector<FileOp> single{op};
+                DoNotOptimize(engine->Execute(single));
+            }
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * BENCH_SAVE_FILES);
+        state.SetLabel(engine->GetName());
+    }
+
+    void BM_SaveFilesSequential(BenchmarkState& state)
+    {
+        // Як раніше SaveAllData: запис і fsync файлів один за одним.
+        RunSaveFiles(state, AsyncFileBackend::ThreadPool, true);
+    }
+
+    void BM_SaveFilesBatch(BenchmarkState& state)
+    {
+        RunSaveFiles(state, AsyncFileBackend::IoUring, false);
+    }
+
+    void BM_SaveFilesBatchThreadPool(BenchmarkState& state)
+    {
+        RunSaveFiles(state, AsyncFileBackend::ThreadPool, false);
+    }
+
+    void BM_DecodeRosterBinary(BenchmarkState& state)
+    {
+        // Ті самі контрактні гравці, що й у BM_LoadRoster, але бінарним
+        // кодеком схеми: без ключів і розбору чисел.
+        std::vector<const ContractedPlayer*> players;
+        for (const auto& p : Roster(state.GetArg()).GetAll())
+            if (const auto* c = dynamic_cast<const ContractedPlayer*>(p.get()))
+                players.push_back(c);
+
+        const auto& schema = ContractedPlayer::GetSchema();
+        std::string encoded;
+        for (const ContractedPlayer* c : players)
+            schema.EncodeBinary(*c, encoded);
+
+        while (state.KeepRunning())
+        {
+            std::string_view in = encoded;
+            for (std::size_t i = 0; i < players.size(); ++i)
+            {
+                ContractedPlayer decoded;
+                schema.DecodeBinary(decoded, in);
+                DoNotOptimize(decoded.GetPlayerId());
+            }
+        }
+
+        state.SetItemsProcessed(
+            state.GetIterations() * static_cast<std::int64_t>(players.size()));
+    }
+
+    /// Розміри текстового й стисненого файлу складу для мітки бенчмарку.
+    std::string SizeLabel(const FileManager& fm)
+    {
+        const auto text = std::filesystem::file_size(
+            fm.GetFullPath(BENCH_ROSTER_FILE));
+        const auto packed = std::filesystem::file_size(
+            fm.GetFullPath(BENCH_ARCHIVE_FILE));
+        std::ostringstream ss;
+        ss << "text=" << text << "B archive=" << packed << "B ratio="
+            << static_cast<double>(text) / static_cast<double>(packed);
+        return ss.str();
+    }
+
+    void BM_SaveRosterCompressed(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+        const FileManager fm(BenchDirectory());
+
+        while (state.KeepRunning())
+            DoNotOptimize(fm.SaveCompressed(BENCH_ARCHIVE_FILE, club));
+
+        fm.SaveToFile(BENCH_ROSTER_FILE, club);
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel(SizeLabel(fm));
+    }
+
+    void BM_LoadRosterCompressed(BenchmarkState& state)
+    {
+        const FileManager fm(BenchDirectory());
+        fm.SaveToFile(BENCH_ROSTER_FILE, Roster(state.GetArg()));
+        fm.SaveCompressed(BENCH_ARCHIVE_FILE, Roster(state.GetArg()));
+
+        while (state.KeepRunning())
+        {
+            ClubManager loaded;
+            loaded.DeserializeAllPlayers(fm.LoadCompressed(BENCH_ARCHIVE_FILE));
+            DoNotOptimize(loaded.GetAll().size());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel(SizeLabel(fm));
+    }
+
+    void BM_FetchPlayerCompressed(BenchmarkState& state)
+    {
+        // Один гравець з архіву: footer + один блок, без розбору решти.
+        const ClubManager& club = Roster(state.GetArg());
+        const FileManager fm(BenchDirectory());
+        fm.SaveCompressed(BENCH_ARCHIVE_FILE, club);
+
+        std::mt19937_64 rng(11);
+        std::uniform_int_distribution<std::size_t> pick(
+            0, club.GetAll().size() - 1);
+
+        while (state.KeepRunning())
+        {
+            const int id = club.GetAll()[pick(rng)]->GetPlayerId();
+            DoNotOptimize(fm.LoadCompressedRecord(BENCH_ARCHIVE_FILE, id));
+        }
+
+        state.SetItemsProcessed(state.GetIterations());
+    }
+
+    void BM_SearchByName(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+        std::size_t found = 0;
+        std::uint64_t allocations = 0;
+
+        while (state.KeepRunning())
+        {
+            const AllocationScope scope;
+            const auto result = club.SearchByName("Забарний");
+            allocations = std::max(allocations, scope.Count());
+            found = result.size();
+            DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel("matches=" + std::to_string(found) + " " +
+            CheckAllocations(state, "BM_SearchByName", allocations));
+    }
+
+    void BM_FilterByStatus(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+        std::size_t found = 0;
+        std::uint64_t allocations = 0;
+
+        while (state.KeepRunning())
+        {
+            const AllocationScope scope;
+            const auto result = club.FilterByStatus("Травмований");
+            allocations = std::max(allocations, scope.Count());
+            found = result.size();
+            DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel("matches=" + std::to_string(found) + " " +
+            CheckAllocations(state, "BM_FilterByStatus", allocations));
+    }
+
+    void BM_FilterByStatusVariant(BenchmarkState& state)
+    {
+        const VariantRoster& roster = VariantRosterOf(state.GetArg());
+        std::size_t found = 0;
+
+        while (state.KeepRunning())
+        {
+            const auto result = roster.FilterByStatus("Травмований");
+            found = result.size();
+            DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel("matches=" + std::to_string(found));
+    }
+
+    void BM_LeagueSearchByName(BenchmarkState& state)
+    {
+        // Пошук розсилається всім шардам; порівнювати з BM_SearchByName.
+        const LeagueManager& league = LeagueOf(state.GetArg());
+        std::size_t found = 0;
+
+        while (state.KeepRunning())
+        {
+            const auto result = league.SearchByName("Забарний");
+            found = result.size();
+            DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel("matches=" + std::to_string(found) + " shards=" +
+            std::to_string(league.GetShardCount()));
+    }
+
+    void BM_SortByPerformanceRating(BenchmarkState& state)
+    {
+        // Кожна ітерація сортує свіжо перемішаний склад, а не вже відсортований.
+        // Копії: гравець належить лише одному складу (тут — кешованому).
+        std::vector<std::shared_ptr<Player>> players;
+        for (const auto& p : Roster(state.GetArg()).GetAll())
+            players.push_back(p->Clone());
+        std::mt19937_64 rng(7);
+        std::unique_ptr<ClubManager> club;
+        std::uint64_t allocations = 0;
+
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            club.reset();
+            std::shuffle(players.begin(), players.end(), rng);
+            club = std::make_unique<ClubManager>("Sort FC", 1e15);
+            for (const auto& p : players) club->AddPlayer(p);
+            state.ResumeTiming();
+
+            const AllocationScope scope;
+            club->SortByPerformanceRating();
+            allocations = std::max(allocations, scope.Count());
+        }
+
+        state.PauseTiming();
+        club.reset();
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel(CheckAllocations(state, "BM_SortByPerformanceRating",
+                                        allocations));
+    }
+
+    void BM_SignFreeAgent(BenchmarkState& state)
+    {
+        ClubManager club("Signing FC", 1e15);
+        for (const auto& p : Roster(state.GetArg()).GetAll())
+            club.AddPlayer(p->Clone());
+
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            auto agent = std::make_shared<FreeAgent>(
+                "Вільний Агент", 27, "Україна", "Київ", 1.82, 76.0,
+                5'000'000.0, Position::Midfielder, 1'000'000.0, "Genoa");
+            state.ResumeTiming();
+
+            DoNotOptimize(club.SignFreeAgent(agent, 1'100'000.0,
+                                             "2030-06-30"));
+        }
+
+        state.SetItemsProcessed(state.GetIterations());
+    }
+
+    /// Запитів у BM_TransferMarketMatch (аргумент — кількість агентів).
+    constexpr std::size_t BENCH_MARKET_DEMANDS = 1'000;
+
+    void BM_TransferMarketMatch(BenchmarkState& state)
+    {
+        std::mt19937_64 rng(7);
+        std::uniform_real_distribution<double> salary(2e5, 5e6);
+        constexpr Position positions[] = {
+            Position::Goalkeeper, Position::Defender, Position::Midfielder,
+            Position::Forward
+        };
+
+        std::vector<std::shared_ptr<Player>> pool;
+        pool.reserve(static_cast<std::size_t>(state.GetArg()));
+        for (std::int64_t i = 0; i < state.GetArg(); ++i)
+            pool.push_back(std::make_shared<FreeAgent>(
+                "Агент " + std::to_string(i), 20 + static_cast<int>(i % 15),
+                "Україна", "Київ", 1.80, 75.0, 1'000'000.0,
+                positions[rng() % 4], salary(rng), "Genoa"));
+
+        std::vector<ClubDemand> demands;
+        demands.reserve(BENCH_MARKET_DEMANDS);
+        std::vector<std::shared_ptr<ClubManager>> clubs;
+        for (int i = 0; i < 16; ++i)
+            clubs.push_back(std::make_shared<ClubManager>(
+                "Market FC " + std::to_string(i), 1e9));
+        for (std::size_t i = 0; i < BENCH_MARKET_DEMANDS; ++i)
+            demands.push_back({clubs[i % clubs.size()], positions[i % 4],
+                               salary(rng), 0.0, "2030-06-30"});
+
+        const TransferMarket market;
+        std::size_t filled = 0;
+        while (state.KeepRunning())
+        {
+            const auto result = market.Match(demands, pool);
+            filled = result.assignments.size();
+            DoNotOptimize(result.totalRating);
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+        state.SetLabel("demands=" + std::to_string(BENCH_MARKET_DEMANDS) +
+                       " filled=" + std::to_string(filled));
+    }
+
+    void BM_CalculateValue(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+
+        while (state.KeepRunning())
+        {
+            double total = 0.0;
+            for (const auto& p : club.GetAll()) total += p->CalculateValue();
+            DoNotOptimize(total);
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_CalculateValueVariant(BenchmarkState& state)
+    {
+        const VariantRoster& roster = VariantRosterOf(state.GetArg());
+
+        while (state.KeepRunning())
+            DoNotOptimize(roster.TotalValue());
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_RateAll(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+
+        while (state.KeepRunning())
+        {
+            std::vector<std::pair<int, double>> ratings;
+            ratings.reserve(club.GetAll().size());
+            for (const auto& p : club.GetAll())
+                ratings.emplace_back(p->GetPlayerId(),
+                                     p->CalculatePerformanceRating());
+            DoNotOptimize(ratings.data());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_RateAllVariant(BenchmarkState& state)
+    {
+        const VariantRoster& roster = VariantRosterOf(state.GetArg());
+
+        while (state.KeepRunning())
+        {
+            const auto ratings = roster.RateAll();
+            DoNotOptimize(ratings.data());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_SerializePlayers(BenchmarkState& state)
+    {
+        const ClubManager& club = Roster(state.GetArg());
+
+        while (state.KeepRunning())
+        {
+            std::vector<std::string> lines;
+            lines.reserve(club.GetAll().size());
+            for (const auto& p : club.GetAll()) lines.push_back(p->Serialize());
+            DoNotOptimize(lines.data());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_SerializePlayersVariant(BenchmarkState& state)
+    {
+        const VariantRoster& roster = VariantRosterOf(state.GetArg());
+
+        while (state.KeepRunning())
+        {
+            const auto lines = roster.SerializeAll();
+            DoNotOptimize(lines.data());
+        }
+
+        state.SetItemsProcessed(state.GetIterations() * state.GetArg());
+    }
+
+    void BM_MetricsIncrement(BenchmarkState& state)
+    {
+        auto& metrics = MetricsRegistry::GetInstance();
+
+        while (state.KeepRunning())
+            metrics.Increment(MetricCounter::SearchResults);
+
+        state.SetItemsProcessed(state.GetIterations());
+    }
+
+    void BM_MetricsRecord(BenchmarkState& state)
+    {
+        auto& metrics = MetricsRegistry::GetInstance();
+        std::uint64_t value = 1;
+
+        while (state.KeepRunning())
+        {
+            // Різні кошики, щоб не вимірювати лише одну гарячу кеш-лінію.
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+            metrics.Record(MetricHistogram::FileSave, value >> 40);
+        }
+
+        state.SetItemsProcessed(state.GetIterations());
+    }
+
+    void BM_VerifyPassword(BenchmarkState& state)
+    {
+        // Аргумент — log2(N) scrypt; вартість входу росте лінійно з N.
+        KdfParams params;
+        params.logN = static_cast<int>(state.GetArg());
+        const std::string hash = PasswordHasher::Hash("bench-password",
+                                                      params);
+
+        while (state.KeepRunning())
+            DoNotOptimize(PasswordHasher::Verify("bench-password", hash));
+
+        state.SetItemsProcessed(state.GetIterations());
+        state.SetLabel("r=" + std::to_string(params.r) + " mem="
+                       + std::to_string(params.MemoryBytes() >> 20) + "MiB");
+    }
+
+    /// Тестовий вектор scrypt з RFC 7914, розділ 12.
+    struct ScryptVector
+    {
+        const char* password;
+        const char* salt;
+        int logN;
+        std::uint32_t r;
+        std::uint32_t p;
+        const char* hex; ///< Очікувані 64 байти.
+    };
+
+    /**
+     * @brief Звірити PasswordHasher::Scrypt з векторами RFC 7914.
+     * @note Четвертий вектор (N = 2^20, 1 ГіБ пам'яті) пропущено.
+     */
+    bool ScryptMatchesRfc7914()
+    {
+        const ScryptVector vectors[] = {
+            {"", "", 4, 1, 1,
+             "77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442"
+             "fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906"},
+            {"password", "NaCl", 10, 8, 16,
+             "fdbabe1c9d3472007856e7190d01e9fe7c6ad7cbc8237830e77376634b373162"
+             "2eaf30d92e22a3886ff109279d9830dac727afb94a83ee6d8360cbdfa2cc0640"},
+            {"pleaseletmein", "SodiumChloride", 14, 8, 1,
+             "7023bdcb3afd7348461c06cd81fd38ebfda8fbba904f8e3ea9b543f6545da1f2"
+             "d5432955613f0fcf62d49705242a9af9e61e85dc0d651e40dfcf017b45575887"},
+        };
+
+        bool matches = true;
+        for (const auto& v : vectors)
+        {
+            KdfParams params;
+            params.logN = v.logN;
+            params.r = v.r;
+            params.p = v.p;
+            const auto key = PasswordHasher::Scrypt(v.password, v.salt,
+                                                    params, 64);
+
+            std::ostringstream hex;
+            for (const auto byte : key)
+                hex << std::hex << std::setw(2) << std::setfill('0')
+                    << static_cast<int>(byte);
+            if (hex.str() == v.hex) continue;
+
+            std::cerr << "[ПОМИЛКА] scrypt(\"" << v.password << "\", \""
+                << v.salt << "\") не збігається з RFC 7914.\n";
+            matches = false;
+        }
+        return matches;
+    }
+
+    void BM_ResolveSession(BenchmarkState& state)
+    {
+        // Авторизація запиту з токеном: пошук у кеші замість KDF.
+        SessionCache cache;
+        std::vector<std::string> tokens;
+        tokens.reserve(static_cast<std::size_t>(state.GetArg()));
+        for (std::int64_t i = 0; i < state.GetArg(); ++i)
+            tokens.push_back(cache.Issue(
+                "user" + std::to_string(i), UserRole::StandardUser,
+                DefaultPermissions(UserRole::StandardUser)));
+
+        std::size_t next = 0;
+        while (state.KeepRunning())
+        {
+            DoNotOptimize(cache.Resolve(tokens[next]));
+            if (++next == tokens.size()) next = 0;
+        }
+
+        state.SetItemsProcessed(state.GetIterations());
+    }
+
+    void BM_ResolveSessionContended(BenchmarkState& state)
+    {
+        // Аргумент — кількість фонових потоків-читачів; ще один потік
+        // постійно видає та анулює токени (ексклюзивні блокування сегментів).
+        constexpr std::size_t TOKENS = 10'000;
+        SessionCache cache;
+        std::vector<std::string> tokens;
+        tokens.reserve(TOKENS);
+        for (std::size_t i = 0; i < TOKENS; ++i)
+            tokens.push_back(cache.Issue(
+                "user" + std::to_string(i), UserRole::StandardUser,
+                DefaultPermissions(UserRole::StandardUser)));
+
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> background;
+        for (std::int64_t t = 0; t < state.GetArg(); ++t)
+            background.emplace_back([&cache, &tokens, &stop, t]()
+            {
+                for (auto next = static_cast<std::size_t>(t) * 7919;
+                     !stop.load(std::memory_order_relaxed); ++next)
+                    DoNotOptimize(cache.Resolve(tokens[next % tokens.size()]));
+            });
+        background.emplace_back([&cache, &stop]()
+        {
+            while (!stop.load(std::memory_order_relaxed))
+                cache.Revoke(cache.Issue("churn", UserRole::Guest,
+                                         NO_PERMISSIONS));
+        });
+
+        std::size_t next = 0;
+        while (state.KeepRunning())
+        {
+            DoNotOptimize(cache.Resolve(tokens[next]));
+            if (++next == tokens.size()) next = 0;
+        }
+
+        stop = true;
+        for (auto& thread : background) thread.join();
+        state.SetItemsProcessed(state.GetIterations());
+        state.SetLabel("readers=" + std::to_string(state.GetArg() + 1) +
+                       " writers=1");
+    }
+
+    /// --roster_size=1000,100000 → розміри складів для параметризованих бенчмарків.
+    std::vector<std::int64_t> ParseRosterSizes(int argc, char** argv)
+    {
+        const std::string prefix = "--roster_size=";
+        std::vector<std::int64_t> sizes;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg.compare(0, prefix.size(), prefix) != 0) continue;
+
+            std::stringstream ss(arg.substr(prefix.size()));
+            std::string item;
+            while (std::getline(ss, item, ','))
+            {
+                const std::int64_t n = std::stoll(item);
+                if (n <= 0)
+                    throw std::invalid_argument(
+                        "Розмір складу має бути додатним.");
+                sizes.push_back(n);
+            }
+        }
+
+        if (sizes.empty()) sizes = {1'000, 100'000};
+        return sizes;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace FootballManagement;
+
+    std::vector<std::int64_t> sizes;
+    try
+    {
+        sizes = ParseRosterSizes(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[ПОМИЛКА] Некоректний --roster_size: " << e.what()
+            << "\n";
+        return 1;
+    }
+
+    // Модель пише у Console(); під час вимірів ці повідомлення не потрібні.
+    ScopedConsoleMute mute;
+
+    // Виміри KDF мають сенс лише для коректного scrypt.
+    if (!ScryptMatchesRfc7914()) return 1;
+
+    RegisterBenchmark("BM_SaveRoster", BM_SaveRoster, sizes);
+    RegisterBenchmark("BM_LoadRoster", BM_LoadRoster, sizes);
+    RegisterBenchmark("BM_LoadRosterLazy", BM_LoadRosterLazy, sizes);
+    RegisterBenchmark("BM_IngestPipeline", BM_IngestPipeline, sizes);
+    RegisterBenchmark("BM_StartupLoad", BM_StartupLoad, sizes);
+    RegisterBenchmark("BM_SaveFilesSequential", BM_SaveFilesSequential,
+                      sizes);
+    RegisterBenchmark("BM_SaveFilesBatch", BM_SaveFilesBatch, sizes);
+    RegisterBenchmark("BM_SaveFilesBatchThreadPool",
+                      BM_SaveFilesBatchThreadPool, sizes);
+    RegisterBenchmark("BM_DecodeRosterBinary", BM_DecodeRosterBinary, sizes);
+    RegisterBenchmark("BM_SaveRosterCompressed", BM_SaveRosterCompressed,
+                      sizes);
+    RegisterBenchmark("BM_LoadRosterCompressed", BM_LoadRosterCompressed,
+                      sizes);
+    RegisterBenchmark("BM_FetchPlayerCompressed", BM_FetchPlayerCompressed,
+                      sizes);
+    RegisterBenchmark("BM_SearchByName", BM_SearchByName, sizes);
+    RegisterBenchmark("BM_FilterByStatus", BM_FilterByStatus, sizes);
+    RegisterBenchmark("BM_LeagueSearchByName", BM_LeagueSearchByName, sizes);
+    RegisterBenchmark("BM_FilterByStatusVariant", BM_FilterByStatusVariant,
+                      sizes);
+    RegisterBenchmark("BM_SortByPerformanceRating",
+                      BM_SortByPerformanceRating, sizes);
+    RegisterBenchmark("BM_SignFreeAgent", BM_SignFreeAgent, sizes);
+    RegisterBenchmark("BM_TransferMarketMatch", BM_TransferMarketMatch,
+                      {100'000});
+    RegisterBenchmark("BM_CalculateValue", BM_CalculateValue, sizes);
+    RegisterBenchmark("BM_CalculateValueVariant", BM_CalculateValueVariant,
+                      sizes);
+    RegisterBenchmark("BM_RateAll", BM_RateAll, sizes);
+    RegisterBenchmark("BM_RateAllVariant", BM_RateAllVariant, sizes);
+    RegisterBenchmark("BM_SerializePlayers", BM_SerializePlayers, sizes);
+    RegisterBenchmark("BM_SerializePlayersVariant",
+                      BM_SerializePlayersVariant, sizes);
+    RegisterBenchmark("BM_MetricsIncrement", BM_MetricsIncrement);
+    RegisterBenchmark("BM_MetricsRecord", BM_MetricsRecord);
+    RegisterBenchmark("BM_VerifyPassword", BM_VerifyPassword,
+                      {10, 12, 14, 16});
+    RegisterBenchmark("BM_ResolveSession", BM_ResolveSession,
+                      {1'000, 100'000});
+    RegisterBenchmark("BM_ResolveSessionContended",
+                      BM_ResolveSessionContended, {0, 1, 3, 7});
+
+    const int code = RunBenchmarks(argc, argv);
+    leagueCache.clear();
+    variantCache.clear();
+    rosterCache.clear();
+
+    std::error_code ec;
+    std::filesystem::remove_all(BenchDirectory(), ec);
+
+    for (const auto& [name, allocations] : allocationFailures)
+        std::cerr << "[ПОМИЛКА] " << name << ": " << allocations
+            << " виділень пам'яті за виклик — залежить від розміру складу.\n";
+    return allocationFailures.empty() ? code : 1;
+}
@@ -0,0 +1,336 @@
+#include "Benchmark.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    struct BenchmarkDef
+    {
+        std::string name;
+        std::function<void(BenchmarkState&)> fn;
+        std::vector<std::int64_t> args;
+    };
+
+    struct BenchmarkRun
+    {
+        std::string name;
+        std::int64_t iterations = 0;
+        double realNs = 0.0; ///< Реальний час на ітерацію.
+        double cpuNs = 0.0; ///< Процесорний час на ітерацію.
+        double itemsPerSecond = 0.0;
+        std::string label;
+    };
+
+    std::vector<BenchmarkDef>& Registry()
+    {
+        static std::vector<BenchmarkDef> registry;
+        return registry;
+    }
+
+    constexpr std::int64_t MAX_ITERATIONS = 1'000'000'000;
+
+    /// Підбір кількості ітерацій за схемою Google Benchmark.
+    BenchmarkRun RunOne(const BenchmarkDef& def, const std::string& name,
+                        std::int64_t arg, double minTime)
+    {
+        std::int64_t iterations = 1;
+        while (true)
+        {
+            BenchmarkState state(iterations, arg);
+            def.fn(state);
+
+            const double real = state.GetRealSeconds();
+            if (real >= minTime || iterations >= MAX_ITERATIONS)
+            {
+                BenchmarkRun run;
+                run.name = name;
+                run.iterations = state.GetIterations();
+                const double n = std::max<std::int64_t>(1, run.iterations);
+                run.realNs = real * 1e9 / n;
+                run.cpuNs = state.GetCpuSeconds() * 1e9 / n;
+                if (state.GetItemsProcessed() > 0 && real > 0.0)
+                    run.itemsPerSecond = state.GetItemsProcessed() / real;
+                run.label = state.GetLabel();
+                return run;
+            }
+
+            double multiplier = minTime * 1.4 / std::max(real, 1e-9);
+            if (real / minTime <= 0.1) multiplier = std::min(multiplier, 10.0);
+            if (multiplier <= 1.0) multiplier = 2.0;
+            iterations = std::min<std::int64_t>(
+                MAX_ITERATIONS,
+                std::max<std::int64_t>(
+                    iterations + 1,
+                    static_cast<std::int64_t>(iterations * multiplier + 0.5)));
+        }
+    }
+
+    std::string JsonEscape(const std::string& s)
+    {
+        std::string out;
+        out.reserve(s.size());
+        for (const char c : s)
+        {
+            switch (c)
+            {
+            case '"': out += "\\\"";
+                break;
+            case '\\': out += "\\\\";
+                break;
+            case '\n': out += "\\n";
+                break;
+            default:
+                out += c;
+            }
+        }
+        return out;
+    }
+
+    void WriteJson(std::ostream& os, const std::vector<BenchmarkRun>& runs,
+                   const char* executable)
+    {
+        char date[64] = {};
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S",
+                      std::localtime(&now));
+
+        os << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"executable\": \"" << JsonEscape(executable) << "\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency()
+            << ",\n"
+#ifdef NDEBUG
+            << "    \"library_build_type\": \"release\"\n"
+#else
+            << "    \"library_build_type\": \"debug\"\n"
+#endif
+            << "  },\n  \"benchmarks\": [";
+
+        os << std::setprecision(10);
+        for (std::size_t i = 0; i < runs.size(); ++i)
+        {
+            const auto& r = runs[i];
+            os << (i ? ",\n" : "\n") << "    {\n"
+                << "      \"name\": \"" << JsonEscape(r.name) << "\",\n"
+                << "      \"run_name\": \"" << JsonEscape(r.name) << "\",\n"
+                << "      \"run_type\": \"iteration\",\n"
+                << "      \"iterations\": " << r.iterations << ",\n"
+                << "      \"real_time\": " << r.realNs << ",\n"
+                << "      \"cpu_time\": " << r.cpuNs << ",\n"
+                << "      \"time_unit\": \"ns\"";
+            if (r.itemsPerSecond > 0.0)
+                os << ",\n      \"items_per_second\": " << r.itemsPerSecond;
+            if (!r.label.empty())
+                os << ",\n      \"label\": \"" << JsonEscape(r.label) << "\"";
+            os << "\n    }";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+    void WriteConsoleRow(std::ostream& os, const BenchmarkRun& r)
+    {
+        os << std::left << std::setw(44) << r.name << std::right
+            << std::fixed << std::setprecision(0)
+            << std::setw(14) << r.realNs << " ns"
+            << std::setw(14) << r.cpuNs << " ns"
+            << std::setw(12) << r.iterations;
+        if (r.itemsPerSecond > 0.0)
+            os << "  items/s=" << std::setprecision(3) << std::scientific
+                << r.itemsPerSecond << std::defaultfloat;
+        if (!r.label.empty()) os << "  " << r.label;
+        os << "\n";
+    }
+
+    bool ParseFlag(const std::string& arg, const std::string& flag,
+                   std::string& value)
+    {
+        const std::string prefix = "--" + flag + "=";
+        if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+        value = arg.substr(prefix.size());
+        return true;
+    }
+}
+
+namespace FootballManagement
+{
+    BenchmarkState::BenchmarkState(std::int64_t maxIterations,
+                                   std::int64_t arg)
+        : maxIterations_(maxIterations),
+          arg_(arg)
+    {
+    }
+
+    bool BenchmarkState::KeepRunning()
+    {
+        if (!started_)
+        {
+            started_ = true;
+            ResumeTiming();
+        }
+
+        if (iterations_ < maxIterations_)
+        {
+            ++iterations_;
+            return true;
+        }
+
+        if (running_) PauseTiming();
+        return false;
+    }
+
+    void BenchmarkState::PauseTiming()
+    {
+        if (!running_) return;
+        realSeconds_ += std::chrono::duration<double>(
+            Clock::now() - realStart_).count();
+        cpuSeconds_ += static_cast<double>(std::clock() - cpuStart_)
+            / CLOCKS_PER_SEC;
+        running_ = false;
+    }
+
+    void BenchmarkState::ResumeTiming()
+    {
+        if (running_) return;
+        running_ = true;
+        cpuStart_ = std::clock();
+        realStart_ = Clock::now();
+    }
+
+    std::int64_t BenchmarkState::GetArg() const
+    {
+        return arg_;
+    }
+
+    std::int64_t BenchmarkState::GetIterations() const
+    {
+        return iterations_;
+    }
+
+    double BenchmarkState::GetRealSeconds() const
+    {
+        return realSeconds_;
+    }
+
+    double BenchmarkState::GetCpuSeconds() const
+    {
+        return cpuSeconds_;
+    }
+
+    void BenchmarkState::SetItemsProcessed(std::int64_t items)
+    {
+        itemsProcessed_ = items;
+    }
+
+    std::int64_t BenchmarkState::GetItemsProcessed() const
+    {
+        return itemsProcessed_;
+    }
+
+    void BenchmarkState::SetLabel(const std::string& label)
+    {
+        label_ = label;
+    }
+
+    const std::string& BenchmarkState::GetLabel() const
+    {
+        return label_;
+    }
+
+    void RegisterBenchmark(const std::string& name,
+                           std::function<void(BenchmarkState&)> fn,
+                           const std::vector<std::int64_t>& args)
+    {
+        Registry().push_back({name, std::move(fn), args});
+    }
+
+    int RunBenchmarks(int argc, char** argv)
+    {
+        std::string filter;
+        std::string format = "console";
+        std::string outPath;
+        double minTime = 0.5;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            std::string value;
+            if (ParseFlag(arg, "benchmark_filter", value)) filter = value;
+            else if (ParseFlag(arg, "benchmark_format", value)) format = value;
+            else if (ParseFlag(arg, "benchmark_out", value)) outPath = value;
+            else if (ParseFlag(arg, "benchmark_min_time", value))
+            {
+                try
+                {
+                    minTime = std::stod(value);
+                }
+                catch (const std::exception&)
+                {
+                    std::cerr << "[ПОМИЛКА] Некоректне значення " << arg << "\n";
+                    return 1;
+                }
+            }
+        }
+
+        if (format != "console" && format != "json")
+        {
+            std::cerr << "[ПОМИЛКА] Невідомий формат: " << format << "\n";
+            return 1;
+        }
+
+        const bool consoleTable = format == "console";
+        if (consoleTable)
+        {
+            std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+                << std::setw(17) << "Time" << std::setw(17) << "CPU"
+                << std::setw(12) << "Iterations" << "\n"
+                << std::string(90, '-') << "\n";
+        }
+
+        std::vector<BenchmarkRun> runs;
+        for (const auto& def : Registry())
+        {
+            std::vector<std::int64_t> args = def.args;
+            const bool plain = args.empty();
+            if (plain) args.push_back(0);
+
+            for (const std::int64_t arg : args)
+            {
+                const std::string name = plain
+                    ? def.name
+                    : def.name + "/" + std::to_string(arg);
+                if (!filter.empty() && name.find(filter) == std::string::npos)
+                    continue;
+
+                runs.push_back(RunOne(def, name, arg, minTime));
+                if (consoleTable)
+                {
+                    WriteConsoleRow(std::cout, runs.back());
+                    std::cout.flush();
+                }
+            }
+        }
+
+        if (!consoleTable) WriteJson(std::cout, runs, argv[0]);
+
+        if (!outPath.empty())
+        {
+            std::ofstream out(outPath, std::ios::out | std::ios::trunc);
+            if (!out.is_open())
+            {
+                std::cerr << "[ПОМИЛКА] Не вдалося відкрити " << outPath << "\n";
+                return 1;
+            }
+            WriteJson(out, runs, argv[0]);
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @file Benchmark.h
+     * @brief Мінімальний бенчмарк-раннер у стилі Google Benchmark.
+     * @details Кожен бенчмарк — функція від BenchmarkState, що крутить цикл
+     *          `while (state.KeepRunning())`. Раннер підбирає кількість ітерацій
+     *          так, щоб вимір тривав не менше --benchmark_min_time секунд,
+     *          і видає таблицю або JSON у форматі Google Benchmark
+     *          (--benchmark_format=json, --benchmark_out=<файл>), тож
+     *          результати можна порівнювати стандартним compare.py.
+     */
+
+    /**
+     * @class BenchmarkState
+     * @brief Стан одного запуску: лічильник ітерацій, таймери, лічильники.
+     */
+    class BenchmarkState
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        std::int64_t maxIterations_; ///< Скільки ітерацій виконати.
+        std::int64_t iterations_ = 0; ///< Виконано ітерацій.
+        std::int64_t arg_; ///< Параметр бенчмарку (розмір складу).
+        bool started_ = false; ///< Таймер уже запускався.
+        bool running_ = false; ///< Таймер зараз іде.
+        Clock::time_point realStart_; ///< Початок поточного відрізка.
+        std::clock_t cpuStart_ = 0; ///< Процесорний час початку відрізка.
+        double realSeconds_ = 0.0; ///< Накопичений реальний час.
+        double cpuSeconds_ = 0.0; ///< Накопичений процесорний час.
+        std::int64_t itemsProcessed_ = 0; ///< Оброблено елементів (для items_per_second).
+        std::string label_; ///< Довільна позначка до результату.
+
+    public:
+        BenchmarkState(std::int64_t maxIterations, std::int64_t arg);
+
+        /**
+         * @brief Умова циклу вимірювання.
+         * @return true, поки не виконано потрібну кількість ітерацій.
+         */
+        bool KeepRunning();
+
+        /// @brief Призупинити таймери (підготовка даних поза виміром).
+        void PauseTiming();
+
+        /// @brief Відновити таймери після PauseTiming().
+        void ResumeTiming();
+
+        /// @brief Параметр бенчмарку (як state.range(0)).
+        [[nodiscard]] std::int64_t GetArg() const;
+
+        [[nodiscard]] std::int64_t GetIterations() const;
+        [[nodiscard]] double GetRealSeconds() const;
+        [[nodiscard]] double GetCpuSeconds() const;
+
+        void SetItemsProcessed(std::int64_t items);
+        [[nodiscard]] std::int64_t GetItemsProcessed() const;
+
+        void SetLabel(const std::string& label);
+        [[nodiscard]] const std::string& GetLabel() const;
+    };
+
+    /**
+     * @brief Не дати компілятору викинути обчислення, результат якого не використовується.
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Зареєструвати бенчмарк.
+     * @param name Назва (у звіті: name/arg).
+     * @param fn Тіло бенчмарку.
+     * @param args Значення параметра; для кожного — окремий запуск.
+     *             Порожній список — один запуск без параметра.
+     */
+    void RegisterBenchmark(const std::string& name,
+                           std::function<void(BenchmarkState&)> fn,
+                           const std::vector<std::int64_t>& args = {});
+
+    /**
+     * @brief Запустити зареєстровані бенчмарки.
+     * @details Розуміє --benchmark_filter=<підрядок>, --benchmark_min_time=<с>,
+     *          --benchmark_format=console|json, --benchmark_out=<файл>;
+     *          інші аргументи ігнорує (їх розбирає сам виконуваний файл).
+     * @return Код завершення процесу.
+     */
+    int RunBenchmarks(int argc, char** argv);
+}
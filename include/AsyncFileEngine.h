@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @file AsyncFileEngine.h
+     * @brief Пакетний асинхронний ввід-вивід файлів.
+     * @details Пакет операцій (прочитати файл цілком, записати файл цілком,
+     *          fsync) подається одним викликом Execute(): усі операції пакета
+     *          виконуються одночасно, і виклик повертається, коли завершено
+     *          останню. На Linux основний рушій — io_uring (через системні
+     *          виклики, без liburing): записи всіх файлів стоять у черзі ядра
+     *          разом, а fsync файлу подається, щойно його дані записано.
+     *          Якщо io_uring недоступний (старе ядро, заборона seccomp, інша
+     *          ОС), ті самі операції виконує пул потоків блокуючим вводом-
+     *          виводом.
+     */
+
+    /**
+     * @enum FileOpKind
+     * @brief Вид операції пакета.
+     */
+    enum class FileOpKind : std::uint8_t
+    {
+        Read, ///< Прочитати файл цілком у FileOp::data.
+        Write ///< Переписати файл вмістом FileOp::data.
+    };
+
+    /**
+     * @struct FileOp
+     * @brief Одна операція пакета.
+     */
+    struct FileOp
+    {
+        FileOpKind kind = FileOpKind::Write; ///< Вид операції.
+        std::string path; ///< Повний шлях до файлу.
+        std::string data; ///< Вміст для запису / прочитаний вміст.
+        bool sync = false; ///< Write: fsync після запису.
+        int error = 0; ///< Результат: 0 або код errno.
+    };
+
+    /**
+     * @enum AsyncFileBackend
+     * @brief Вибір рушія для AsyncFileEngine::Create().
+     */
+    enum class AsyncFileBackend : std::uint8_t
+    {
+        Auto, ///< io_uring, якщо доступний, інакше пул потоків.
+        IoUring, ///< Лише io_uring (nullptr, якщо недоступний).
+        ThreadPool ///< Пул потоків із блокуючим вводом-виводом.
+    };
+
+    /**
+     * @class AsyncFileEngine
+     * @brief Рушій пакетного вводу-виводу (io_uring або пул потоків).
+     */
+    class AsyncFileEngine
+    {
+    public:
+        virtual ~AsyncFileEngine() = default;
+
+        /**
+         * @brief Виконати пакет операцій одночасно.
+         * @details Операції пакета незалежні: кожна — над своїм файлом.
+         *          Пакети одного рушія виконуються по черзі.
+         * @param ops Операції; error і (для Read) data заповнюються.
+         * @return true, якщо всі операції успішні.
+         */
+        virtual bool Execute(std::vector<FileOp>& ops) = 0;
+
+        /// @brief Назва рушія ("io_uring" або "thread_pool").
+        [[nodiscard]] virtual const char* GetName() const = 0;
+
+        /**
+         * @brief Створити рушій.
+         * @return Рушій або nullptr (лише для AsyncFileBackend::IoUring).
+         */
+        static std::unique_ptr<AsyncFileEngine>
+        Create(AsyncFileBackend backend = AsyncFileBackend::Auto);
+
+        /// @brief Спільний рушій процесу (Auto; створюється при першому виклику).
+        static AsyncFileEngine& GetDefault();
+    };
+}
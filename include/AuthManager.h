@@ -1,10 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include "User.h"
+#include "SessionCache.h"
 #include "IFileHandler.h"
 
 namespace FootballManagement
@@ -65,6 +67,43 @@ namespace FootballManagement
          */
         bool LoginAsGuest();
 
+        /**
+         * @brief Перевірити облікові дані без зміни поточного користувача.
+         *
+         * Для серверного режиму, де кожне з'єднання має власну сесію.
+         *
+         * @param userName Логін.
+         * @param password Пароль.
+         * @return Користувач або nullptr, якщо логін/пароль невірні.
+         */
+        [[nodiscard]] std::shared_ptr<User>
+        Authenticate(const std::string& userName,
+                     const std::string& password) const;
+
+        /**
+         * @brief Увійти та отримати токен сесії (для серверного режиму).
+         *
+         * Пароль перевіряється один раз; далі кожен запит авторизується
+         * через ResolveSession() без повторного KDF.
+         *
+         * @return Токен або порожній рядок, якщо логін/пароль невірні.
+         */
+        std::string CreateSession(const std::string& userName,
+                                  const std::string& password);
+
+        /**
+         * @brief Розв'язати токен у користувача та роль.
+         * @return std::nullopt для невідомого або простроченого токена.
+         */
+        [[nodiscard]] std::optional<SessionInfo>
+        ResolveSession(const std::string& token) const;
+
+        /// @brief Завершити сесію. @return true, якщо токен існував.
+        bool EndSession(const std::string& token);
+
+        /// @brief Кеш сесій (налаштування TTL, очищення).
+        [[nodiscard]] SessionCache& GetSessions();
+
         /**
          * @brief Вийти з системи.
          *
@@ -76,6 +115,7 @@ namespace FootballManagement
          * @brief Видалити користувача (лише Admin).
          * @param userName Логін користувача.
          * @return true, якщо видалено; false — якщо не знайдено або бракує прав.
+         * @post Усі сесії користувача анульовано.
          */
         bool DeleteUser(const std::string& userName);
 
@@ -84,14 +124,47 @@ namespace FootballManagement
          * @param userName Логін користувача.
          * @param newRole Нова роль.
          * @return true, якщо змінено; false — якщо не знайдено або бракує прав.
+         * @post Сесії користувача анульовано (кешована роль застаріла).
          */
         bool ChangeUserRole(const std::string& userName, UserRole newRole);
 
+        /**
+         * @brief Призначити користувачу власну роль із ROLES_CONFIG_FILE
+         *        (потрібне право ManageUsers).
+         * @param userName Логін користувача.
+         * @param roleName Назва власної ролі; порожня — стандартні права ролі.
+         * @return true, якщо призначено; false — немає користувача/ролі або прав.
+         * @post Сесії користувача анульовано.
+         */
+        bool AssignCustomRole(const std::string& userName,
+                              const std::string& roleName);
+
+        /**
+         * @brief Завантажити власні ролі з рядків "назва:право,право,...".
+         * @details Маски вже завантажених користувачів перераховуються одразу;
+         *          некоректні рядки пропускаються з повідомленням.
+         * @return Кількість завантажених ролей.
+         */
+        std::size_t LoadCustomRoles(const std::vector<std::string>& lines);
+
+        /**
+         * @brief Чи має поточний користувач право (одна бітова перевірка).
+         * @return false, якщо вхід не виконано.
+         */
+        [[nodiscard]] bool CurrentUserCan(Permission permission) const;
+
         /**
          * @brief Вивести список користувачів (лише Admin).
          */
         void ViewAllUsers() const;
 
+        /**
+         * @brief Знайти зареєстрованого користувача за логіном.
+         * @return Користувач або nullptr.
+         */
+        [[nodiscard]] std::shared_ptr<User>
+        FindUser(const std::string& userName) const;
+
         /**
          * @brief Поточний користувач (Guest / User / Admin).
          */
@@ -109,8 +182,8 @@ namespace FootballManagement
         /**
          * @brief Серіалізувати всіх зареєстрованих користувачів у вигляді тексту.
          *
-         * Формат рядків: userName:password:roleInt
-         * (по одному користувачу в рядку).
+         * Формат рядків: userName:passwordHash:roleInt[:customRole]
+         * (по одному користувачу в рядку, відсортовано за логіном).
          */
         [[nodiscard]] std::string Serialize() const override;
 
@@ -128,6 +201,12 @@ namespace FootballManagement
          */
         void DeserializeAllUsers(const std::vector<std::string>& userDatas);
 
+        /**
+         * @brief Скільки записів останнього DeserializeAllUsers() мали пароль
+         *        відкритим текстом і були захешовані (файл варто перезаписати).
+         */
+        [[nodiscard]] int GetMigratedUserCount() const;
+
     private:
         /**
          * @brief Приватний конструктор Singleton’а.
@@ -148,6 +227,16 @@ namespace FootballManagement
          * true  — користувач свідомо обрав «Увійти як гість» (вважаємо це входом).
          */
         bool guestSessionActive_ = false;
+
+        SessionCache sessions_; ///< Токени серверних сесій.
+
+        std::unordered_map<std::string, PermissionSet> customRoles_;
+        ///< Власні ролі: назва → маска прав.
+
+        /// @brief Підставити маску власної ролі користувача (або стандартні права).
+        void ResolvePermissions(User& user) const;
+
+        int migratedUsers_ = 0; ///< Див. GetMigratedUserCount().
     };
 }
 
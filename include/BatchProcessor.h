@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ClubManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file BatchProcessor.h
+     * @brief Неінтерактивне виконання сценарію операцій над складом.
+     * @details Один рядок — одна операція, поля розділені символом '|'
+     *          (порожні рядки та рядки з '#' пропускаються):
+     *
+     *          add|goalkeeper|Ім'я|вік|національність|походження|зріст|вага|вартість
+     *          add|contracted|Ім'я|вік|нац.|пох.|зріст|вага|вартість|позиція|зарплата|YYYY-MM-DD
+     *          add|free|Ім'я|вік|нац.|пох.|зріст|вага|вартість|позиція|очікувана_зарплата|останній_клуб
+     *          remove|ID
+     *          revalue|ID або *|відсоток
+     *          sign|ID|зарплата|YYYY-MM-DD
+     *          transfer|ID|клуб-покупець|сума
+     *
+     *          Позиція: GK, DEF, MID, FWD (або 0–3, як у меню).
+     *          Помилковий рядок пропускається й потрапляє у звіт; решта
+     *          сценарію виконується. Видалення та продажі збираються і
+     *          застосовуються одним проходом складу наприкінці.
+     */
+
+    /**
+     * @struct BatchSummary
+     * @brief Підсумок виконання сценарію.
+     */
+    struct BatchSummary
+    {
+        std::size_t lines = 0; ///< Рядків з операціями.
+        std::size_t applied = 0; ///< Успішно виконано.
+        std::size_t added = 0; ///< Додано гравців.
+        std::size_t removed = 0; ///< Видалено гравців.
+        std::size_t revalued = 0; ///< Змінено вартість (гравців).
+        std::size_t signings = 0; ///< Підписано вільних агентів.
+        std::size_t transfers = 0; ///< Продано гравців.
+        std::vector<std::string> errors; ///< «Рядок N: причина» для кожної помилки.
+    };
+
+    /**
+     * @class BatchProcessor
+     * @brief Застосовує сценарій операцій до ClubManager без консольного меню.
+     */
+    class BatchProcessor
+    {
+    private:
+        ClubManager& club_; ///< Клуб, над яким виконується сценарій.
+        std::unordered_set<int> pendingRemoval_; ///< Видалені/продані, ще не стерті зі складу.
+        BatchSummary summary_; ///< Підсумок поточного запуску.
+
+        /// @brief Виконати одну операцію (кидає std::invalid_argument при помилці).
+        void ApplyLine(const std::vector<std::string>& fields);
+
+        void Add(const std::vector<std::string>& fields);
+        void Remove(const std::vector<std::string>& fields);
+        void Revalue(const std::vector<std::string>& fields);
+        void Sign(const std::vector<std::string>& fields);
+        void Transfer(const std::vector<std::string>& fields);
+
+        /// @brief Гравець складу за ID без урахування вже видалених у сценарії.
+        [[nodiscard]] std::shared_ptr<Player> Find(int playerId) const;
+
+    public:
+        /// @brief Конструктор.
+        explicit BatchProcessor(ClubManager& club);
+
+        /**
+         * @brief Виконати сценарій.
+         * @param script Потік із рядками операцій (файл або stdin).
+         * @return Підсумок виконання.
+         */
+        BatchSummary Run(std::istream& script);
+    };
+}
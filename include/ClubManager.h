@@ -1,13 +1,25 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "Player.h"
+#include "PlayerChanges.h"
 #include "FreeAgent.h"
 #include "ContractedPlayer.h"
+#include "RosterTransaction.h"
 #include "IFileHandler.h"
+#include "Permissions.h"
 #include "Utils.h"
 
 namespace FootballManagement
@@ -17,19 +29,134 @@ namespace FootballManagement
      * @brief Менеджер складу клубу, бюджету та операцій над гравцями.
      * @details Зберігає колекцію гравців, підтримує CRUD-операції, пошук/фільтрацію/сортування,
      *          підписання вільного агента, серіалізацію для збереження у файл.
+     *          Спостерігає за гравцями складу: календарний індекс оновлюється
+     *          при зміні контракту, а кожна зміна потрапляє у стрічку змін.
      */
-    class ClubManager : public IFileHandler
+    class ClubManager : public IFileHandler, public IPlayerObserver
     {
     private:
         std::vector<std::shared_ptr<Player>> players_; ///< Склад клубу.
         double transferBudget_; ///< Трансферний/зарплатний бюджет (€).
         std::string clubName_; ///< Назва клубу.
+        std::unordered_map<int, std::shared_ptr<Player>> playersById_;
+        ///< Індекс складу за ID гравця.
+        int maxPlayerId_; ///< Найбільший виданий/завантажений ID.
+        std::vector<TransactionRecord> journal_; ///< Журнал пакетних транзакцій.
+        PermissionSet actorPermissions_; ///< Права того, хто зараз керує складом.
+
+        /// @brief Календарний індекс: дата (YYYY-MM-DD) → контрактний гравець.
+        using DateIndex = std::multimap<std::string,
+                                        std::shared_ptr<ContractedPlayer>>;
+
+        /**
+         * @brief Позиції одного контрактного гравця у календарних індексах.
+         * @details Ітератори multimap стабільні до видалення, тож переіндексація
+         *          гравця не потребує пошуку за датою.
+         */
+        struct CalendarEntry
+        {
+            std::shared_ptr<ContractedPlayer> player;
+            std::optional<DateIndex::iterator> contractIt;
+            std::optional<DateIndex::iterator> loanIt;
+        };
+
+        DateIndex contractExpiryIndex_; ///< Дата завершення контракту → гравець.
+        DateIndex loanEndIndex_; ///< Дата завершення оренди → гравець.
+        std::unordered_map<int, CalendarEntry> contractedById_;
+        ///< ID → записи в календарних індексах.
+
+        std::deque<PlayerChange> changeLog_; ///< Останні події стрічки змін.
+        std::uint64_t nextChangeSequence_; ///< Номер наступної події.
+        std::vector<std::pair<int, std::function<void(const PlayerChange&)>>>
+        changeSubscribers_; ///< Підписники стрічки змін (ID → обробник).
+        int nextSubscriberId_; ///< ID наступного підписника.
+        std::unordered_set<int> dirtyPlayerIds_;
+        ///< Гравці зі змінами після останнього ClearDirtyPlayers().
+
+        /**
+         * @brief Ще не розібраний запис гравця (режим IndexAllPlayers()).
+         * @details Усі поля вказують у lazySource_.
+         */
+        struct LazyRecord
+        {
+            std::string_view text; ///< Повний рядок запису.
+            std::string_view name; ///< Ім'я (пошук без розбору).
+            std::string_view role; ///< Мітка типу ("role").
+        };
+
+        std::string lazySource_; ///< Вміст файлу складу (для LazyRecord).
+        std::vector<int> lazyOrder_;
+        ///< ID завантажених гравців у порядку файлу (поки є відкладені).
+        std::unordered_map<int, LazyRecord> lazyRecords_;
+        ///< Відкладені записи: розбираються при першому зверненні.
+        std::vector<std::string> unreadableRecords_;
+        ///< Рядки файлу, які не вдалося прочитати (невідомий role, повтор ID,
+        ///< помилка розбору); Serialize() записує їх без змін.
+        mutable std::atomic<bool> materializing_{false};
+        ///< Іде розбір відкладеного запису (виявлення доступу з двох потоків).
 
         /**
          * @brief Згенерувати унікальний ID для нового гравця.
          */
         int GenerateUniqueId() const;
 
+        /// @brief Перевірити право виконавця; за відмови — повідомлення у консоль.
+        [[nodiscard]] bool Permits(Permission permission) const;
+
+        /// @brief Додати гравця у склад та індекси без повідомлень у консоль.
+        void InsertPlayer(const std::shared_ptr<Player>& p);
+
+        /// @brief Перестати спостерігати за гравцем (якщо спостерігач — цей клуб).
+        void DetachPlayer(Player& p);
+
+        /// @brief Чи належить гравець складу іншого клубу.
+        [[nodiscard]] bool IsOwnedElsewhere(const Player& p) const;
+
+        /// @brief Додати подію у стрічку змін і сповістити підписників.
+        void PublishChange(PlayerChangeKind kind, int playerId,
+                           std::uint64_t version, PlayerFieldMask fields);
+
+        /// @brief Від'єднати всіх гравців і очистити склад та індекси.
+        void ClearRoster();
+
+        /// @brief Застосувати шапку файлу "clubName,budget".
+        void ApplyHeader(const std::string& line);
+
+        /**
+         * @brief Розібрати відкладений запис і додати гравця в індекси.
+         * @details Розбір не змінює логічного стану складу, тому доступний
+         *          з const-методів (FindPlayerById, SearchByName тощо).
+         * @return Гравець або nullptr, якщо запису немає чи він пошкоджений.
+         */
+        std::shared_ptr<Player> MaterializeRecord(int playerId) const;
+
+        /// @brief Розібрати всі відкладені записи й відновити порядок складу.
+        void LoadPendingRecords() const;
+
+        /// @brief Гарантувати, що відкладених записів немає.
+        void EnsureLoaded() const
+        {
+            if (!lazyOrder_.empty()) LoadPendingRecords();
+        }
+
+        /// @brief Оновити індекси за ID після зміни ID гравця з @p oldId.
+        void ReindexPlayerId(Player& p, int oldId);
+
+        /// @brief Додати (або оновити) контрактного гравця в календарних індексах.
+        void IndexContract(const std::shared_ptr<ContractedPlayer>& p);
+
+        /// @brief Прибрати гравця з календарних індексів (якщо він там є).
+        void UnindexContract(int playerId);
+
+        /// @brief Знайти контрактного гравця за ID через індекс (або nullptr).
+        [[nodiscard]] std::shared_ptr<ContractedPlayer>
+        FindContracted(int playerId) const;
+
+        /// @brief Зібрати гравців з індексу в діапазоні дат [from; to].
+        [[nodiscard]] static std::vector<std::shared_ptr<ContractedPlayer>>
+        CollectRange(const DateIndex& index, const std::string& from,
+                     const std::string& to);
+
     public:
         /**
          * @brief Конструктор.
@@ -39,17 +166,40 @@ namespace FootballManagement
         explicit ClubManager(const std::string& name = "Default Club",
                              double budget = 10'000'000.0);
 
-        /// @brief Віртуальний деструктор.
-        ~ClubManager() noexcept override = default;
+        /// @brief Гравці спостерігають за клубом через вказівник — без копій.
+        ClubManager(const ClubManager&) = delete;
+        ClubManager& operator=(const ClubManager&) = delete;
+
+        /// @brief Деструктор: від'єднує спостерігача від гравців складу.
+        ~ClubManager() noexcept override;
+
+        /// @brief Максимальна кількість подій, що зберігаються у стрічці змін.
+        static constexpr std::size_t CHANGE_LOG_CAPACITY = 4096;
 
     public:
         [[nodiscard]] double GetTransferBudget() const;
         void SetTransferBudget(double budget);
         [[nodiscard]] std::string GetClubName() const;
 
+        /**
+         * @brief Встановити права виконавця операцій над складом.
+         * @details За замовчуванням ALL_PERMISSIONS (пакетні інструменти,
+         *          сервер, бенчмарки). Меню передає права увійшлого
+         *          користувача: зміни складу вимагають EditPlayers,
+         *          підписання й транзакції — SignAgents.
+         */
+        void SetActorPermissions(PermissionSet permissions);
+        [[nodiscard]] PermissionSet GetActorPermissions() const;
+
     public:
         /**
-         * @brief Додати гравця у склад (ID буде проставлено автоматично, якщо 0).
+         * @brief Додати гравця у склад (ID буде проставлено автоматично, якщо
+         *        0 або вже зайнятий іншим гравцем складу).
+         * @details Гравець належить не більш ніж одному складу (клуб —
+         *          його єдиний спостерігач). Щоб перевести гравця, спершу
+         *          приберіть його зі складу попереднього клубу.
+         * @throws std::invalid_argument якщо гравець порожній або вже у
+         *         складі іншого клубу.
          */
         void AddPlayer(std::shared_ptr<Player> p);
 
@@ -63,6 +213,13 @@ namespace FootballManagement
          */
         void RemovePlayers(int playerId);
 
+        /**
+         * @brief Видалити кількох гравців за один прохід складу.
+         * @param playerIds ID гравців (відсутні у складі ігноруються).
+         * @return Кількість фактично видалених гравців.
+         */
+        std::size_t RemovePlayers(const std::unordered_set<int>& playerIds);
+
         /**
          * @brief Відсортувати за рейтингом ефективності (спадно).
          */
@@ -85,12 +242,148 @@ namespace FootballManagement
          * @param player Вказівник на FreeAgent.
          * @param salaryOffer Запропонована річна зарплата (€).
          * @param contractUntil Дата завершення контракту (YYYY-MM-DD) — зберігається у гравця/логах.
-         * @return true, якщо підписання успішне.
+         * @return true, якщо підписання успішне (false, зокрема, якщо гравець
+         *         у складі іншого клубу).
          */
         bool SignFreeAgent(std::shared_ptr<FreeAgent> player,
                            double salaryOffer,
                            const std::string& contractUntil);
 
+        /**
+         * @brief Знайти гравця складу за ID (O(1) через індекс).
+         * @return Вказівник на гравця або nullptr.
+         */
+        [[nodiscard]] std::shared_ptr<Player> FindPlayerById(int playerId) const;
+
+    public:
+        /**
+         * @brief Застосувати пакет операцій за принципом «усе або нічого».
+         * @details Спершу весь пакет перевіряється проти бюджетного реєстру
+         *          без зміни стану (по одному пошуку в індексі на гравця);
+         *          якщо хоч одна операція некоректна або бюджет стає від’ємним,
+         *          нічого не змінюється. Інакше операції застосовуються по черзі,
+         *          а бюджет оновлюється один раз.
+         * @param batch Операції у порядку застосування.
+         * @return Запис журналу (також додається до GetJournal()).
+         */
+        TransactionRecord ApplyTransaction(
+            const std::vector<RosterOperation>& batch);
+
+        /// @brief Журнал усіх пакетних транзакцій (по одному запису на пакет).
+        [[nodiscard]] const std::vector<TransactionRecord>& GetJournal() const;
+
+    public:
+        /// @name Операції з контрактами (оновлюють календарний індекс)
+        /// @{
+
+        /**
+         * @brief Продовжити контракт гравця (ContractedPlayer::ExtendedContract).
+         * @return true, якщо гравця знайдено і контракт продовжено.
+         */
+        bool ExtendPlayerContract(int playerId, const std::string& newDate,
+                                  double newSalary);
+
+        /**
+         * @brief Відправити гравця в оренду (ContractedPlayer::SendOnLoan).
+         * @return true, якщо гравця знайдено і дата оренди коректна.
+         */
+        bool SendPlayerOnLoan(int playerId, const std::string& otherClub,
+                              const std::string& endDate);
+
+        /**
+         * @brief Повернути гравця з оренди (ContractedPlayer::ReturnFromLoan).
+         * @return true, якщо гравця знайдено.
+         */
+        bool ReturnPlayerFromLoan(int playerId);
+
+        /**
+         * @brief Розірвати контракт (ContractedPlayer::TerminateContract).
+         * @details Гравець залишається у складі, але зникає з календаря.
+         * @return true, якщо гравця знайдено.
+         */
+        bool TerminatePlayerContract(int playerId, const std::string& reason);
+        /// @}
+
+        /// @name Календарні запити (O(log n + k))
+        /// @{
+
+        /**
+         * @brief Контракти, що завершуються в діапазоні дат (включно).
+         * @param from Початок діапазону (YYYY-MM-DD).
+         * @param to Кінець діапазону (YYYY-MM-DD).
+         * @return Гравці, впорядковані за датою завершення контракту.
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<ContractedPlayer>>
+        GetContractsExpiringBetween(const std::string& from,
+                                    const std::string& to) const;
+
+        /**
+         * @brief Контракти, що завершуються протягом найближчих @p months місяців.
+         * @details Аналог ContractDetails::IsExpiringSoon() без обходу складу.
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<ContractedPlayer>>
+        GetContractsExpiringSoon(int months = 6) const;
+
+        /**
+         * @brief Оренди, що завершуються в діапазоні дат (включно).
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<ContractedPlayer>>
+        GetLoansEndingBetween(const std::string& from,
+                              const std::string& to) const;
+
+        /**
+         * @brief Оренди, що завершуються у вказаному місяці.
+         * @param year Рік (напр., 2026).
+         * @param month Місяць 1..12.
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<ContractedPlayer>>
+        GetLoansEndingInMonth(int year, int month) const;
+        /// @}
+
+    public:
+        /// @name Стрічка змін
+        /// @{
+
+        /**
+         * @brief Реакція на зміну гравця складу (IPlayerObserver).
+         * @details Переіндексовує календар при зміні контракту, позначає
+         *          гравця як змінений і публікує подію Updated.
+         */
+        void OnPlayerChanged(Player& player, PlayerFieldMask fields) override;
+
+        /// @brief Переключити індекси за ID на новий ID (IPlayerObserver).
+        void OnPlayerIdChanged(Player& player, int oldId) override;
+
+        /**
+         * @brief Підписатися на події Added / Updated / Removed.
+         * @param handler Викликається синхронно після кожної зміни; не повинен
+         *        змінювати список підписок.
+         * @return ID підписки для UnsubscribeChanges().
+         */
+        int SubscribeChanges(std::function<void(const PlayerChange&)> handler);
+
+        /// @brief Скасувати підписку; false, якщо ID невідомий.
+        bool UnsubscribeChanges(int subscriptionId);
+
+        /// @brief Номер останньої опублікованої події (0 — подій не було).
+        [[nodiscard]] std::uint64_t GetLastChangeSequence() const;
+
+        /**
+         * @brief Події з номером, більшим за @p sequence.
+         * @return std::nullopt, якщо частину подій уже витіснено зі стрічки
+         *         (CHANGE_LOG_CAPACITY) — тоді потрібен повний перегляд складу.
+         */
+        [[nodiscard]] std::optional<std::vector<PlayerChange>>
+        GetChangesSince(std::uint64_t sequence) const;
+
+        /// @brief Гравці складу, змінені після останнього ClearDirtyPlayers().
+        [[nodiscard]] std::vector<std::shared_ptr<Player>>
+        GetDirtyPlayers() const;
+
+        /// @brief Скинути маски змін усіх змінених гравців (після збереження).
+        void ClearDirtyPlayers();
+        /// @}
+
     public:
         /**
          * @brief Серіалізація у текст: перший рядок — "clubName,budget",
@@ -111,8 +404,62 @@ namespace FootballManagement
          */
         void DeserializeAllPlayers(const std::vector<std::string>& lines);
 
+        /**
+         * @brief Створити гравця за полем role рядка і розібрати рядок.
+         * @return Гравець або nullptr, якщо тип невідомий.
+         */
+        [[nodiscard]] static std::shared_ptr<Player>
+        DecodeRecord(const std::string& row);
+
+        /**
+         * @brief Очистити склад перед завантаженням і застосувати шапку файлу.
+         * @param header Рядок "clubName,budget" (порожній — шапки немає).
+         */
+        void ResetFromHeader(const std::string& header);
+
+        /**
+         * @brief Додати гравця, прочитаного з файлу (без перевірки прав і
+         *        повідомлень — як у DeserializeAllPlayers()).
+         * @return false, якщо гравця з таким ID уже є.
+         */
+        bool AdoptLoadedPlayer(const std::shared_ptr<Player>& p);
+
+        /**
+         * @brief Відкладене завантаження: той самий формат, що й у
+         *        DeserializeAllPlayers(), але весь файл одним рядком.
+         * @details Один прохід будує індекс зсувів і зчитує лише id, name і
+         *          role. Повний запис розбирається при першому зверненні до
+         *          гравця (FindPlayerById, збіг у SearchByName); операції над
+         *          усім складом (GetAll, сортування, фільтр статусу, календар)
+         *          спершу розбирають решту. Serialize() переписує нерозібрані
+         *          записи без змін, тож збереження не потребує розбору.
+         *          Рядки, які не вдалося прочитати (зараз чи під час
+         *          пізнішого розбору), теж записуються назад без змін.
+         * @warning Поки є відкладені записи, склад — однопотоковий: навіть
+         *          const-методи розбирають записи й змінюють індекси. Перед
+         *          читанням з кількох потоків (ClubService) викличте
+         *          LoadPending(); одночасний розбір із двох потоків кидає
+         *          std::logic_error.
+         * @param content Вміст файлу (FileManager::LoadFileContent()).
+         */
+        void IndexAllPlayers(std::string content);
+
+        /// @brief Розібрати всі відкладені записи (див. IndexAllPlayers()).
+        void LoadPending() { EnsureLoaded(); }
+
+        /// @brief Кількість гравців складу (без розбору відкладених записів).
+        [[nodiscard]] std::size_t GetPlayerCount() const;
+
+        /// @brief Кількість ще не розібраних записів.
+        [[nodiscard]] std::size_t GetPendingCount() const;
+
+        /// @brief Кількість рядків, які не вдалося прочитати (зберігаються як є).
+        [[nodiscard]] std::size_t GetUnreadableCount() const;
+
+        /// @brief Усі гравці складу (відкладені записи розбираються).
         [[nodiscard]] const std::vector<std::shared_ptr<Player>>& GetAll() const
         {
+            EnsureLoaded();
             return players_;
         }
     };
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "AuthManager.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file ClubService.h
+     * @brief Обробка запитів серверного режиму над резидентним складом.
+     * @details Запит — рядок «команда|аргумент|...» (як у пакетних сценаріях):
+     *
+     *          ping
+     *          login|логін|пароль          — відповідь OK|токен|роль
+     *          auth|токен                  — прив'язати наявний токен до з'єднання
+     *          logout
+     *          search|підрядок імені
+     *          filter|підрядок статусу
+     *          rating|N                   — N гравців із найвищим рейтингом
+     *          sign|ID|зарплата|YYYY-MM-DD — право sign_agents (бюджет у
+     *                                        відповіді — лише з view_finances)
+     *          save                        — право manage_users
+     *
+     *          Відповідь: перший рядок «OK» або «ERR|причина», далі по
+     *          рядку на гравця: «ID|ім'я|статус|вартість|рейтинг».
+     *          Читання виконуються паралельно (спільне блокування),
+     *          підписання та збереження — ексклюзивно. Пароль перевіряється
+     *          лише при login; привілейовані запити авторизуються пошуком
+     *          токена в кеші сесій AuthManager.
+     */
+
+    /**
+     * @struct ServiceSession
+     * @brief Стан одного клієнта (з'єднання).
+     */
+    struct ServiceSession
+    {
+        std::string token; ///< Токен сесії (порожній — анонім).
+    };
+
+    /**
+     * @class ClubService
+     * @brief Потокобезпечний обробник запитів до ClubManager та AuthManager.
+     */
+    class ClubService
+    {
+    private:
+        ClubManager& club_; ///< Резидентний склад.
+        AuthManager& auth_; ///< Користувачі та сесії.
+        FileManager fileManager_; ///< Куди зберігати склад.
+        mutable std::shared_mutex mutex_; ///< Читання — спільно, зміни — ексклюзивно.
+        mutable std::mutex saveMutex_; ///< Одночасно пише лише одне збереження.
+
+        std::string Login(const std::vector<std::string>& args,
+                          ServiceSession& session);
+        std::string Attach(const std::vector<std::string>& args,
+                           ServiceSession& session) const;
+
+        /// @brief Роль дійсної сесії або std::nullopt.
+        [[nodiscard]] std::optional<UserRole>
+        SessionRole(const ServiceSession& session) const;
+
+        /// @brief Чи має дійсна сесія право (false без сесії).
+        [[nodiscard]] bool SessionCan(const ServiceSession& session,
+                                      Permission permission) const;
+        std::string Search(const std::vector<std::string>& args) const;
+        std::string Filter(const std::vector<std::string>& args) const;
+        std::string TopRated(const std::vector<std::string>& args) const;
+        std::string Sign(const std::vector<std::string>& args,
+                         const ServiceSession& session);
+
+        /// @brief Відповідь «OK» зі списком гравців.
+        static std::string PlayerRows(
+            const std::vector<std::shared_ptr<Player>>& players);
+
+    public:
+        /**
+         * @brief Конструктор.
+         * @details Розбирає відкладені записи складу (ClubManager::LoadPending()),
+         *          бо запити читають його з кількох потоків.
+         * @param club Склад, що обслуговується.
+         * @param auth Менеджер користувачів.
+         * @param fileManager Каталог даних для збереження.
+         */
+        ClubService(ClubManager& club, AuthManager& auth,
+                    FileManager fileManager = FileManager());
+
+        /**
+         * @brief Обробити один запит.
+         * @param request Тіло запиту.
+         * @param session Сесія клієнта (оновлюється командою login).
+         * @return Тіло відповіді.
+         */
+        std::string Handle(const std::string& request, ServiceSession& session);
+
+        /**
+         * @brief Зберегти склад у PLAYERS_DATA_FILE.
+         * @details Знімок знімається під спільним блокуванням, а пишеться
+         *          через тимчасовий файл під saveMutex_.
+         */
+        bool Save() const;
+    };
+}
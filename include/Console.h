@@ -0,0 +1,39 @@
+#pragma once
+
+#include <ostream>
+
+namespace FootballManagement
+{
+    /**
+     * @file Console.h
+     * @brief Потік діагностичних повідомлень моделі з можливістю заглушення.
+     * @details Класи моделі пишуть повідомлення через Console(), а не напряму
+     *          у std::cout. Стан «заглушено» зберігається окремо для кожного
+     *          потоку, тож робочі потоки (симуляції, прогнози) не торкаються
+     *          спільного std::cout.
+     */
+
+    /**
+     * @brief Потік для повідомлень моделі.
+     * @return std::cout або «німий» потік поточного потоку, якщо діє
+     *         ScopedConsoleMute.
+     */
+    std::ostream& Console();
+
+    /**
+     * @class ScopedConsoleMute
+     * @brief RAII-заглушка повідомлень моделі у поточному потоці.
+     */
+    class ScopedConsoleMute
+    {
+    private:
+        bool previous_; ///< Стан до створення (для вкладених заглушок).
+
+    public:
+        ScopedConsoleMute();
+        ~ScopedConsoleMute();
+
+        ScopedConsoleMute(const ScopedConsoleMute&) = delete;
+        ScopedConsoleMute& operator=(const ScopedConsoleMute&) = delete;
+    };
+}
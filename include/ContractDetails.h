@@ -22,10 +22,10 @@ namespace FootballManagement
         bool isLoaned_;
         std::string loanEndDate_; ///< Формат: YYYY-MM-DD або порожньо
 
+    public:
         /// @brief Перевіряє формат дати YYYY-MM-DD.
-        static bool ValidateIsoDate(const std::string& s);
+        [[nodiscard]] static bool ValidateIsoDate(const std::string& s);
 
-    public:
         /// @brief Конструктор за замовчуванням.
         ContractDetails();
 
@@ -52,13 +52,13 @@ namespace FootballManagement
         /// @brief Деструктор за замовчуванням.
         ~ContractDetails() = default;
 
-        [[nodiscard]] std::string GetClubName() const;
+        [[nodiscard]] const std::string& GetClubName() const;
         [[nodiscard]] double GetSalary() const;
-        [[nodiscard]] std::string GetContractUntil() const;
+        [[nodiscard]] const std::string& GetContractUntil() const;
         [[nodiscard]] bool IsPlayerOnLoan() const;
         [[nodiscard]] bool IsContractValid() const;
         [[nodiscard]] bool IsExpiringSoon() const; // ≤ 6 міс від сьогодні
-        [[nodiscard]] std::string GetLoanEndDate() const;
+        [[nodiscard]] const std::string& GetLoanEndDate() const;
 
         void SetClubName(const std::string& clubName);
         void SetSalary(double salary);
@@ -120,16 +120,16 @@ namespace FootballManagement
         [[nodiscard]] double GetTransferFee() const;
 
         /**
-         * @brief Отримати копію деталей контракту.
-         * @return Об’єкт @ref ContractDetails з поточними параметрами контракту.
+         * @brief Деталі контракту (без копіювання).
+         * @return Посилання на @ref ContractDetails, дійсне, доки існує гравець.
          */
-        [[nodiscard]] ContractDetails GetContractDetails() const;
+        [[nodiscard]] const ContractDetails& GetContractDetails() const;
 
         /**
          * @brief Отримати назву попереднього клубу.
          * @return Рядок із назвою клубу.
          */
-        [[nodiscard]] std::string GetPreviousClub() const
+        [[nodiscard]] const std::string& GetPreviousClub() const
         {
             return previousClub_;
         }
@@ -183,12 +183,46 @@ namespace FootballManagement
         void SendOnLoan(const std::string& otherClub,
                         const std::string& endDate);
 
+        /**
+         * @brief Встановити нову зарплату без зміни дати контракту.
+         * @param newSalary Нова річна зарплата (€), > 0.
+         * @throws std::invalid_argument якщо зарплата не додатна.
+         */
+        void ChangeSalary(double newSalary);
+
+        /**
+         * @brief Повернути гравця з оренди достроково або після її завершення.
+         * @post IsPlayerOnLoan() у деталях контракту == false.
+         */
+        void ReturnFromLoan();
+
+        /**
+         * @brief Чи було контракт розірвано (див. @ref TerminateContract).
+         * @return true, якщо гравець формально без клубу.
+         */
+        [[nodiscard]] bool IsContractTerminated() const;
+
         /**
          * @brief Встановити попередній клуб.
          * @param club Назва клубу.
          * @post Оновлює @ref previousClub_.
          */
-        void SetPreviousClub(const std::string& club) { previousClub_ = club; }
+        void SetPreviousClub(const std::string& club)
+        {
+            previousClub_ = club;
+            MarkDirty(PlayerField::Transfer);
+        }
+
+        /**
+         * @brief Встановити поточний клуб у деталях контракту.
+         * @param club Назва клубу (не порожня).
+         * @throws std::invalid_argument якщо назва порожня.
+         */
+        void SetClubName(const std::string& club)
+        {
+            contractDetails_.SetClubName(club);
+            MarkDirty(PlayerField::Contract);
+        }
 
         /**
          * @brief Відобразити усю інформацію про гравця у консоль.
@@ -219,7 +253,13 @@ namespace FootballManagement
          * @brief Отримати короткий статус гравця.
          * @return Рядок-статус (наприклад, "Контрактний", "У списку трансферу", "В оренді").
          */
-        [[nodiscard]] std::string GetStatus() const override;
+        [[nodiscard]] std::string_view GetStatus() const override;
+
+        /**
+         * @brief Створити глибоку копію гравця.
+         * @return Новий ContractedPlayer із тими самими даними.
+         */
+        [[nodiscard]] std::unique_ptr<Player> Clone() const override;
 
         /**
          * @brief Серіалізувати гравця у рядок (наприклад, CSV/TSV/JSON-рядок).
@@ -235,5 +275,11 @@ namespace FootballManagement
          * @warning Рекомендовано виконувати перевірку формату/значень перед викликом.
          */
         void Deserialize(const std::string& data) override;
+
+        /**
+         * @brief Схема полів класу (текстовий, бінарний і стовпчиковий кодеки).
+         * @details Спільна для всіх об'єктів, будується під час компіляції.
+         */
+        [[nodiscard]] static const FieldSchema<ContractedPlayer>& GetSchema();
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include "Player.h"
 #include "Utils.h"
@@ -97,8 +98,89 @@ namespace FootballManagement
         [[nodiscard]] virtual double CalculateValue() const override = 0;
         [[nodiscard]] virtual double
         CalculatePerformanceRating() const override = 0;
-        [[nodiscard]] virtual std::string GetStatus() const override = 0;
+        [[nodiscard]] virtual std::string_view
+        GetStatus() const override = 0;
+        [[nodiscard]] virtual std::unique_ptr<Player>
+        Clone() const override = 0;
         [[nodiscard]] virtual std::string Serialize() const override = 0;
         virtual void Deserialize(const std::string& data) override = 0;
+
+    protected:
+        /**
+         * @brief Дескриптори позиції та матчевої статистики для схеми @p T.
+         * @details Порядок ключів: position, totalGames, totalGoals,
+         *          totalAssists, totalShots, totalTackles, keyPasses.
+         */
+        template <typename T>
+        static constexpr std::array<Field<T>, 7> StatFields()
+        {
+            return {{
+                {
+                    "position", FieldType::Int,
+                    [](const T& p, FieldValue& v)
+                    {
+                        v.integer = static_cast<int>(p.position_);
+                    },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.position_ = static_cast<Position>(v.integer);
+                    }
+                },
+                {
+                    "totalGames", FieldType::Int,
+                    [](const T& p, FieldValue& v) { v.integer = p.totalGames_; },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.totalGames_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "totalGoals", FieldType::Int,
+                    [](const T& p, FieldValue& v) { v.integer = p.totalGoals_; },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.totalGoals_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "totalAssists", FieldType::Int,
+                    [](const T& p, FieldValue& v)
+                    {
+                        v.integer = p.totalAssists_;
+                    },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.totalAssists_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "totalShots", FieldType::Int,
+                    [](const T& p, FieldValue& v) { v.integer = p.totalShots_; },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.totalShots_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "totalTackles", FieldType::Int,
+                    [](const T& p, FieldValue& v)
+                    {
+                        v.integer = p.totalTackles_;
+                    },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.totalTackles_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "keyPasses", FieldType::Int,
+                    [](const T& p, FieldValue& v) { v.integer = p.keyPasses_; },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.keyPasses_ = static_cast<int>(v.integer);
+                    }
+                }
+            }};
+        }
     };
 }
@@ -0,0 +1,518 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @file FieldSchema.h
+     * @brief Опис полів класу під час компіляції та кодеки, згенеровані з нього.
+     * @details Клас описує свої поля масивом Field<T> (ключ, тип, функції
+     *          читання/запису — лямбди без захоплення всередині методів класу,
+     *          тож мають доступ до приватних членів). FieldSchema<T> будує з
+     *          масиву мінімальну досконалу хеш-таблицю ключів (constexpr) і дає:
+     *          - текстовий кодек (рядок players.txt) — розбір за один прохід,
+     *            ключ → поле через одну хеш-операцію й одне порівняння;
+     *          - бінарний кодек (поля в порядку схеми, без ключів);
+     *          - стовпчиковий кодек (окремий буфер на кожне поле для набору
+     *            об'єктів).
+     */
+
+    /**
+     * @enum FieldType
+     * @brief Тип поля та його текстове/бінарне подання.
+     */
+    enum class FieldType : std::uint8_t
+    {
+        Int, ///< Ціле число.
+        Number, ///< Дійсне число (найкоротше точне подання).
+        Money, ///< Сума в євро (два знаки після коми).
+        Bool, ///< true / false.
+        Text, ///< Рядок у лапках.
+        Tag ///< Стала мітка типу (лише запис, напр. "role").
+    };
+
+    /**
+     * @struct FieldValue
+     * @brief Проміжне значення одного поля під час кодування/декодування.
+     * @details text вказує або на член об'єкта, або у вхідний рядок, або на
+     *          owned (коли getter повертає копію).
+     */
+    struct FieldValue
+    {
+        std::int64_t integer = 0;
+        double number = 0.0;
+        bool flag = false;
+        std::string_view text;
+        std::string owned;
+    };
+
+    /**
+     * @struct Field
+     * @brief Дескриптор одного поля класу T.
+     */
+    template <typename T>
+    struct Field
+    {
+        std::string_view key; ///< Ключ у текстовому форматі.
+        FieldType type; ///< Тип значення.
+        void (*get)(const T&, FieldValue&); ///< Прочитати поле з об'єкта.
+        void (*set)(T&, const FieldValue&); ///< Записати поле (nullptr — лише запис).
+    };
+
+    /// @brief Об'єднати кілька масивів дескрипторів (базовий клас + власні поля).
+    template <typename T, std::size_t N, std::size_t... Rest>
+    constexpr auto ConcatFields(const std::array<Field<T>, N>& first,
+                                const std::array<Field<T>, Rest>&... rest)
+    {
+        std::array<Field<T>, (N + ... + Rest)> out{};
+        std::size_t i = 0;
+        for (const auto& f : first) out[i++] = f;
+        ((
+            [&]()
+            {
+                for (const auto& f : rest) out[i++] = f;
+            }()), ...);
+        return out;
+    }
+
+    namespace SchemaDetail
+    {
+        constexpr std::uint32_t Hash(std::string_view key, std::uint32_t seed)
+        {
+            std::uint32_t h = 2166136261u ^ seed;
+            for (const char c : key)
+            {
+                h ^= static_cast<unsigned char>(c);
+                h *= 16777619u;
+            }
+            return h ^ (h >> 15);
+        }
+
+        inline void PutVarint(std::string& out, std::uint64_t v)
+        {
+            while (v >= 0x80)
+            {
+                out.push_back(static_cast<char>((v & 0x7F) | 0x80));
+                v >>= 7;
+            }
+            out.push_back(static_cast<char>(v));
+        }
+
+        inline std::uint64_t GetVarint(std::string_view& in)
+        {
+            std::uint64_t v = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                if (in.empty())
+                    throw std::runtime_error("Обрізані бінарні дані.");
+                const auto b = static_cast<unsigned char>(in.front());
+                in.remove_prefix(1);
+                v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+                if ((b & 0x80) == 0) return v;
+            }
+            throw std::runtime_error("Некоректне varint-значення.");
+        }
+
+        inline bool IsValueEnd(char c)
+        {
+            return c == ',' || c == '}' || c == '"' || c == ' ';
+        }
+
+        /**
+         * Наступна пара "ключ":значення текстового запису, починаючи з @p pos.
+         * Лапки текстового значення відкидаються; false — пар більше немає.
+         */
+        inline bool NextPair(std::string_view data, std::size_t& pos,
+                             std::string_view& key, std::string_view& token)
+        {
+            while (true)
+            {
+                const std::size_t keyStart = data.find('"', pos);
+                if (keyStart == std::string_view::npos) return false;
+                const std::size_t keyEnd = data.find('"', keyStart + 1);
+                if (keyEnd == std::string_view::npos) return false;
+                key = data.substr(keyStart + 1, keyEnd - keyStart - 1);
+
+                pos = keyEnd + 1;
+                while (pos < data.size() && data[pos] == ' ') ++pos;
+                if (pos >= data.size() || data[pos] != ':') continue;
+                ++pos;
+                while (pos < data.size() && data[pos] == ' ') ++pos;
+
+                if (pos < data.size() && data[pos] == '"')
+                {
+                    const std::size_t end = data.find('"', pos + 1);
+                    if (end == std::string_view::npos) return false;
+                    token = data.substr(pos + 1, end - pos - 1);
+                    pos = end + 1;
+                }
+                else
+                {
+                    const std::size_t start = pos;
+                    while (pos < data.size() && !IsValueEnd(data[pos])) ++pos;
+                    token = data.substr(start, pos - start);
+                }
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Значення одного ключа текстового запису без розбору решти полів.
+     * @details Для індексів, яким потрібні лише кілька полів (id, name, role).
+     * @return Значення (без лапок) або порожній string_view, якщо ключа немає.
+     */
+    inline std::string_view FindTextValue(std::string_view data,
+                                          std::string_view key)
+    {
+        std::size_t pos = 0;
+        std::string_view k;
+        std::string_view token;
+        while (SchemaDetail::NextPair(data, pos, k, token))
+            if (k == key) return token;
+        return {};
+    }
+
+    /**
+     * @class FieldSchema
+     * @brief Схема класу T: дескриптори полів і кодеки.
+     */
+    template <typename T>
+    class FieldSchema
+    {
+    public:
+        static constexpr std::size_t SLOT_COUNT = 128; ///< Розмір хеш-таблиці.
+
+    private:
+        static constexpr std::uint8_t EMPTY_SLOT = 0xFF;
+
+        const Field<T>* fields_; ///< Дескриптори (статичний constexpr-масив).
+        std::size_t count_; ///< Кількість полів.
+        std::array<std::uint8_t, SLOT_COUNT> slots_; ///< Слот → номер поля.
+        std::uint32_t seed_; ///< Зерно, за якого ключі не колізують.
+
+        [[nodiscard]] constexpr std::size_t SlotOf(std::string_view key,
+                                                   std::uint32_t seed) const
+        {
+            return SchemaDetail::Hash(key, seed) % SLOT_COUNT;
+        }
+
+        /// Спробувати розмістити всі ключі без колізій із зерном @p seed.
+        constexpr bool TryBuild(std::uint32_t seed)
+        {
+            for (auto& s : slots_) s = EMPTY_SLOT;
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                auto& slot = slots_[SlotOf(fields_[i].key, seed)];
+                if (slot != EMPTY_SLOT) return false;
+                slot = static_cast<std::uint8_t>(i);
+            }
+            seed_ = seed;
+            return true;
+        }
+
+        static void AppendText(std::string& out, const Field<T>& f,
+                               const FieldValue& v)
+        {
+            char buf[64];
+            std::to_chars_result r{buf, std::errc()};
+            switch (f.type)
+            {
+            case FieldType::Int:
+                r = std::to_chars(buf, buf + sizeof(buf), v.integer);
+                out.append(buf, r.ptr);
+                break;
+            case FieldType::Number:
+                r = std::to_chars(buf, buf + sizeof(buf), v.number);
+                out.append(buf, r.ptr);
+                break;
+            case FieldType::Money:
+                r = std::to_chars(buf, buf + sizeof(buf), v.number,
+                                  std::chars_format::fixed, 2);
+                out.append(buf, r.ptr);
+                break;
+            case FieldType::Bool:
+                out += v.flag ? "true" : "false";
+                break;
+            case FieldType::Text:
+            case FieldType::Tag:
+                out += '"';
+                out += v.text;
+                out += '"';
+                break;
+            }
+        }
+
+        static void ParseText(const Field<T>& f, std::string_view token,
+                              FieldValue& v)
+        {
+            const char* begin = token.data();
+            const char* end = begin + token.size();
+            switch (f.type)
+            {
+            case FieldType::Int:
+                if (std::from_chars(begin, end, v.integer).ptr == begin)
+                    throw std::invalid_argument(
+                        "Некоректне ціле значення поля " + std::string(f.key));
+                break;
+            case FieldType::Number:
+            case FieldType::Money:
+                if (std::from_chars(begin, end, v.number).ptr == begin)
+                    throw std::invalid_argument(
+                        "Некоректне число в полі " + std::string(f.key));
+                break;
+            case FieldType::Bool:
+                v.flag = token == "true";
+                break;
+            case FieldType::Text:
+            case FieldType::Tag:
+                v.text = token;
+                break;
+            }
+        }
+
+        static void AppendBinary(std::string& out, const Field<T>& f,
+                                 const FieldValue& v)
+        {
+            switch (f.type)
+            {
+            case FieldType::Int:
+                // zigzag: малі від'ємні числа теж займають один байт
+                SchemaDetail::PutVarint(
+                    out, (static_cast<std::uint64_t>(v.integer) << 1) ^
+                    static_cast<std::uint64_t>(v.integer >> 63));
+                break;
+            case FieldType::Number:
+            case FieldType::Money:
+                {
+                    std::uint64_t bits;
+                    std::memcpy(&bits, &v.number, sizeof(bits));
+                    for (int i = 0; i < 8; ++i)
+                        out.push_back(static_cast<char>(bits >> (8 * i)));
+                    break;
+                }
+            case FieldType::Bool:
+                out.push_back(v.flag ? 1 : 0);
+                break;
+            case FieldType::Text:
+                SchemaDetail::PutVarint(out, v.text.size());
+                out += v.text;
+                break;
+            case FieldType::Tag:
+                break;
+            }
+        }
+
+        static void ReadBinary(std::string_view& in, const Field<T>& f,
+                               FieldValue& v)
+        {
+            switch (f.type)
+            {
+            case FieldType::Int:
+                {
+                    const std::uint64_t z = SchemaDetail::GetVarint(in);
+                    v.integer = static_cast<std::int64_t>(z >> 1) ^
+                        -static_cast<std::int64_t>(z & 1);
+                    break;
+                }
+            case FieldType::Number:
+            case FieldType::Money:
+                {
+                    if (in.size() < 8)
+                        throw std::runtime_error("Обрізані бінарні дані.");
+                    std::uint64_t bits = 0;
+                    for (int i = 7; i >= 0; --i)
+                        bits = (bits << 8) | static_cast<unsigned char>(in[i]);
+                    std::memcpy(&v.number, &bits, sizeof(bits));
+                    in.remove_prefix(8);
+                    break;
+                }
+            case FieldType::Bool:
+                if (in.empty())
+                    throw std::runtime_error("Обрізані бінарні дані.");
+                v.flag = in.front() != 0;
+                in.remove_prefix(1);
+                break;
+            case FieldType::Text:
+                {
+                    const std::uint64_t len = SchemaDetail::GetVarint(in);
+                    if (len > in.size())
+                        throw std::runtime_error("Обрізані бінарні дані.");
+                    v.text = in.substr(0, static_cast<std::size_t>(len));
+                    in.remove_prefix(static_cast<std::size_t>(len));
+                    break;
+                }
+            case FieldType::Tag:
+                break;
+            }
+        }
+
+    public:
+        /**
+         * @brief Побудувати схему та досконалий хеш ключів.
+         * @param fields Статичний масив дескрипторів (живе довше за схему).
+         * @param count Кількість дескрипторів (< SLOT_COUNT).
+         */
+        constexpr FieldSchema(const Field<T>* fields, std::size_t count)
+            : fields_(fields),
+              count_(count),
+              slots_{},
+              seed_(0)
+        {
+            if (count_ >= SLOT_COUNT)
+                throw std::length_error("Забагато полів для схеми.");
+            for (std::uint32_t seed = 0; seed < 65536; ++seed)
+                if (TryBuild(seed)) return;
+            throw std::logic_error("Не знайдено досконалого хешу ключів.");
+        }
+
+        /// @brief Кількість полів.
+        [[nodiscard]] constexpr std::size_t Size() const { return count_; }
+
+        /// @brief Дескриптор поля @p index.
+        [[nodiscard]] constexpr const Field<T>& At(std::size_t index) const
+        {
+            return fields_[index];
+        }
+
+        /**
+         * @brief Номер поля за ключем: одне хешування й одне порівняння.
+         * @return Номер поля або -1.
+         */
+        [[nodiscard]] constexpr int Find(std::string_view key) const
+        {
+            const std::uint8_t slot = slots_[SlotOf(key, seed_)];
+            if (slot == EMPTY_SLOT || fields_[slot].key != key) return -1;
+            return slot;
+        }
+
+        // ---------------- текст ----------------
+
+        /// @brief Рядок виду {"ключ":значення,...} у порядку схеми.
+        [[nodiscard]] std::string EncodeText(const T& object) const
+        {
+            std::string out;
+            out.reserve(32 * count_);
+            out += '{';
+            FieldValue v;
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                const Field<T>& f = fields_[i];
+                if (i > 0) out += ',';
+                out += '"';
+                out += f.key;
+                out += "\":";
+                f.get(object, v);
+                AppendText(out, f, v);
+            }
+            out += '}';
+            return out;
+        }
+
+        /**
+         * @brief Розібрати текстовий запис за один прохід.
+         * @details Невідомі ключі та мітки пропускаються; зайві/відсутні коми
+         *          між парами допускаються (сумісність зі старими файлами).
+         * @throws std::invalid_argument якщо числове поле некоректне або
+         *         сеттер класу відхилив значення.
+         */
+        void DecodeText(T& object, std::string_view data) const
+        {
+            FieldValue v;
+            std::size_t pos = 0;
+            std::string_view key;
+            std::string_view token;
+            while (SchemaDetail::NextPair(data, pos, key, token))
+            {
+                const int index = Find(key);
+                if (index < 0) continue;
+                const Field<T>& f = fields_[index];
+                if (!f.set) continue;
+                ParseText(f, token, v);
+                f.set(object, v);
+            }
+        }
+
+        // ---------------- бінарний ----------------
+
+        /// @brief Дописати поля об'єкта у бінарному вигляді (без ключів).
+        void EncodeBinary(const T& object, std::string& out) const
+        {
+            FieldValue v;
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                fields_[i].get(object, v);
+                AppendBinary(out, fields_[i], v);
+            }
+        }
+
+        /**
+         * @brief Прочитати об'єкт із бінарних даних; @p in зсувається за запис.
+         * @throws std::runtime_error якщо дані обрізані.
+         */
+        void DecodeBinary(T& object, std::string_view& in) const
+        {
+            FieldValue v;
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                ReadBinary(in, fields_[i], v);
+                if (fields_[i].set && fields_[i].type != FieldType::Tag)
+                    fields_[i].set(object, v);
+            }
+        }
+
+        // ---------------- стовпчики ----------------
+
+        /**
+         * @brief Закодувати набір об'єктів по стовпчиках.
+         * @return Буфер на кожне поле схеми (мітки — порожні).
+         */
+        [[nodiscard]] std::vector<std::string>
+        EncodeColumns(const std::vector<const T*>& objects) const
+        {
+            std::vector<std::string> columns(count_);
+            FieldValue v;
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                for (const T* object : objects)
+                {
+                    fields_[i].get(*object, v);
+                    AppendBinary(columns[i], fields_[i], v);
+                }
+            }
+            return columns;
+        }
+
+        /**
+         * @brief Заповнити об'єкти зі стовпчиків EncodeColumns().
+         * @throws std::runtime_error якщо стовпчиків замало або вони обрізані.
+         */
+        void DecodeColumns(const std::vector<std::string>& columns,
+                           const std::vector<T*>& objects) const
+        {
+            if (columns.size() != count_)
+                throw std::runtime_error("Кількість стовпчиків не збігається.");
+
+            FieldValue v;
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                std::string_view in = columns[i];
+                for (T* object : objects)
+                {
+                    ReadBinary(in, fields_[i], v);
+                    if (fields_[i].set && fields_[i].type != FieldType::Tag)
+                        fields_[i].set(*object, v);
+                }
+            }
+        }
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 // using
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,17 @@
 
 namespace FootballManagement
 {
+    /**
+     * @struct FileSaveRequest
+     * @brief Один файл пакетного збереження FileManager::SaveBatch().
+     */
+    struct FileSaveRequest
+    {
+        std::string fileName; ///< Ім'я файлу в каталозі даних.
+        const IFileHandler* object = nullptr; ///< Що серіалізувати.
+        bool atomic = false; ///< Писати у fileName.tmp і підміняти після fsync.
+    };
+
     /**
      * @file FileManager.h
      * @brief Клас для роботи з файлами: збереження, читання, перевірка існування,
@@ -22,6 +34,13 @@ namespace FootballManagement
 
     public:
         FileManager() = default;
+
+        /**
+         * @brief Конструктор з власним каталогом даних.
+         * @param directoryPath Каталог (наприклад, тимчасовий для бенчмарків).
+         */
+        explicit FileManager(std::string directoryPath);
+
         ~FileManager() = default;
 
         /**
@@ -54,6 +73,24 @@ namespace FootballManagement
         bool SaveToFile(const std::string& fileName,
                         const IFileHandler& serializableObject) const;
 
+        /**
+         * @brief Дописує один рядок у кінець файлу (створює файл за потреби).
+         * @param fileName Ім'я файлу.
+         * @param line Рядок без символу нового рядка.
+         * @return true, якщо запис успішний.
+         */
+        bool AppendLine(const std::string& fileName,
+                        const std::string& line) const;
+
+        /**
+         * @brief Атомарно замінює файл іншим (перейменування в межах каталогу).
+         * @param sourceName Ім'я щойно записаного тимчасового файлу.
+         * @param targetName Ім'я файлу, який буде замінено.
+         * @return true, якщо заміна успішна.
+         */
+        bool ReplaceFile(const std::string& sourceName,
+                         const std::string& targetName) const;
+
         /**
          * @brief Зчитує всі непорожні рядки з файлу.
          * @param fileName Ім'я файлу.
@@ -62,6 +99,63 @@ namespace FootballManagement
         [[nodiscard]] std::vector<std::string>
         LoadFromFile(const std::string& fileName) const;
 
+        /**
+         * @brief Зчитує файл цілком одним блоком (без розбиття на рядки).
+         * @details Для відкладеного розбору (ClubManager::IndexAllPlayers):
+         *          один буфер замість окремого рядка на кожен запис.
+         * @param fileName Ім'я файлу.
+         * @return Вміст файлу або порожній рядок, якщо файл відсутній.
+         */
+        [[nodiscard]] std::string
+        LoadFileContent(const std::string& fileName) const;
+
+        /**
+         * @brief Зберігає кілька файлів одночасно з fsync кожного.
+         * @details Об'єкти серіалізуються в поточному потоці, після чого всі
+         *          записи та fsync подаються одним пакетом у
+         *          AsyncFileEngine::GetDefault() і перекриваються в часі.
+         *          Файли з atomic пишуться у тимчасовий файл і підміняють
+         *          ціль лише після успішного fsync.
+         * @param requests Файли для збереження.
+         * @return true, якщо всі файли збережено.
+         */
+        bool SaveBatch(const std::vector<FileSaveRequest>& requests) const;
+
+        /**
+         * @brief Зчитує кілька файлів цілком одним пакетом.
+         * @param fileNames Імена файлів.
+         * @return Вміст кожного файлу (порожній рядок — файл відсутній або
+         *         не прочитаний) у тому ж порядку.
+         */
+        [[nodiscard]] std::vector<std::string>
+        LoadFileContents(const std::vector<std::string>& fileNames) const;
+
+        /**
+         * @brief Зберігає серіалізований об'єкт у блочно-стиснений архів
+         *        (кожен рядок — окремий запис, див. RosterArchive).
+         * @param fileName Ім'я файлу.
+         * @param serializableObject Об'єкт, що реалізує IFileHandler.
+         * @return true, якщо збереження успішне.
+         */
+        bool SaveCompressed(const std::string& fileName,
+                            const IFileHandler& serializableObject) const;
+
+        /**
+         * @brief Зчитує всі непорожні записи з архіву SaveCompressed().
+         * @return Вектор рядків (порожній, якщо файлу немає або він пошкоджений).
+         */
+        [[nodiscard]] std::vector<std::string>
+        LoadCompressed(const std::string& fileName) const;
+
+        /**
+         * @brief Зчитує запис одного гравця з архіву без розпакування решти.
+         * @param fileName Ім'я файлу.
+         * @param playerId ID гравця.
+         * @return Рядок гравця або std::nullopt.
+         */
+        [[nodiscard]] std::optional<std::string>
+        LoadCompressedRecord(const std::string& fileName, int playerId) const;
+
         /**
          * @brief Виводить вміст файлу у консоль (для налагодження/демо).
          * @param fileName Ім'я файлу.
@@ -60,7 +60,7 @@ namespace FootballManagement
         ~FreeAgent() noexcept override;
 
         [[nodiscard]] double GetExpectedSalary() const;
-        [[nodiscard]] std::string GetLastClub() const;
+        [[nodiscard]] const std::string& GetLastClub() const;
         [[nodiscard]] bool IsAvailableForNegotiation() const;
         [[nodiscard]] int GetMonthWithoutClub() const;
 
@@ -102,11 +102,15 @@ namespace FootballManagement
         void ShowInfo() const override;
         void CelebrateBirthday() override;
         [[nodiscard]] double CalculateValue() const override;
-        [[nodiscard]] std::string GetStatus() const override;
+        [[nodiscard]] std::string_view GetStatus() const override;
         [[nodiscard]] double CalculatePerformanceRating() const override;
+        [[nodiscard]] std::unique_ptr<Player> Clone() const override;
 
 
         [[nodiscard]] std::string Serialize() const override;
         void Deserialize(const std::string& data) override;
+
+        /// @brief Схема полів класу (див. FieldSchema).
+        [[nodiscard]] static const FieldSchema<FreeAgent>& GetSchema();
     };
 }
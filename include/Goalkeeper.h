@@ -92,9 +92,15 @@ namespace FootballManagement
         [[nodiscard]] double CalculatePerformanceRating() const override;
 
         /// @brief Текстовий статус (активний/травмований).
-        [[nodiscard]] std::string GetStatus() const override;
+        [[nodiscard]] std::string_view GetStatus() const override;
+
+        /// @brief Копія воротаря.
+        [[nodiscard]] std::unique_ptr<Player> Clone() const override;
 
         [[nodiscard]] std::string Serialize() const override;
         void Deserialize(const std::string& data) override;
+
+        /// @brief Схема полів класу (див. FieldSchema).
+        [[nodiscard]] static const FieldSchema<Goalkeeper>& GetSchema();
     };
 }
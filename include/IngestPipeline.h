@@ -0,0 +1,180 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ClubManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file IngestPipeline.h
+     * @brief Поетапне завантаження складу з файлу.
+     * @details Замість одного циклу «прочитати все → розібрати → додати»
+     *          файл проходить етапи
+     *          @code
+     *          read → split → parse (×N) → validate → insert
+     *          @endcode
+     *          кожен у своєму потоці (insert — у потоці, що викликав Run()).
+     *          Між етапами — черги BoundedQueue обмеженої місткості: швидкий
+     *          етап чекає на повільний (backpressure), тож у пам'яті
+     *          одночасно лише кілька пакетів, а читання файлу перекривається
+     *          з розбором. Рядки передаються пакетами по batchLines, щоб
+     *          синхронізація черги не коштувала більше за сам розбір.
+     *          Пакети нумеруються; validate відновлює порядок після
+     *          паралельного parse, тож склад має той самий порядок, що й файл.
+     */
+
+    /**
+     * @class BoundedQueue
+     * @brief Потокобезпечна черга обмеженої місткості.
+     * @details Push() блокує, поки черга повна; Pop() — поки порожня.
+     *          Після Close() Push() повертає false, а Pop() віддає решту
+     *          елементів і далі std::nullopt.
+     */
+    template <typename T>
+    class BoundedQueue
+    {
+    private:
+        std::size_t capacity_; ///< Найбільша кількість елементів.
+        std::deque<T> items_; ///< Елементи черги.
+        bool closed_ = false; ///< Нових елементів не буде.
+        std::mutex mutex_;
+        std::condition_variable notFull_;
+        std::condition_variable notEmpty_;
+
+    public:
+        explicit BoundedQueue(std::size_t capacity)
+            : capacity_(capacity == 0 ? 1 : capacity)
+        {
+        }
+
+        BoundedQueue(const BoundedQueue&) = delete;
+        BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+        /// @brief Додати елемент (чекає на місце); false — черга закрита.
+        bool Push(T item)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            notFull_.wait(lock, [this]()
+            {
+                return closed_ || items_.size() < capacity_;
+            });
+            if (closed_) return false;
+            items_.push_back(std::move(item));
+            lock.unlock();
+            notEmpty_.notify_one();
+            return true;
+        }
+
+        /// @brief Взяти елемент (чекає на нього); std::nullopt — черга вичерпана.
+        std::optional<T> Pop()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            notEmpty_.wait(lock, [this]() { return closed_ || !items_.empty(); });
+            if (items_.empty()) return std::nullopt;
+            T item = std::move(items_.front());
+            items_.pop_front();
+            lock.unlock();
+            notFull_.notify_one();
+            return item;
+        }
+
+        /// @brief Закрити чергу: споживачі доберуть решту й завершаться.
+        void Close()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                closed_ = true;
+            }
+            notFull_.notify_all();
+            notEmpty_.notify_all();
+        }
+    };
+
+    /**
+     * @struct IngestOptions
+     * @brief Параметри IngestPipeline.
+     */
+    struct IngestOptions
+    {
+        unsigned parseWorkers = 0; ///< Потоків parse; 0 — hardware_concurrency().
+        std::size_t queueCapacity = 8; ///< Пакетів у кожній черзі.
+        std::size_t batchLines = 512; ///< Рядків у пакеті.
+        std::size_t readChunk = 1u << 20; ///< Байтів за одне читання файлу.
+    };
+
+    /**
+     * @struct IngestStageStats
+     * @brief Підсумок одного етапу.
+     */
+    struct IngestStageStats
+    {
+        const char* name = ""; ///< Назва етапу.
+        std::uint64_t items = 0; ///< Оброблено: байтів (read) або рядків.
+        std::uint64_t busyNs = 0; ///< Час роботи (сума по потоках етапу).
+        std::uint64_t waitNs = 0; ///< Час очікування черг (вхід і backpressure).
+
+        /// @brief Пропускна здатність етапу (елементів за секунду роботи).
+        [[nodiscard]] double GetItemsPerSecond() const
+        {
+            return busyNs == 0 ? 0.0 : items * 1e9 / static_cast<double>(busyNs);
+        }
+    };
+
+    /**
+     * @struct IngestReport
+     * @brief Результат IngestPipeline::Run().
+     */
+    struct IngestReport
+    {
+        bool ok = false; ///< Файл прочитано повністю.
+        bool fileMissing = false; ///< Файлу немає (новий каталог даних).
+        std::size_t inserted = 0; ///< Додано гравців.
+        std::size_t skipped = 0; ///< Відкинуто рядків (тип, ID, повтор ID).
+        std::uint64_t totalNs = 0; ///< Тривалість усього завантаження.
+        std::vector<IngestStageStats> stages; ///< Етапи у порядку конвеєра.
+
+        /**
+         * @brief Чи втрачено частину складу: рядки відкинуто або файл не
+         *        дочитано. Збереження такого складу перезапише файл без них.
+         * @details Відсутній файл втратою не вважається — склад просто
+         *          порожній.
+         */
+        [[nodiscard]] bool IsLossy() const
+        {
+            return skipped > 0 || (!ok && !fileMissing);
+        }
+    };
+
+    /**
+     * @class IngestPipeline
+     * @brief Конвеєр завантаження файлу гравців у ClubManager.
+     */
+    class IngestPipeline
+    {
+    private:
+        IngestOptions options_; ///< Параметри конвеєра.
+
+    public:
+        explicit IngestPipeline(IngestOptions options = IngestOptions());
+
+        /**
+         * @brief Завантажити файл гравців (формат ClubManager::Serialize()).
+         * @details Склад @p club очищається, коли прочитано шапку файлу.
+         *          Повідомлення моделі в потоках етапів заглушено; підсумок
+         *          виводиться в потоці виклику.
+         * @param path Повний шлях до файлу.
+         * @param club Склад, що заповнюється (лише з потоку виклику).
+         * @return Підсумок із показниками етапів.
+         */
+        IngestReport Run(const std::string& path, ClubManager& club) const;
+    };
+}
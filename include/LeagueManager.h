@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ClubManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file LeagueManager.h
+     * @brief Ліга з багатьох клубів, розподілених між потоками-шардами.
+     * @details Кожен клуб належить рівно одному шарду (clubId % кількість
+     *          шардів), і лише потік цього шарду торкається клубу та його
+     *          гравців. Усе інше — повідомлення у поштову скриньку шарду:
+     *          запит до клубу, трансфер між клубами (запис гравця переходить
+     *          із шарду в шард разом із володінням), запити по всій лізі
+     *          (розсилаються всім шардам паралельно). Повідомлення моделі у
+     *          потоках шардів заглушено.
+     */
+
+    /**
+     * @struct LeaguePlayerSnapshot
+     * @brief Знімок гравця, знайденого запитом по лізі.
+     * @details Копія (Player::Clone()), тож її можна читати з будь-якого
+     *          потоку, поки шард змінює оригінал.
+     */
+    struct LeaguePlayerSnapshot
+    {
+        int clubId = 0; ///< ID клубу в лізі.
+        std::string clubName; ///< Назва клубу.
+        std::shared_ptr<const Player> player; ///< Копія гравця.
+    };
+
+    /**
+     * @class LeagueManager
+     * @brief Власник клубів ліги та потоків-шардів, що ними керують.
+     */
+    class LeagueManager
+    {
+    private:
+        /// @brief Потік-шард із поштовою скринькою та своїми клубами.
+        struct Shard
+        {
+            std::mutex mutex; ///< Захищає скриньку та stopping.
+            std::condition_variable wake; ///< Нове повідомлення / зупинка.
+            std::deque<std::function<void()>> mailbox; ///< Черга повідомлень.
+            bool stopping = false; ///< Шард завершує роботу.
+            std::unordered_map<int, std::unique_ptr<ClubManager>> clubs;
+            ///< Клуби шарду (лише потік шарду).
+            std::thread worker; ///< Потік шарду.
+        };
+
+        std::vector<std::unique_ptr<Shard>> shards_; ///< Шарди ліги.
+        mutable std::mutex directoryMutex_; ///< Захищає довідник клубів.
+        std::unordered_map<int, std::string> clubNames_;
+        ///< Довідник: ID клубу → назва.
+        int nextClubId_; ///< ID наступного клубу.
+
+        mutable std::mutex idleMutex_; ///< Захищає pending_.
+        mutable std::condition_variable idle_; ///< pending_ став нулем.
+        mutable std::size_t pending_; ///< Подано, але ще не оброблено.
+
+        /// @brief Головний цикл потоку шарду.
+        void ShardLoop(Shard& shard);
+
+        /// @brief Покласти повідомлення у скриньку шарду @p shard.
+        void Post(std::size_t shard, std::function<void()> message) const;
+
+        /// @brief Шард клубу @p clubId.
+        [[nodiscard]] std::size_t ShardOf(int clubId) const
+        {
+            return static_cast<std::size_t>(clubId) % shards_.size();
+        }
+
+        /**
+         * @brief Шард зареєстрованого клубу.
+         * @throws std::invalid_argument якщо клубу немає в лізі.
+         */
+        [[nodiscard]] std::size_t RequireShard(int clubId) const;
+
+        /**
+         * @brief Виконати @p perShard(Shard&) у кожному шарді паралельно.
+         * @return Результати у порядку шардів.
+         */
+        template <typename F>
+        auto FanOut(F perShard) const
+            -> std::vector<std::invoke_result_t<F&, Shard&>>
+        {
+            using R = std::invoke_result_t<F&, Shard&>;
+            std::vector<std::future<R>> futures;
+            futures.reserve(shards_.size());
+            for (std::size_t i = 0; i < shards_.size(); ++i)
+            {
+                auto task = std::make_shared<std::packaged_task<R()>>(
+                    [perShard, shard = shards_[i].get()]() mutable
+                    {
+                        return perShard(*shard);
+                    });
+                futures.push_back(task->get_future());
+                Post(i, [task]() { (*task)(); });
+            }
+
+            std::vector<R> results;
+            results.reserve(futures.size());
+            for (auto& f : futures) results.push_back(f.get());
+            return results;
+        }
+
+        /// @brief Знімки гравців, для яких @p query клубу повертає збіги.
+        [[nodiscard]] std::vector<LeaguePlayerSnapshot> CollectSnapshots(
+            const std::function<std::vector<std::shared_ptr<Player>>(
+                const ClubManager&)>& query) const;
+
+    public:
+        /**
+         * @brief Запустити шарди.
+         * @param shardCount Кількість потоків; 0 — std::thread::hardware_concurrency().
+         */
+        explicit LeagueManager(unsigned shardCount = 0);
+
+        /// @brief Дочекатися всіх повідомлень, знищити клуби та зупинити шарди.
+        ~LeagueManager();
+
+        LeagueManager(const LeagueManager&) = delete;
+        LeagueManager& operator=(const LeagueManager&) = delete;
+
+        /**
+         * @brief Створити клуб у його шарді.
+         * @return ID клубу в лізі.
+         * @throws std::invalid_argument якщо назва порожня або бюджет від'ємний.
+         */
+        int AddClub(const std::string& name, double budget = 10'000'000.0);
+
+        [[nodiscard]] unsigned GetShardCount() const;
+        [[nodiscard]] std::size_t GetClubCount() const;
+
+        /// @brief ID усіх клубів (за зростанням).
+        [[nodiscard]] std::vector<int> GetClubIds() const;
+
+        /// @brief Назва клубу або порожній рядок, якщо клубу немає.
+        [[nodiscard]] std::string GetClubName(int clubId) const;
+
+        /**
+         * @brief Виконати @p f(ClubManager&) у шарді клубу.
+         * @return Майбутній результат @p f (виняток @p f передається в нього).
+         * @throws std::invalid_argument якщо клубу немає в лізі.
+         */
+        template <typename F>
+        auto ExecuteOnClub(int clubId, F f)
+            -> std::future<std::invoke_result_t<F&, ClubManager&>>
+        {
+            using R = std::invoke_result_t<F&, ClubManager&>;
+            const std::size_t index = RequireShard(clubId);
+            auto task = std::make_shared<std::packaged_task<R()>>(
+                [f = std::move(f), shard = shards_[index].get(), clubId]()
+                mutable
+                {
+                    return f(*shard->clubs.at(clubId));
+                });
+            auto future = task->get_future();
+            Post(index, [task]() { (*task)(); });
+            return future;
+        }
+
+        /**
+         * @brief Виконати @p f(const ClubManager&) для кожного клубу ліги.
+         * @details Шарди працюють паралельно; всередині шарду клуби обходяться
+         *          послідовно.
+         * @return Пари (ID клубу, результат) за зростанням ID.
+         */
+        template <typename F>
+        auto ForEachClub(F f) const
+            -> std::vector<std::pair<int, std::invoke_result_t<
+                F&, const ClubManager&>>>
+        {
+            using R = std::invoke_result_t<F&, const ClubManager&>;
+            static_assert(!std::is_void_v<R>,
+                          "ForEachClub потребує результату для кожного клубу.");
+            using Row = std::pair<int, R>;
+
+            auto perShard = FanOut([f](Shard& shard) mutable
+            {
+                std::vector<Row> rows;
+                rows.reserve(shard.clubs.size());
+                for (const auto& [id, club] : shard.clubs)
+                    rows.emplace_back(id, f(static_cast<const ClubManager&>(
+                                          *club)));
+                return rows;
+            });
+
+            std::vector<Row> rows;
+            for (auto& part : perShard)
+                for (auto& row : part) rows.push_back(std::move(row));
+            std::sort(rows.begin(), rows.end(),
+                      [](const Row& a, const Row& b) { return a.first < b.first; });
+            return rows;
+        }
+
+        /**
+         * @brief Трансфер гравця між клубами ліги (обмін повідомленнями).
+         * @details 1) шард покупця резервує @p fee у бюджеті; 2) шард продавця
+         *          виключає гравця зі складу (гравець має бути у трансферному
+         *          списку, а сума — не меншою за мінімальну); 3) шард покупця
+         *          приймає гравця (за зайнятого ID видається новий) і лише тоді
+         *          проводить ContractedPlayer::TransferToClub; 4) шард
+         *          продавця зараховує суму. Якщо крок 2 або 3 не вдався,
+         *          резерв повертається, а гравець — продавцю. Жоден шард не
+         *          чекає на інший, тож зустрічні трансфери не блокуються.
+         * @return Майбутній результат: true, якщо гравець перейшов; виняток
+         *         кроку передається через future.
+         */
+        std::future<bool> TransferPlayer(int playerId, int fromClubId,
+                                         int toClubId, double fee);
+
+        /**
+         * @brief Дочекатися, поки шарди оброблять усі повідомлення.
+         * @details Враховує й повідомлення, які шарди надсилають один одному
+         *          (кроки трансферу), тож після повернення ланцюжки завершено.
+         */
+        void WaitIdle() const;
+
+    public:
+        /// @name Запити по всій лізі (паралельно за шардами)
+        /// @{
+
+        /// @brief Гравці всіх клубів із підрядком @p q в імені.
+        [[nodiscard]] std::vector<LeaguePlayerSnapshot>
+        SearchByName(const std::string& q) const;
+
+        /// @brief Гравці всіх клубів із підрядком @p status у статусі.
+        [[nodiscard]] std::vector<LeaguePlayerSnapshot>
+        FilterByStatus(const std::string& status) const;
+
+        /// @brief Загальна кількість гравців ліги.
+        [[nodiscard]] std::size_t GetTotalPlayerCount() const;
+        /// @}
+    };
+}
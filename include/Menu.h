@@ -3,6 +3,9 @@
 #include <memory>
 #include "ClubManager.h"
 #include "FileManager.h"
+#include "Metrics.h"
+#include "StartupLoader.h"
+#include "UserStore.h"
 
 /**
  * @file Menu.h
@@ -28,7 +31,11 @@ namespace FootballManagement
     private:
         std::shared_ptr<ClubManager> clubManager_; ///< Менеджер складу клубу.
         FileManager fileManager_; ///< Менеджер файлів (users/players).
+        UserStore userStore_; ///< Знімок і журнал змін користувачів.
+        StartupLoader startup_; ///< Фонове завантаження складу.
+        MetricsExporter metricsExporter_; ///< Періодичний знімок метрик.
         bool isRunning_; ///< Прапорець основного циклу.
+        bool lossySaveAllowed_; ///< Користувач дозволив зберегти неповний склад.
 
     public:
         /**
@@ -54,14 +61,16 @@ namespace FootballManagement
         void Stop();
 
         /**
-         * @brief Завантажити всі дані з файлів.
+         * @brief Завантажити користувачів і почати фонове завантаження складу.
+         * @details Операції зі складом чекають на нього через
+         *          StartupLoader::Roster().
          */
-        void LoadAllData() const;
+        void LoadAllData();
 
         /**
          * @brief Зберегти всі дані у файли.
          */
-        void SaveAllData() const;
+        void SaveAllData();
 
     private:
         /**
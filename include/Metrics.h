@@ -0,0 +1,279 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FileManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file Metrics.h
+     * @brief Лічильники та гістограми затримок гарячих операцій.
+     * @details Кожен потік пише у власний блок (один записувач — без
+     *          атомарних read-modify-write і без спільних кеш-ліній), читання
+     *          зливає блоки всіх потоків. Гістограма має лог-лінійні кошики в
+     *          стилі HDR: 3 значущі біти на кожен степінь двійки (похибка
+     *          ≤ 12,5 %) у діапазоні від 1 нс до 2^64 нс. MetricsExporter
+     *          періодично записує знімок у METRICS_FILE у текстовому форматі
+     *          Prometheus.
+     */
+
+    /// @brief Файл знімка метрик у каталозі даних.
+    constexpr const char* METRICS_FILE = "metrics.prom";
+
+    /**
+     * @enum MetricCounter
+     * @brief Лічильники подій (номер — індекс у блоці потоку).
+     */
+    enum class MetricCounter : std::uint8_t
+    {
+        FileSaveErrors, ///< Невдалі FileManager::SaveToFile.
+        FileLoadErrors, ///< Невдалі FileManager::LoadFromFile.
+        SearchResults, ///< Знайдено гравців у ClubManager::SearchByName.
+        SigningsCompleted ///< Успішні ClubManager::SignFreeAgent.
+    };
+
+    /// @brief Кількість лічильників у MetricCounter.
+    constexpr std::size_t METRIC_COUNTER_COUNT = 4;
+
+    /**
+     * @enum MetricHistogram
+     * @brief Гістограми тривалості операцій (у наносекундах).
+     */
+    enum class MetricHistogram : std::uint8_t
+    {
+        FileSave, ///< FileManager::SaveToFile.
+        FileLoad, ///< FileManager::LoadFromFile.
+        SearchByName, ///< ClubManager::SearchByName.
+        FilterByStatus, ///< ClubManager::FilterByStatus.
+        SignFreeAgent ///< ClubManager::SignFreeAgent.
+    };
+
+    /// @brief Кількість гістограм у MetricHistogram.
+    constexpr std::size_t METRIC_HISTOGRAM_COUNT = 5;
+
+    /// @brief Значущих бітів у кошику гістограми.
+    constexpr unsigned HISTOGRAM_SUB_BITS = 3;
+
+    /// @brief Кошиків на один степінь двійки.
+    constexpr std::size_t HISTOGRAM_SUB_BUCKETS = 1u << HISTOGRAM_SUB_BITS;
+
+    /// @brief Значення, менші за цей поріг, мають власний кошик.
+    constexpr std::uint64_t HISTOGRAM_LINEAR_LIMIT = 2 * HISTOGRAM_SUB_BUCKETS;
+
+    /// @brief Загальна кількість кошиків гістограми.
+    constexpr std::size_t HISTOGRAM_BUCKET_COUNT =
+        HISTOGRAM_LINEAR_LIMIT + (64 - HISTOGRAM_SUB_BITS - 1) *
+        HISTOGRAM_SUB_BUCKETS;
+
+    /// @brief Номер кошика для значення @p value.
+    constexpr std::size_t HistogramBucket(std::uint64_t value)
+    {
+        if (value < HISTOGRAM_LINEAR_LIMIT)
+            return static_cast<std::size_t>(value);
+
+#if defined(__GNUC__) || defined(__clang__)
+        const unsigned exponent =
+            63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+        unsigned exponent = 63;
+        while ((value >> exponent) == 0) --exponent;
+#endif
+        const unsigned shift = exponent - HISTOGRAM_SUB_BITS;
+        return static_cast<std::size_t>(
+            HISTOGRAM_LINEAR_LIMIT +
+            (exponent - HISTOGRAM_SUB_BITS - 1) * HISTOGRAM_SUB_BUCKETS +
+            ((value >> shift) & (HISTOGRAM_SUB_BUCKETS - 1)));
+    }
+
+    static_assert(HistogramBucket(HISTOGRAM_LINEAR_LIMIT - 1) ==
+        HISTOGRAM_LINEAR_LIMIT - 1);
+    static_assert(HistogramBucket(HISTOGRAM_LINEAR_LIMIT) ==
+        HISTOGRAM_LINEAR_LIMIT);
+    static_assert(HistogramBucket(~std::uint64_t{0}) ==
+        HISTOGRAM_BUCKET_COUNT - 1);
+
+    /**
+     * @struct HistogramSnapshot
+     * @brief Злиті значення однієї гістограми.
+     */
+    struct HistogramSnapshot
+    {
+        std::array<std::uint64_t, HISTOGRAM_BUCKET_COUNT> buckets{};
+        std::uint64_t count = 0; ///< Кількість записів.
+        std::uint64_t sum = 0; ///< Сума значень (нс).
+
+        /// @brief Кількість записів зі значенням < @p limit нс.
+        [[nodiscard]] std::uint64_t CountBelow(std::uint64_t limit) const;
+    };
+
+    /**
+     * @struct MetricsSnapshot
+     * @brief Злиті значення всіх метрик на момент читання.
+     */
+    struct MetricsSnapshot
+    {
+        std::array<std::uint64_t, METRIC_COUNTER_COUNT> counters{};
+        std::array<HistogramSnapshot, METRIC_HISTOGRAM_COUNT> histograms{};
+    };
+
+    /**
+     * @struct MetricsThreadBlock
+     * @brief Метрики одного потоку (пише лише він, читає будь-хто).
+     */
+    struct MetricsThreadBlock
+    {
+        struct Histogram
+        {
+            std::array<std::atomic<std::uint64_t>, HISTOGRAM_BUCKET_COUNT>
+            buckets{};
+            std::atomic<std::uint64_t> sum{0};
+        };
+
+        std::array<std::atomic<std::uint64_t>, METRIC_COUNTER_COUNT>
+        counters{};
+        std::array<Histogram, METRIC_HISTOGRAM_COUNT> histograms{};
+    };
+
+    /**
+     * @class MetricsRegistry
+     * @brief Реєстр блоків метрик усіх потоків (Singleton).
+     */
+    class MetricsRegistry
+    {
+    private:
+        mutable std::mutex mutex_; ///< Захищає список блоків.
+        std::vector<std::unique_ptr<MetricsThreadBlock>> blocks_;
+        ///< Блоки потоків; живуть до кінця програми (дані завершених потоків
+        ///< теж враховуються).
+
+        MetricsRegistry() = default;
+
+        /// @brief Створити й зареєструвати блок для поточного потоку.
+        MetricsThreadBlock& RegisterThread();
+
+        /// @brief Блок поточного потоку.
+        MetricsThreadBlock& LocalBlock()
+        {
+            thread_local MetricsThreadBlock* block = nullptr;
+            if (!block) block = &RegisterThread();
+            return *block;
+        }
+
+        /// @brief Додати до комірки, яку змінює лише цей потік.
+        static void Add(std::atomic<std::uint64_t>& cell, std::uint64_t delta)
+        {
+            cell.store(cell.load(std::memory_order_relaxed) + delta,
+                       std::memory_order_relaxed);
+        }
+
+    public:
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+        /// @brief Єдиний екземпляр.
+        static MetricsRegistry& GetInstance();
+
+        /// @brief Збільшити лічильник.
+        void Increment(MetricCounter counter, std::uint64_t delta = 1)
+        {
+            Add(LocalBlock().counters[static_cast<std::size_t>(counter)],
+                delta);
+        }
+
+        /// @brief Записати тривалість @p nanoseconds у гістограму.
+        void Record(MetricHistogram histogram, std::uint64_t nanoseconds)
+        {
+            auto& h = LocalBlock().histograms[
+                static_cast<std::size_t>(histogram)];
+            Add(h.buckets[HistogramBucket(nanoseconds)], 1);
+            Add(h.sum, nanoseconds);
+        }
+
+        /// @brief Злити блоки всіх потоків.
+        [[nodiscard]] MetricsSnapshot Snapshot() const;
+
+        /// @brief Знімок у текстовому форматі Prometheus.
+        [[nodiscard]] std::string RenderPrometheus() const;
+    };
+
+    /**
+     * @class ScopedLatency
+     * @brief Записує тривалість області видимості у гістограму.
+     */
+    class ScopedLatency
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        MetricHistogram histogram_; ///< Куди записати.
+        Clock::time_point start_; ///< Початок виміру.
+
+    public:
+        explicit ScopedLatency(MetricHistogram histogram)
+            : histogram_(histogram),
+              start_(Clock::now())
+        {
+        }
+
+        ScopedLatency(const ScopedLatency&) = delete;
+        ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+        ~ScopedLatency()
+        {
+            const auto elapsed = std::chrono::duration_cast<
+                std::chrono::nanoseconds>(Clock::now() - start_).count();
+            MetricsRegistry::GetInstance().Record(
+                histogram_, static_cast<std::uint64_t>(elapsed));
+        }
+    };
+
+    /**
+     * @class MetricsExporter
+     * @brief Фоновий потік, що періодично записує METRICS_FILE.
+     * @details Файл спершу пишеться у тимчасовий і атомарно замінює
+     *          попередній; останній знімок записується при зупинці.
+     */
+    class MetricsExporter
+    {
+    private:
+        FileManager fileManager_; ///< Каталог, куди пишеться знімок.
+        std::chrono::milliseconds interval_; ///< Період запису.
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        bool stopping_ = false;
+        std::thread worker_;
+
+    public:
+        /// @brief Період за замовчуванням.
+        static constexpr std::chrono::seconds DEFAULT_INTERVAL{10};
+
+        /**
+         * @brief Запустити фоновий запис.
+         * @param fileManager Каталог даних.
+         * @param interval Період запису (> 0).
+         */
+        explicit MetricsExporter(FileManager fileManager,
+                                 std::chrono::milliseconds interval =
+                                     DEFAULT_INTERVAL);
+
+        MetricsExporter(const MetricsExporter&) = delete;
+        MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+        /// @brief Зупинити потік і записати останній знімок.
+        ~MetricsExporter();
+
+        /// @brief Записати знімок зараз.
+        bool WriteNow() const;
+    };
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @file PasswordHasher.h
+     * @brief Хешування паролів функцією scrypt (RFC 7914) із сіллю.
+     * @details Формат збереженого хешу (без двокрапок, тож сумісний із
+     *          users.txt): `$scrypt$ln=14,r=8,p=1$<сіль base64>$<хеш base64>`.
+     *          scrypt вимагає 128·r·N байтів пам'яті на перевірку, тому
+     *          перебір паролів на GPU/ASIC дорогий. Вартість налаштовується
+     *          через KdfParams; параметри зберігаються разом із хешем, тож
+     *          старі записи перевіряються після зміни налаштувань.
+     */
+
+    /**
+     * @struct KdfParams
+     * @brief Параметри вартості scrypt.
+     */
+    struct KdfParams
+    {
+        int logN = 14; ///< log2(N): 14 → N = 16384, 16 МіБ при r = 8.
+        std::uint32_t r = 8; ///< Розмір блоку.
+        std::uint32_t p = 1; ///< Паралелізм.
+
+        /// @brief Обсяг пам'яті на одну перевірку (байт).
+        [[nodiscard]] std::size_t MemoryBytes() const;
+
+        /// @throws std::invalid_argument якщо параметри поза допустимими межами.
+        void Validate() const;
+    };
+
+    /**
+     * @class PasswordHasher
+     * @brief Створення й перевірка хешів паролів.
+     */
+    class PasswordHasher
+    {
+    public:
+        PasswordHasher() = delete;
+
+        /// @brief Параметри для нових хешів (за замовчуванням KdfParams{}).
+        [[nodiscard]] static KdfParams GetDefaultParams();
+
+        /**
+         * @brief Змінити параметри для нових хешів (напр., на старті програми).
+         * @throws std::invalid_argument якщо параметри некоректні.
+         */
+        static void SetDefaultParams(const KdfParams& params);
+
+        /**
+         * @brief Захешувати пароль із новою випадковою сіллю.
+         * @return Рядок у форматі `$scrypt$...`.
+         */
+        [[nodiscard]] static std::string Hash(const std::string& password);
+
+        /// @brief Те саме з явними параметрами.
+        [[nodiscard]] static std::string Hash(const std::string& password,
+                                              const KdfParams& params);
+
+        /**
+         * @brief Перевірити пароль проти збереженого хешу.
+         * @details Порівняння дайджестів виконується за сталий час. Хеш,
+         *          дорожчий за GetDefaultParams() більш ніж учетверо (за
+         *          пам'яттю або пам'яттю·p), не перевіряється.
+         * @return false для неправильного пароля, пошкодженого або
+         *         задорогого хешу.
+         */
+        [[nodiscard]] static bool Verify(const std::string& password,
+                                         const std::string& encoded);
+
+        /// @brief Чи схожий рядок на хеш цього формату (а не на пароль відкритим текстом).
+        [[nodiscard]] static bool IsEncodedHash(const std::string& value);
+
+        /// @brief Порівняння без раннього виходу (час не залежить від вмісту).
+        [[nodiscard]] static bool ConstantTimeEquals(const std::string& a,
+                                                     const std::string& b);
+
+        /**
+         * @brief Сирий scrypt (для тестових векторів RFC 7914).
+         * @param password Пароль.
+         * @param salt Сіль.
+         * @param params Параметри вартості.
+         * @param length Довжина результату (байт).
+         */
+        [[nodiscard]] static std::vector<std::uint8_t> Scrypt(
+            const std::string& password, const std::string& salt,
+            const KdfParams& params, std::size_t length);
+    };
+}
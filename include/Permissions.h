@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "Utils.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file Permissions.h
+     * @brief Права доступу як бітові маски, обчислені під час компіляції.
+     * @details Кожна роль відображається на маску прав (DefaultPermissions()).
+     *          Користувач зберігає готову маску, тож перевірка в ClubManager,
+     *          AuthManager чи сервері — одна бітова операція, незалежно від
+     *          того, чи маска стандартна, чи завантажена з ROLES_CONFIG_FILE.
+     */
+
+    /// @brief Файл власних ролей: рядки "назва:право,право,...".
+    constexpr const char* ROLES_CONFIG_FILE = "roles.txt";
+
+    /**
+     * @enum Permission
+     * @brief Окрема можливість (номер біта в PermissionSet).
+     */
+    enum class Permission : std::uint8_t
+    {
+        EditPlayers, ///< Додавання/видалення гравців, контракти, оренди.
+        SignAgents, ///< Підписання вільних агентів і трансфери.
+        ManageUsers, ///< Облікові записи, ролі, адміністративні дії.
+        ViewFinances ///< Перегляд бюджету клубу.
+    };
+
+    /// @brief Кількість прав у Permission.
+    constexpr std::size_t PERMISSION_COUNT = 4;
+
+    /// @brief Набір прав: біт i відповідає Permission з номером i.
+    using PermissionSet = std::uint32_t;
+
+    /// @brief Маска з одним правом.
+    constexpr PermissionSet PermissionBit(Permission permission)
+    {
+        return PermissionSet{1} << static_cast<unsigned>(permission);
+    }
+
+    /// @brief Чи містить набір право.
+    constexpr bool HasPermission(PermissionSet set, Permission permission)
+    {
+        return (set & PermissionBit(permission)) != 0;
+    }
+
+    /// @brief Порожній набір (гість).
+    constexpr PermissionSet NO_PERMISSIONS = 0;
+
+    /// @brief Усі права (адміністратор, пакетні інструменти).
+    constexpr PermissionSet ALL_PERMISSIONS =
+        (PermissionSet{1} << PERMISSION_COUNT) - 1;
+
+    /// @brief Стандартні права ролі.
+    constexpr PermissionSet DefaultPermissions(UserRole role)
+    {
+        switch (role)
+        {
+        case UserRole::Admin: return ALL_PERMISSIONS;
+        case UserRole::StandardUser:
+            return PermissionBit(Permission::EditPlayers)
+                | PermissionBit(Permission::SignAgents)
+                | PermissionBit(Permission::ViewFinances);
+        case UserRole::Guest: return NO_PERMISSIONS;
+        }
+        return NO_PERMISSIONS;
+    }
+
+    static_assert(HasPermission(DefaultPermissions(UserRole::Admin),
+                                Permission::ManageUsers));
+    static_assert(!HasPermission(DefaultPermissions(UserRole::StandardUser),
+                                 Permission::ManageUsers));
+    static_assert(DefaultPermissions(UserRole::Guest) == NO_PERMISSIONS);
+
+    /**
+     * @brief Розпізнати назву права ("edit_players", "sign_agents",
+     *        "manage_users", "view_finances").
+     * @return std::nullopt для невідомої назви.
+     */
+    [[nodiscard]] std::optional<Permission>
+    ParsePermission(const std::string& name);
+
+    /**
+     * @brief Розібрати рядок конфігурації ролі "назва:право,право,...".
+     * @param line Рядок конфігурації.
+     * @param roleName [out] Назва ролі.
+     * @return Маска прав.
+     * @throws std::invalid_argument для порожньої назви або невідомого права.
+     */
+    PermissionSet ParseRoleLine(const std::string& line, std::string& roleName);
+}
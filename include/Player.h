@@ -1,17 +1,23 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "Utils.h"
 #include "IFileHandler.h"
+#include "FieldSchema.h"
+#include "PlayerChanges.h"
 
 namespace FootballManagement
 {
     /**
      * @file Player.h
      * @brief Оголошення абстрактного класу Player (базова сутність футболіста).
-     * @details Містить антропометрію, біографію, травми та допоміжну
-     *          (дефолтну) серіалізацію спільних полів. Конкретні класи
+     * @details Містить антропометрію, біографію, травми та дескриптори
+     *          спільних полів для схем серіалізації. Конкретні класи
      *          повинні реалізувати чисто віртуальні методи.
      */
 
@@ -21,7 +27,7 @@ namespace FootballManagement
      * @details Підтримує копі/мув-семантику, валідацію, історію травм,
      *          а також інтерфейс IFileHandler. Повна серіалізація/десеріалізація
      *          делегується похідним класам через чисто віртуальні методи, а
-     *          спільні поля серіалізуються методами SerializeBase/DeserializeBase.
+     *          спільні поля описуються дескрипторами BaseFields() (FieldSchema.h).
      */
     class Player : public IFileHandler
     {
@@ -36,6 +42,10 @@ namespace FootballManagement
         double marketValue_;
         bool injured_;
         std::vector<Injury> injuryHistory_;
+        std::uint64_t version_; ///< Лічильник змін (зростає з кожною зміною).
+        PlayerFieldMask dirtyFields_; ///< Групи полів, змінені з останнього
+        ///< ClearDirtyFields().
+        IPlayerObserver* observer_; ///< Спостерігач (не володіє; не копіюється).
 
     public:
         /// @brief Конструктор за замовчуванням.
@@ -74,10 +84,10 @@ namespace FootballManagement
         /// @name Гетери
         /// @{
         [[nodiscard]] int GetPlayerId() const;
-        [[nodiscard]] std::string GetName() const;
+        [[nodiscard]] const std::string& GetName() const;
         [[nodiscard]] int GetAge() const;
-        [[nodiscard]] std::string GetNationality() const;
-        [[nodiscard]] std::string GetOrigin() const;
+        [[nodiscard]] const std::string& GetNationality() const;
+        [[nodiscard]] const std::string& GetOrigin() const;
         [[nodiscard]] double GetHeight() const;
         [[nodiscard]] double GetWeight() const;
         [[nodiscard]] double GetMarketValue() const;
@@ -108,11 +118,14 @@ namespace FootballManagement
         [[nodiscard]] virtual double CalculatePerformanceRating() const = 0;
 
         /// @brief Статус (наприклад, "FreeAgent" / "Contracted" / "Loaned").
-        [[nodiscard]] virtual std::string GetStatus() const = 0;
+        [[nodiscard]] virtual std::string_view GetStatus() const = 0;
 
         /// @brief Збільшує вік на 1 рік (день народження).
         virtual void CelebrateBirthday() = 0;
 
+        /// @brief Глибока копія гравця з тим самим конкретним типом.
+        [[nodiscard]] virtual std::unique_ptr<Player> Clone() const = 0;
+
     public:
         /**
          * @brief Повідомити про травму гравця.
@@ -130,6 +143,33 @@ namespace FootballManagement
          */
         void UpdateMarketValue(double percentageChange);
 
+    public:
+        /// @name Відстеження змін (PlayerChanges.h)
+        /// @{
+
+        /// @brief Версія гравця: кількість змін від створення.
+        [[nodiscard]] std::uint64_t GetVersion() const;
+
+        /// @brief Групи полів, змінені з останнього ClearDirtyFields().
+        [[nodiscard]] PlayerFieldMask GetDirtyFields() const;
+
+        /// @brief Чи є незбережені зміни.
+        [[nodiscard]] bool IsDirty() const;
+
+        /// @brief Скинути маску змін (напр., після збереження).
+        void ClearDirtyFields();
+
+        /**
+         * @brief Встановити спостерігача змін (nullptr — від'єднати).
+         * @details Спостерігач один — клуб, у складі якого гравець
+         *          (ClubManager не приймає гравця іншого клубу). Копії та
+         *          переміщені об'єкти спостерігача не успадковують.
+         */
+        void SetObserver(IPlayerObserver* observer);
+
+        [[nodiscard]] IPlayerObserver* GetObserver() const;
+        /// @}
+
     public:
         /// @brief Серіалізує весь об'єкт (реалізують похідні класи).
         [[nodiscard]] virtual std::string Serialize() const override = 0;
@@ -139,15 +179,77 @@ namespace FootballManagement
 
     protected:
         /**
-         * @brief Серіалізує спільні поля у вигляді фрагмента JSON.
-         * @return Рядок без фігурних дужок { }, лише пари ключ-значення.
+         * @brief Позначити зміну групи полів.
+         * @details Збільшує версію, додає біт у маску та сповіщає спостерігача.
+         *          Викликається сетерами й мутаторами після успішної зміни;
+         *          десеріалізація його не викликає.
          */
-        [[nodiscard]] std::string SerializeBase() const;
+        void MarkDirty(PlayerFieldMask fields);
+
+        /// @brief Позначити зміну однієї групи полів.
+        void MarkDirty(PlayerField field) { MarkDirty(PlayerFieldBit(field)); }
 
         /**
-         * @brief Десеріалізація спільних полів із JSON-фрагмента.
-         * @param json JSON-фрагмент (може бути і цілий об'єкт).
+         * @brief Дескриптори спільних полів для схеми класу-нащадка @p T.
+         * @details Порядок ключів: id, name, age, nationality, origin, height,
+         *          weight, marketValue, injured.
          */
-        void DeserializeBase(const std::string& json);
+        template <typename T>
+        static constexpr std::array<Field<T>, 9> BaseFields()
+        {
+            return {{
+                {
+                    "id", FieldType::Int,
+                    [](const T& p, FieldValue& v) { v.integer = p.playerId_; },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.playerId_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "name", FieldType::Text,
+                    [](const T& p, FieldValue& v) { v.text = p.name_; },
+                    [](T& p, const FieldValue& v) { p.name_ = v.text; }
+                },
+                {
+                    "age", FieldType::Int,
+                    [](const T& p, FieldValue& v) { v.integer = p.age_; },
+                    [](T& p, const FieldValue& v)
+                    {
+                        p.age_ = static_cast<int>(v.integer);
+                    }
+                },
+                {
+                    "nationality", FieldType::Text,
+                    [](const T& p, FieldValue& v) { v.text = p.nationality_; },
+                    [](T& p, const FieldValue& v) { p.nationality_ = v.text; }
+                },
+                {
+                    "origin", FieldType::Text,
+                    [](const T& p, FieldValue& v) { v.text = p.origin_; },
+                    [](T& p, const FieldValue& v) { p.origin_ = v.text; }
+                },
+                {
+                    "height", FieldType::Number,
+                    [](const T& p, FieldValue& v) { v.number = p.height_; },
+                    [](T& p, const FieldValue& v) { p.height_ = v.number; }
+                },
+                {
+                    "weight", FieldType::Number,
+                    [](const T& p, FieldValue& v) { v.number = p.weight_; },
+                    [](T& p, const FieldValue& v) { p.weight_ = v.number; }
+                },
+                {
+                    "marketValue", FieldType::Number,
+                    [](const T& p, FieldValue& v) { v.number = p.marketValue_; },
+                    [](T& p, const FieldValue& v) { p.marketValue_ = v.number; }
+                },
+                {
+                    "injured", FieldType::Bool,
+                    [](const T& p, FieldValue& v) { v.flag = p.injured_; },
+                    [](T& p, const FieldValue& v) { p.injured_ = v.flag; }
+                }
+            }};
+        }
     };
 }
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace FootballManagement
+{
+    class Player;
+
+    /**
+     * @file PlayerChanges.h
+     * @brief Відстеження змін гравця: версія, маска змінених полів, спостерігач.
+     * @details Кожен сетер і мутатор гравця позначає групу полів у масці та
+     *          збільшує версію, після чого сповіщає спостерігача (зазвичай
+     *          ClubManager). Так індекси, кеші й збереження оновлюють лише те,
+     *          що змінилося, без повторного обходу всього складу.
+     */
+
+    /**
+     * @enum PlayerField
+     * @brief Групи полів гравця (номер — біт у PlayerFieldMask).
+     */
+    enum class PlayerField : std::uint8_t
+    {
+        Id, ///< Ідентифікатор.
+        Name, ///< ПІБ.
+        Age, ///< Вік.
+        Nationality, ///< Громадянство.
+        Origin, ///< Походження.
+        Physical, ///< Зріст і вага.
+        MarketValue, ///< Ринкова вартість.
+        Injury, ///< Стан здоров'я та історія травм.
+        Position, ///< Позиція на полі.
+        Stats, ///< Сезонна статистика (польова чи воротарська).
+        Contract, ///< Деталі контракту (клуб, дати, зарплата, оренда).
+        Transfer, ///< Трансферний список і попередній клуб.
+        Negotiation ///< Умови вільного агента (клуб, очікування, переговори).
+    };
+
+    /// @brief Кількість груп у PlayerField.
+    constexpr std::size_t PLAYER_FIELD_COUNT = 13;
+
+    /// @brief Набір груп полів (біт i — PlayerField з номером i).
+    using PlayerFieldMask = std::uint32_t;
+
+    /// @brief Біт однієї групи полів.
+    constexpr PlayerFieldMask PlayerFieldBit(PlayerField field)
+    {
+        return PlayerFieldMask{1} << static_cast<unsigned>(field);
+    }
+
+    /// @brief Чи містить маска групу @p field.
+    constexpr bool HasPlayerField(PlayerFieldMask mask, PlayerField field)
+    {
+        return (mask & PlayerFieldBit(field)) != 0;
+    }
+
+    /// @brief Маска всіх груп полів.
+    constexpr PlayerFieldMask ALL_PLAYER_FIELDS =
+        (PlayerFieldMask{1} << PLAYER_FIELD_COUNT) - 1;
+
+    /**
+     * @class IPlayerObserver
+     * @brief Отримувач сповіщень про зміну гравця.
+     */
+    class IPlayerObserver
+    {
+    public:
+        virtual ~IPlayerObserver() = default;
+
+        /**
+         * @brief Викликається після кожної зміни гравця.
+         * @param player Змінений гравець (нова версія вже встановлена).
+         * @param fields Групи полів, змінені цією операцією.
+         */
+        virtual void OnPlayerChanged(Player& player,
+                                     PlayerFieldMask fields) = 0;
+
+        /**
+         * @brief Викликається при зміні ID гравця (перед OnPlayerChanged()).
+         * @param player Гравець (новий ID уже встановлено).
+         * @param oldId Попередній ID — ключ, за яким гравця проіндексовано.
+         */
+        virtual void OnPlayerIdChanged(Player& player, int oldId) = 0;
+    };
+
+    /**
+     * @enum PlayerChangeKind
+     * @brief Вид події у стрічці змін ClubManager.
+     */
+    enum class PlayerChangeKind : std::uint8_t
+    {
+        Added, ///< Гравця додано у склад.
+        Updated, ///< Поля гравця змінено.
+        Removed ///< Гравця видалено зі складу.
+    };
+
+    /**
+     * @struct PlayerChange
+     * @brief Одна подія стрічки змін.
+     */
+    struct PlayerChange
+    {
+        std::uint64_t sequence = 0; ///< Наскрізний номер події (від 1).
+        int playerId = 0; ///< ID гравця.
+        std::uint64_t version = 0; ///< Версія гравця після зміни.
+        PlayerFieldMask fields = 0; ///< Змінені групи полів.
+        PlayerChangeKind kind = PlayerChangeKind::Updated; ///< Вид події.
+    };
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @file RosterArchive.h
+     * @brief Блочно-стиснений файл записів (складу) з індексом у кінці.
+     * @details Рядки players.txt здебільшого складаються з однакових ключів
+     *          ("\"nationality\":", "\"contractUntil\":" …), тож добре
+     *          стискаються LZ-кодеком. Записи групуються у блоки по
+     *          recordsPerBlock, кожен блок стискається окремо:
+     *          @code
+     *          "FMRA" версія
+     *          блок 0 … блок K-1                (LZ, незалежні)
+     *          footer: K × {offset, compressedSize, rawSize, firstRecord, count}
+     *                  M × {playerId, recordIndex}  (відсортовано за ID)
+     *          footerOffset  "FMRA"
+     *          @endcode
+     *          Open() читає лише footer; ReadRecord()/FindById() розпаковують
+     *          один блок, ReadAll() — усі. Числа записуються little-endian.
+     */
+
+    /**
+     * @struct RosterBlockInfo
+     * @brief Положення одного блоку у файлі.
+     */
+    struct RosterBlockInfo
+    {
+        std::uint64_t offset = 0; ///< Зсув стиснених даних від початку файлу.
+        std::uint32_t compressedSize = 0; ///< Розмір стиснених даних (байт).
+        std::uint32_t rawSize = 0; ///< Розмір після розпакування (байт).
+        std::uint32_t firstRecord = 0; ///< Номер першого запису блоку.
+        std::uint32_t recordCount = 0; ///< Кількість записів у блоці.
+    };
+
+    /**
+     * @class RosterArchive
+     * @brief Запис і читання блочного архіву записів.
+     */
+    class RosterArchive
+    {
+    private:
+        std::string path_; ///< Відкритий файл.
+        std::vector<RosterBlockInfo> blocks_; ///< Індекс блоків.
+        std::vector<std::pair<int, std::uint32_t>> idIndex_;
+        ///< (ID гравця, номер запису), відсортовано за ID.
+        std::uint32_t recordCount_ = 0; ///< Загальна кількість записів.
+
+        /// @brief Розпакувати блок @p index і розбити на записи.
+        [[nodiscard]] std::vector<std::string> ReadBlock(std::size_t index) const;
+
+    public:
+        /// @brief Записів у блоці за замовчуванням.
+        static constexpr std::size_t DEFAULT_RECORDS_PER_BLOCK = 256;
+
+        /**
+         * @brief Записати записи у файл @p path.
+         * @details Записи, що починаються з {"id":N, індексуються за ID.
+         * @param records Рядки без символу нового рядка.
+         * @param recordsPerBlock Записів у блоці (≥ 1).
+         * @throws std::runtime_error якщо файл не вдалося записати.
+         */
+        static void Write(const std::string& path,
+                          const std::vector<std::string>& records,
+                          std::size_t recordsPerBlock =
+                              DEFAULT_RECORDS_PER_BLOCK);
+
+        /**
+         * @brief Відкрити архів: прочитати й перевірити footer.
+         * @throws std::runtime_error якщо файл відсутній або пошкоджений.
+         */
+        void Open(const std::string& path);
+
+        /// @brief Усі записи у вихідному порядку.
+        [[nodiscard]] std::vector<std::string> ReadAll() const;
+
+        /// @brief Запис за номером (розпаковується лише його блок).
+        [[nodiscard]] std::optional<std::string>
+        ReadRecord(std::size_t index) const;
+
+        /// @brief Запис гравця за ID (розпаковується лише його блок).
+        [[nodiscard]] std::optional<std::string> FindById(int playerId) const;
+
+        [[nodiscard]] std::size_t GetRecordCount() const;
+        [[nodiscard]] std::size_t GetBlockCount() const;
+    };
+}
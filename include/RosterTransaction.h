@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Player.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file RosterTransaction.h
+     * @brief Операції пакетної транзакції над складом клубу та запис журналу.
+     * @details Пакет застосовується через ClubManager::ApplyTransaction() за
+     *          принципом «усе або нічого» відносно бюджетного реєстру.
+     */
+
+    /**
+     * @enum TransactionKind
+     * @brief Тип однієї операції у пакеті.
+     */
+    enum class TransactionKind
+    {
+        Signing, ///< Підписання вільного агента (списує зарплату).
+        TransferIn, ///< Купівля виставленого на трансфер гравця (списує суму).
+        TransferOut, ///< Продаж власного гравця (зараховує суму, гравець іде зі складу).
+        SalaryChange ///< Нова зарплата контрактного гравця (списує/повертає різницю).
+    };
+
+    /**
+     * @struct RosterOperation
+     * @brief Одна операція пакету. Створюйте через фабричні методи.
+     */
+    struct RosterOperation
+    {
+        TransactionKind kind; ///< Тип операції.
+        int playerId; ///< ID гравця складу (TransferOut / SalaryChange).
+        std::shared_ptr<Player> player; ///< Новий гравець (Signing / TransferIn).
+        double amount; ///< Зарплата / трансферна сума / нова зарплата (€).
+        std::string detail; ///< Дата контракту (Signing) або клуб-покупець (TransferOut).
+
+        /// @brief Підписати вільного агента із зарплатою @p salary до @p contractUntil.
+        static RosterOperation Signing(std::shared_ptr<Player> agent,
+                                       double salary,
+                                       const std::string& contractUntil);
+
+        /// @brief Купити виставленого на трансфер гравця за @p fee.
+        static RosterOperation TransferIn(std::shared_ptr<Player> player,
+                                          double fee);
+
+        /// @brief Продати гравця складу @p playerId у клуб @p buyer за @p fee.
+        static RosterOperation TransferOut(int playerId,
+                                           const std::string& buyer,
+                                           double fee);
+
+        /// @brief Встановити нову зарплату гравцю складу @p playerId.
+        static RosterOperation SalaryChange(int playerId, double newSalary);
+    };
+
+    /**
+     * @struct TransactionRecord
+     * @brief Один запис журналу на весь пакет (підтверджений або відхилений).
+     */
+    struct TransactionRecord
+    {
+        int batchId = 0; ///< Порядковий номер пакету в межах клубу.
+        bool committed = false; ///< true — пакет застосовано повністю.
+        std::size_t operationCount = 0; ///< Кількість операцій у пакеті.
+        double budgetBefore = 0.0; ///< Бюджет до пакету (€).
+        double budgetAfter = 0.0; ///< Бюджет після пакету (€).
+        std::string message; ///< Підсумок або причина відмови.
+
+        /**
+         * @brief Однорядкове текстове подання для журналу.
+         * @return Рядок формату "batch:status:count:before:after:message".
+         */
+        [[nodiscard]] std::string Serialize() const;
+    };
+}
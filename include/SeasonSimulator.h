@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ClubManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file SeasonSimulator.h
+     * @brief Детермінований симулятор матчів і сезону ліги.
+     * @details Генерує події кожного матчу (голи, асисти, удари, відбори,
+     *          ключові паси, сейви) і пакетно застосовує їх до гравців через
+     *          FieldPlayer::UpdateAttackingStats/UpdateDefensiveStats/
+     *          RegisterKeyPass та Goalkeeper::UpdateMatchStats.
+     */
+
+    /**
+     * @struct FixtureResult
+     * @brief Підсумок одного матчу.
+     */
+    struct FixtureResult
+    {
+        int round; ///< Номер туру (з 1).
+        std::size_t homeClub; ///< Індекс господарів у вхідному списку клубів.
+        std::size_t awayClub; ///< Індекс гостей.
+        int homeGoals; ///< Голи господарів.
+        int awayGoals; ///< Голи гостей.
+    };
+
+    /**
+     * @struct StandingRow
+     * @brief Рядок турнірної таблиці.
+     */
+    struct StandingRow
+    {
+        std::size_t club; ///< Індекс клубу.
+        std::string clubName; ///< Назва клубу.
+        int played = 0;
+        int wins = 0;
+        int draws = 0;
+        int losses = 0;
+        int goalsFor = 0;
+        int goalsAgainst = 0;
+        int points = 0;
+    };
+
+    /**
+     * @struct SeasonReport
+     * @brief Результати сезону: усі матчі та підсумкова таблиця.
+     */
+    struct SeasonReport
+    {
+        std::vector<FixtureResult> fixtures; ///< Матчі у порядку турів.
+        std::vector<StandingRow> table; ///< Таблиця (очки, різниця, забиті).
+    };
+
+    /**
+     * @class SeasonSimulator
+     * @brief Симулює двоколовий турнір (кожен з кожним вдома і на виїзді).
+     *
+     * @details Кожен матч має власний генератор, зерно якого виводиться з
+     *          початкового зерна та номера матчу, тож результат не залежить
+     *          від кількості потоків. Генерація подій паралелиться за матчами,
+     *          застосування — за клубами (склади клубів не перетинаються,
+     *          а матчі кожного клубу застосовуються у порядку турів).
+     *
+     *          Склад на сезон фіксується на старті: перший нетравмований
+     *          воротар і до 10 нетравмованих польових гравців у порядку складу.
+     */
+    class SeasonSimulator
+    {
+    private:
+        std::uint64_t seed_; ///< Початкове зерно.
+        unsigned threadCount_; ///< Кількість потоків (0 — апаратна).
+
+    public:
+        /**
+         * @brief Конструктор.
+         * @param seed Зерно генератора (однакове зерно — однаковий сезон).
+         * @param threadCount Кількість потоків; 0 — std::thread::hardware_concurrency().
+         */
+        explicit SeasonSimulator(std::uint64_t seed = 42,
+                                 unsigned threadCount = 0);
+
+        /**
+         * @brief Скласти розклад двоколового турніру (метод кола).
+         * @param clubCount Кількість клубів (для непарної додається вихідний).
+         * @return Матчі з нульовим рахунком у порядку турів.
+         */
+        [[nodiscard]] static std::vector<FixtureResult>
+        BuildFixtures(std::size_t clubCount);
+
+        /**
+         * @brief Зіграти сезон і оновити статистику гравців усіх клубів.
+         * @param clubs Клуби ліги (щонайменше два).
+         * @return Результати матчів і турнірна таблиця.
+         */
+        SeasonReport SimulateSeason(
+            const std::vector<std::shared_ptr<ClubManager>>& clubs) const;
+    };
+}
@@ -1,7 +1,23 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace FootballManagement {
     class ClubManager;
     void SeedDemoData(ClubManager& cm);
+
+    /**
+     * @brief Заповнити клуб синтетичним складом (для бенчмарків і навантажувальних тестів).
+     * @details Ті самі типи гравців, що й у SeedDemoData(): ~10% воротарів,
+     *          ~70% контрактних і ~20% вільних агентів, з випадковою історією
+     *          матчів, частиною травмованих і виставлених на трансфер.
+     *          Склад детермінований для однакового @p seed. Повідомлення моделі
+     *          під час генерації заглушено (ScopedConsoleMute).
+     * @param cm Клуб, до якого додаються гравці.
+     * @param count Кількість гравців (масштабується до мільйонів).
+     * @param seed Зерно генератора.
+     */
+    void SeedSyntheticRoster(ClubManager& cm, std::size_t count,
+                             std::uint64_t seed = 42);
 }
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Permissions.h"
+#include "Utils.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file SessionCache.h
+     * @brief Кеш сесій: непрозорий токен → користувач, роль, час завершення.
+     * @details Після одного входу (перевірки пароля через KDF) клієнт
+     *          передає токен, і авторизація запиту зводиться до пошуку в
+     *          кеші. Кеш розбито на SHARD_COUNT сегментів з окремими
+     *          std::shared_mutex: читачі різних сегментів не конкурують, а
+     *          читачі одного сегмента не блокують один одного.
+     *          Це схема з блокуванням читачів, а не lock-free: Resolve()
+     *          бере shared_lock сегмента (атомарна операція над лічильником
+     *          м'ютекса) і чекає, поки Issue()/Revoke() того ж сегмента
+     *          тримає ексклюзивне блокування. Записи короткі, тож таке
+     *          очікування рідкісне (див. BM_ResolveSessionContended).
+     *          Прострочені записи видаляються ліниво (Issue() чистить сегмент,
+     *          коли той удвічі виріс від останнього чищення) або явно через
+     *          PurgeExpired().
+     */
+
+    /**
+     * @struct SessionInfo
+     * @brief Розв'язана сесія.
+     */
+    struct SessionInfo
+    {
+        std::string userName; ///< Логін власника.
+        UserRole role = UserRole::Guest; ///< Роль на момент входу.
+        PermissionSet permissions = NO_PERMISSIONS; ///< Права на момент входу.
+        std::chrono::steady_clock::time_point expiresAt; ///< Кінець дії токена.
+    };
+
+    /**
+     * @class SessionCache
+     * @brief Сегментований потокобезпечний кеш сесій із терміном дії.
+     */
+    class SessionCache
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t SHARD_COUNT = 64; ///< Кількість сегментів.
+
+    private:
+        struct Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<std::string, SessionInfo> sessions;
+            std::size_t purgeAt = 1024; ///< Розмір, при якому Issue() чистить сегмент.
+        };
+
+        std::array<Shard, SHARD_COUNT> shards_; ///< Сегменти кешу.
+        std::chrono::seconds ttl_; ///< Термін дії нового токена.
+
+        [[nodiscard]] Shard& ShardFor(const std::string& token);
+        [[nodiscard]] const Shard& ShardFor(const std::string& token) const;
+
+    public:
+        /// @param ttl Термін дії токена (за замовчуванням 30 хв).
+        explicit SessionCache(std::chrono::seconds ttl = std::chrono::minutes(30));
+
+        /**
+         * @brief Видати новий токен.
+         * @param permissions Права, які перевірятимуться для запитів сесії.
+         * @return 64 hex-символи (256 біт з std::random_device).
+         */
+        std::string Issue(const std::string& userName, UserRole role,
+                          PermissionSet permissions);
+
+        /**
+         * @brief Знайти дійсну сесію.
+         * @return std::nullopt, якщо токена немає або його строк минув.
+         */
+        [[nodiscard]] std::optional<SessionInfo>
+        Resolve(const std::string& token) const;
+
+        /// @brief Анулювати токен. @return true, якщо він існував.
+        bool Revoke(const std::string& token);
+
+        /**
+         * @brief Анулювати всі сесії користувача (видалення, зміна ролі).
+         * @return Кількість анульованих сесій.
+         */
+        std::size_t RevokeUser(const std::string& userName);
+
+        /// @brief Анулювати всі сесії.
+        void Clear();
+
+        /// @brief Видалити прострочені сесії. @return Скільки видалено.
+        std::size_t PurgeExpired();
+
+        /// @brief Кількість збережених сесій (разом із ще не видаленими простроченими).
+        [[nodiscard]] std::size_t Size() const;
+
+        /// @brief Змінити термін дії нових токенів (до початку паралельної роботи).
+        void SetTtl(std::chrono::seconds ttl);
+        [[nodiscard]] std::chrono::seconds GetTtl() const;
+    };
+}
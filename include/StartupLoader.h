@@ -0,0 +1,79 @@
+#pragma once
+
+#include <future>
+#include <memory>
+#include <string>
+
+#include "AuthManager.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+#include "UserStore.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file StartupLoader.h
+     * @brief Паралельне завантаження даних під час старту.
+     * @details Start() запускає завантаження складу у фоновому потоці й
+     *          одночасно (у поточному потоці) завантажує ролі та
+     *          користувачів, тож після повернення можна автентифікуватися,
+     *          поки склад ще читається. Усе, що працює зі складом, бере його
+     *          через Roster(), який за потреби дочікується фонового
+     *          завантаження.
+     */
+    class StartupLoader
+    {
+    private:
+        FileManager fileManager_; ///< Каталог даних.
+        std::shared_ptr<ClubManager> clubManager_; ///< Склад, що заповнюється.
+        std::shared_future<void> rosterReady_; ///< Завершення завантаження складу.
+        std::string rosterError_; ///< Помилка завантаження (порожня — немає).
+        bool rosterSeeded_ = false; ///< Склад був порожній — додано демо-гравців.
+        mutable bool rosterReported_ = false; ///< Результат уже виведено.
+
+        /// @brief Фонове завантаження складу (демо-гравці, якщо порожній).
+        void LoadRoster();
+
+    public:
+        /**
+         * @brief Конструктор.
+         * @param clubManager Склад, який буде заповнено.
+         * @param fileManager Каталог даних.
+         */
+        explicit StartupLoader(std::shared_ptr<ClubManager> clubManager,
+                               FileManager fileManager = FileManager());
+
+        /// @brief Дочекатися фонового завантаження (склад не переживе його).
+        ~StartupLoader();
+
+        StartupLoader(const StartupLoader&) = delete;
+        StartupLoader& operator=(const StartupLoader&) = delete;
+
+        /**
+         * @brief Запустити завантаження складу і завантажити користувачів.
+         * @details Повертається, щойно користувачі готові; склад тим часом
+         *          завантажується далі. Повідомлення моделі у фоновому
+         *          потоці заглушено, щоб не перебивати діалог входу.
+         * @param auth Менеджер користувачів.
+         * @param userStore Сховище облікових записів.
+         */
+        void Start(AuthManager& auth, UserStore& userStore);
+
+        /// @brief Чи завантажено склад (без очікування).
+        [[nodiscard]] bool IsRosterReady() const;
+
+        /**
+         * @brief Склад, завантажений повністю.
+         * @details Блокує, доки фонове завантаження не завершиться; перший
+         *          виклик виводить його результат.
+         */
+        [[nodiscard]] ClubManager& Roster() const;
+
+        /**
+         * @brief Чи завантажено склад з втратою даних (файл не прочитано).
+         * @details Збереження такого складу перезаписало б файл гравців
+         *          неповними даними. Дочікується завантаження, як Roster().
+         */
+        [[nodiscard]] bool IsRosterLossy() const;
+    };
+}
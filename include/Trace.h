@@ -0,0 +1,142 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "FileManager.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file Trace.h
+     * @brief Області трасування (spans) у форматі Chrome Trace Event.
+     * @details Трасування вмикається під час збирання
+     *          (-DFOOTBALLMGMT_ENABLE_TRACING=ON → макрос FOOTBALLMGMT_TRACING).
+     *          Без нього FM_TRACE_SCOPE() нічого не генерує. Кожна область —
+     *          подія "ph":"X" з id потоку та глибиною вкладення; файл
+     *          TRACE_FILE відкривається у chrome://tracing або ui.perfetto.dev.
+     */
+
+    /// @brief Файл трасування в каталозі даних.
+    constexpr const char* TRACE_FILE = "trace.json";
+
+#ifdef FOOTBALLMGMT_TRACING
+    /// @brief Чи зібрано програму з трасуванням.
+    constexpr bool TRACING_ENABLED = true;
+#else
+    /// @brief Чи зібрано програму з трасуванням.
+    constexpr bool TRACING_ENABLED = false;
+#endif
+
+    /**
+     * @struct TraceEvent
+     * @brief Одна завершена область.
+     */
+    struct TraceEvent
+    {
+        const char* name; ///< Назва (рядковий літерал).
+        std::uint64_t startNs; ///< Початок від старту трасувальника (нс).
+        std::uint64_t durationNs; ///< Тривалість (нс).
+        std::uint32_t depth; ///< Глибина вкладення в потоці (0 — верхня).
+    };
+
+    /**
+     * @class Tracer
+     * @brief Збирає події всіх потоків і записує їх у JSON (Singleton).
+     */
+    class Tracer
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /// Події одного потоку; м'ютекс бере лише він сам і читач.
+        struct ThreadBuffer
+        {
+            std::uint32_t threadId = 0;
+            std::uint32_t depth = 0;
+            std::mutex mutex;
+            std::vector<TraceEvent> events;
+        };
+
+        Clock::time_point epoch_; ///< Нуль шкали часу.
+        mutable std::mutex mutex_; ///< Захищає список буферів.
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+        Tracer();
+
+        /// @brief Буфер поточного потоку (створюється при першому виклику).
+        ThreadBuffer& LocalBuffer();
+
+    public:
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        /// @brief Єдиний екземпляр.
+        static Tracer& GetInstance();
+
+        /// @brief Час від старту трасувальника (нс).
+        [[nodiscard]] std::uint64_t Now() const;
+
+        /// @brief Відкрити область у поточному потоці; повертає її глибину.
+        std::uint32_t Enter();
+
+        /// @brief Закрити область, відкриту Enter(), і зберегти подію.
+        void Leave(const char* name, std::uint64_t startNs,
+                   std::uint32_t depth);
+
+        /// @brief Кількість зібраних подій.
+        [[nodiscard]] std::size_t GetEventCount() const;
+
+        /// @brief Видалити зібрані події.
+        void Clear();
+
+        /// @brief JSON у форматі Chrome Trace Event ("traceEvents": [...]).
+        [[nodiscard]] std::string RenderChromeTrace() const;
+
+        /**
+         * @brief Записати TRACE_FILE у каталог @p fileManager.
+         * @return true, якщо файл записано.
+         */
+        bool WriteChromeTrace(const FileManager& fileManager) const;
+    };
+
+    /**
+     * @class TraceSpan
+     * @brief RAII-область: від конструктора до деструктора.
+     */
+    class TraceSpan
+    {
+    private:
+        const char* name_; ///< Назва області.
+        std::uint64_t startNs_; ///< Початок.
+        std::uint32_t depth_; ///< Глибина вкладення.
+
+    public:
+        explicit TraceSpan(const char* name)
+            : name_(name),
+              startNs_(Tracer::GetInstance().Now()),
+              depth_(Tracer::GetInstance().Enter())
+        {
+        }
+
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+
+        ~TraceSpan() { Tracer::GetInstance().Leave(name_, startNs_, depth_); }
+    };
+}
+
+#define FM_TRACE_CONCAT_IMPL(a, b) a##b
+#define FM_TRACE_CONCAT(a, b) FM_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef FOOTBALLMGMT_TRACING
+/// @brief Область трасування до кінця поточного блоку.
+#define FM_TRACE_SCOPE(name) \
+    const ::FootballManagement::TraceSpan FM_TRACE_CONCAT(traceSpan_, __LINE__)(name)
+#else
+#define FM_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Player.h"
+#include "ClubManager.h"
+#include "Utils.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file TransferMarket.h
+     * @brief Пакетний рушій трансферного ринку: зіставлення запитів клубів
+     *        із пулом вільних агентів і виставлених на трансфер гравців.
+     */
+
+    /**
+     * @struct ClubDemand
+     * @brief Запит клубу на одного гравця.
+     */
+    struct ClubDemand
+    {
+        std::shared_ptr<ClubManager> club; ///< Клуб-покупець (бюджет списується з нього).
+        Position position; ///< Потрібна позиція.
+        double maxSalary; ///< Максимальна річна зарплата (€).
+        double minRating; ///< Мінімальний рейтинг ефективності.
+        std::string contractUntil; ///< Дата завершення нового контракту (YYYY-MM-DD).
+    };
+
+    /**
+     * @struct MarketAssignment
+     * @brief Одна пара «запит → гравець» у результаті зіставлення.
+     */
+    struct MarketAssignment
+    {
+        std::size_t demandIndex; ///< Індекс запиту у вхідному пакеті.
+        std::shared_ptr<Player> player; ///< Обраний гравець.
+        double salary; ///< Зарплата гравця (очікувана або за контрактом).
+        double cost; ///< Сума, що списується з бюджету клубу.
+        double rating; ///< Рейтинг ефективності на момент зіставлення.
+    };
+
+    /**
+     * @struct MarketResult
+     * @brief Результат пакетного зіставлення.
+     */
+    struct MarketResult
+    {
+        std::vector<MarketAssignment> assignments; ///< Знайдені пари.
+        std::vector<std::size_t> unfilled; ///< Індекси незадоволених запитів.
+        double totalRating = 0.0; ///< Сумарний рейтинг обраних гравців.
+        double totalCost = 0.0; ///< Сумарні витрати всіх клубів.
+    };
+
+    /**
+     * @class TransferMarket
+     * @brief Зіставляє пакет запитів клубів із пулом гравців.
+     *
+     * @details Кандидатами є вільні агенти, що ведуть переговори
+     *          (вартість = очікувана зарплата, як у ClubManager::SignFreeAgent),
+     *          та контрактні гравці зі списку трансферів (вартість = трансферна
+     *          сума). Воротарі поза пулом, оскільки не мають ринкового статусу.
+     *
+     *          Алгоритм — жадібне зважене паросполучення: кандидати кожної
+     *          позиції обходяться за спаданням рейтингу, і кожен отримує
+     *          найвимогливіший відкритий запит (найвищий minRating ≤ рейтингу),
+     *          чию зарплатну стелю та бюджет клубу він не перевищує. Для
+     *          порогових обмежень за рейтингом такий жадібний вибір дає
+     *          максимальний сумарний рейтинг; зарплатні стелі та бюджети
+     *          враховуються евристично (задача з бюджетом — різновид рюкзака).
+     *
+     *          Складність: O(P log P + D log D + P · d), де d — кількість
+     *          відкритих запитів однієї позиції, які доводиться переглянути.
+     */
+    class TransferMarket
+    {
+    public:
+        TransferMarket() = default;
+        ~TransferMarket() = default;
+
+        /**
+         * @brief Обчислити зіставлення без зміни стану гравців і клубів.
+         * @param demands Пакет запитів.
+         * @param pool Пул гравців (непридатні для ринку пропускаються).
+         * @return Пари «запит → гравець» і список незадоволених запитів.
+         */
+        [[nodiscard]] MarketResult
+        Match(const std::vector<ClubDemand>& demands,
+              const std::vector<std::shared_ptr<Player>>& pool) const;
+
+        /**
+         * @brief Виконати зіставлення: підписати агентів і провести трансфери.
+         * @param demands Той самий пакет, що передавався у Match().
+         * @param result Результат Match().
+         * @return Кількість успішно виконаних угод.
+         */
+        std::size_t Execute(const std::vector<ClubDemand>& demands,
+                            const MarketResult& result) const;
+    };
+}
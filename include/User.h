@@ -3,20 +3,25 @@
 #include <string>
 #include "Utils.h"
 #include "IFileHandler.h"
+#include "Permissions.h"
 
 namespace FootballManagement
 {
     /**
      * @file User.h
      * @brief Обліковий запис користувача системи.
-     * @details Зберігає логін, пароль і роль. Підтримує серіалізацію/десеріалізацію.
+     * @details Зберігає логін, хеш пароля (scrypt із сіллю, див. PasswordHasher)
+     *          і роль. Підтримує серіалізацію/десеріалізацію.
      */
     class User : public IFileHandler
     {
     private:
         std::string userName_; ///< Логін користувача.
-        std::string password_; ///< Пароль користувача (демо, без хешування).
+        std::string passwordHash_; ///< Хеш пароля у форматі PasswordHasher (порожній — без пароля).
         UserRole userRole_; ///< Роль: Admin / StandardUser / Guest.
+        std::string customRole_; ///< Назва власної ролі з ROLES_CONFIG_FILE (порожня — немає).
+        PermissionSet permissions_; ///< Чинні права (стандартні для ролі або власної ролі).
+        bool migrated_ = false; ///< Пароль прочитано відкритим текстом і захешовано при завантаженні.
 
     public:
         /** @brief Конструктор за замовчуванням (гостьовий користувач). */
@@ -51,12 +56,24 @@ namespace FootballManagement
         /** @brief Повертає логін користувача. */
         [[nodiscard]] std::string GetUserName() const;
 
-        /** @brief Повертає пароль користувача (для демо; у продакшені — не робити). */
-        [[nodiscard]] std::string GetPassword() const;
+        /** @brief Повертає збережений хеш пароля (не сам пароль). */
+        [[nodiscard]] std::string GetPasswordHash() const;
+
+        /**
+         * @brief Чи був пароль у застарілому відкритому форматі при Deserialize().
+         * @details Такий запис уже захешовано в пам'яті; файл варто перезаписати.
+         */
+        [[nodiscard]] bool WasMigrated() const;
 
         /** @brief Повертає роль користувача. */
         [[nodiscard]] UserRole GetUserRole() const;
 
+        /** @brief Назва власної ролі (порожня, якщо діють стандартні права). */
+        [[nodiscard]] const std::string& GetCustomRole() const;
+
+        /** @brief Чинний набір прав. */
+        [[nodiscard]] PermissionSet GetPermissions() const;
+
         /**
          * @brief Встановлює новий логін.
          * @throws std::invalid_argument якщо логін порожній.
@@ -67,6 +84,9 @@ namespace FootballManagement
         /** @brief Перевіряє, чи користувач має права адміністратора. */
         [[nodiscard]] bool IsAdmin() const;
 
+        /** @brief Перевірка одного права (одна бітова операція). */
+        [[nodiscard]] bool HasPermission(Permission permission) const;
+
         /**
          * @brief Змінює пароль.
          * @param oldPassword Поточний пароль.
@@ -77,7 +97,7 @@ namespace FootballManagement
                             const std::string& newPassword);
 
         /**
-         * @brief Перевіряє збіг пароля.
+         * @brief Перевіряє збіг пароля (scrypt + порівняння за сталий час).
          * @param inputPassword Пароль для перевірки.
          * @return true, якщо збігається.
          */
@@ -85,10 +105,18 @@ namespace FootballManagement
             const std::string& inputPassword) const;
 
         /**
-         * @brief Встановлює роль користувача.
+         * @brief Встановлює роль користувача (скидає власну роль до стандартних прав).
          */
         void SetRole(UserRole newRole);
 
+        /**
+         * @brief Призначає власну роль із готовою маскою прав.
+         * @param roleName Назва ролі; порожня — повернутися до стандартних прав.
+         * @param permissions Маска прав ролі (ігнорується для порожньої назви).
+         */
+        void SetCustomRole(const std::string& roleName,
+                           PermissionSet permissions);
+
         /**
          * @brief Виводить інформацію про користувача (укр.).
          */
@@ -101,13 +129,17 @@ namespace FootballManagement
 
     public:
         /**
-         * @brief Серіалізує у формат "username:password:roleInt".
+         * @brief Серіалізує у формат "username:passwordHash:roleInt"
+         *        (з ":customRole", якщо призначено власну роль).
          */
         [[nodiscard]] std::string Serialize() const override;
 
         /**
-         * @brief Десеріалізує з формату "username:password:roleInt".
-         * @details У разі помилки встановлюється гостьовий профіль.
+         * @brief Десеріалізує з формату "username:passwordHash:roleInt[:customRole]".
+         * @details Застарілий запис із паролем відкритим текстом хешується
+         *          одразу (див. WasMigrated()). Права встановлюються стандартні
+         *          для ролі; маску власної ролі підставляє AuthManager.
+         *          У разі помилки встановлюється гостьовий профіль.
          */
         void Deserialize(const std::string& data) override;
     };
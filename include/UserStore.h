@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "AuthManager.h"
+#include "FileManager.h"
+#include "User.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file UserStore.h
+     * @brief Сховище облікових записів: знімок + журнал змін.
+     * @details Знімок USERS_FILE_NAME містить користувачів, відсортованих за
+     *          логіном (стабільний diff між збереженнями). Кожна зміна
+     *          облікового запису дописує один рядок у журнал USERS_LOG_FILE:
+     *          @code
+     *          PUT|userName:passwordHash:roleInt
+     *          DEL|userName
+     *          @endcode
+     *          тож реєстрація чи видалення коштує O(1) вводу-виводу замість
+     *          перезапису всього файлу. Під час Load() журнал програється
+     *          поверх знімка; коли записів у журналі набирається
+     *          compactThreshold, Compact() записує новий знімок у тимчасовий
+     *          файл, атомарно підміняє ним старий і видаляє журнал.
+     */
+    class UserStore
+    {
+    private:
+        FileManager fileManager_; ///< Каталог даних.
+        std::size_t compactThreshold_; ///< Записів журналу до ущільнення.
+        std::size_t pendingRecords_ = 0; ///< Записів у журналі зараз.
+
+        /// @brief Дописати рядок журналу.
+        bool AppendRecord(const std::string& record);
+
+    public:
+        /**
+         * @brief Конструктор.
+         * @param fileManager Менеджер файлів (каталог даних).
+         * @param compactThreshold Кількість записів журналу, після якої
+         *        CompactIfNeeded() переписує знімок.
+         */
+        explicit UserStore(FileManager fileManager = FileManager(),
+                           std::size_t compactThreshold = 256);
+
+        /**
+         * @brief Завантажити знімок, програти журнал і передати результат
+         *        у AuthManager::DeserializeAllUsers().
+         * @details Одразу ущільнює сховище, якщо були паролі у відкритому
+         *          вигляді, створено адміністратора за замовчуванням або
+         *          журнал досяг порогу.
+         */
+        void Load(AuthManager& auth);
+
+        /// @brief Записати створення або зміну користувача.
+        bool RecordPut(const User& user);
+
+        /// @brief Записати видалення користувача.
+        bool RecordDelete(const std::string& userName);
+
+        /**
+         * @brief Переписати знімок із поточного стану та очистити журнал.
+         * @return true, якщо знімок записано.
+         */
+        bool Compact(const AuthManager& auth);
+
+        /// @brief Compact(), якщо журнал досяг порогу.
+        bool CompactIfNeeded(const AuthManager& auth);
+
+        /// @brief Чи досяг журнал порогу ущільнення.
+        [[nodiscard]] bool IsCompactionDue() const;
+
+        /**
+         * @brief Запит на запис знімка для FileManager::SaveBatch().
+         * @details Дозволяє ущільнити сховище в одному пакеті з іншими
+         *          файлами; після успішного збереження викликати
+         *          FinishCompaction().
+         */
+        [[nodiscard]] FileSaveRequest
+        SnapshotRequest(const AuthManager& auth) const;
+
+        /// @brief Видалити журнал після того, як знімок записано.
+        void FinishCompaction();
+
+        /// @brief Кількість записів у журналі.
+        [[nodiscard]] std::size_t GetPendingRecords() const;
+    };
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace FootballManagement
 {
@@ -23,6 +26,12 @@ namespace FootballManagement
 
     constexpr const char* PLAYERS_DATA_FILE = "players.txt";
 
+    /// @brief Блочно-стиснена копія складу (див. RosterArchive).
+    constexpr const char* PLAYERS_ARCHIVE_FILE = "players.fmra";
+
+    /// @brief Журнал змін користувачів (доповнює знімок USERS_FILE_NAME).
+    constexpr const char* USERS_LOG_FILE = "users.log";
+
     /**
      * @enum UserRole
      * @brief Визначає рівень доступу користувача в системі.
@@ -46,6 +55,41 @@ namespace FootballManagement
         Forward ///< Нападник
     };
 
+    /**
+     * @brief Перемішування зерна генератора (SplitMix64).
+     * @details Дає незалежні зерна для окремих матчів/випробувань з одного
+     *          початкового зерна, тож результат не залежить від порядку потоків.
+     */
+    constexpr std::uint64_t MixSeed(std::uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /// @brief Нижній регістр для ASCII-літер (інші байти без змін).
+    constexpr char ToLowerAscii(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    /**
+     * @brief Чи містить @p text підрядок @p needle без урахування регістру.
+     * @details Порівняння побайтове (як std::tolower у локалі "C"), без
+     *          копіювання рядків — придатне для пошуку у великих складах.
+     */
+    inline bool ContainsIgnoreCase(std::string_view text, std::string_view needle)
+    {
+        if (needle.empty()) return true;
+        return std::search(text.begin(), text.end(),
+                           needle.begin(), needle.end(),
+                           [](char a, char b)
+                           {
+                               return ToLowerAscii(a) == ToLowerAscii(b);
+                           }) != text.end();
+    }
+
     /**
      * @struct Injury
      * @brief Представляє інформацію про травму футболіста.
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Player.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file ValueForecaster.h
+     * @brief Прогноз ринкової вартості гравців методом Монте-Карло.
+     */
+
+    /**
+     * @struct ForecastConfig
+     * @brief Параметри прогнозу.
+     */
+    struct ForecastConfig
+    {
+        std::size_t trials = 1000; ///< Кількість симульованих сценаріїв на гравця.
+        int seasons = 1; ///< Горизонт прогнозу (сезонів).
+        int matchesPerSeason = 38; ///< Матчів у сезоні.
+        double injuryRatePerMatch = 0.02; ///< Базова ймовірність травми за матч.
+        std::uint64_t seed = 42; ///< Початкове зерно.
+        unsigned threads = 0; ///< Потоків пулу (0 — апаратна кількість).
+        std::size_t trialsPerTask = 64; ///< Розмір задачі для пулу.
+    };
+
+    /**
+     * @struct ValueForecast
+     * @brief Розподіл прогнозованої вартості одного гравця.
+     */
+    struct ValueForecast
+    {
+        int playerId = 0; ///< ID гравця.
+        std::string name; ///< Ім’я гравця.
+        double currentValue = 0.0; ///< Поточна CalculateValue().
+        double mean = 0.0; ///< Середнє прогнозованої вартості.
+        double p10 = 0.0; ///< 10-й перцентиль.
+        double p50 = 0.0; ///< Медіана.
+        double p90 = 0.0; ///< 90-й перцентиль.
+    };
+
+    /**
+     * @class ValueForecaster
+     * @brief Запускає N сценаріїв сезону для кожного гравця та збирає перцентилі.
+     *
+     * @details Кожен сценарій працює з копією гравця (Player::Clone()):
+     *          щосезону викликається CelebrateBirthday() (вікові ефекти
+     *          конкретного класу), у кожному матчі розігрується травма через
+     *          ReportInjury() (імовірність зростає з віком) та накопичується
+     *          статистика за історичною результативністю гравця.
+     *
+     *          Задачі (блоки сценаріїв одного гравця) виконує WorkStealingPool.
+     *          Кожен потік має власний генератор, який перезасівається зерном
+     *          (seed, гравець, сценарій), тож результат не залежить від
+     *          розкладу потоків; спільного змінюваного стану немає — кожна
+     *          задача пише лише у власний діапазон масиву результатів.
+     *          Під час прогнозу вихідних гравців змінювати не можна.
+     */
+    class ValueForecaster
+    {
+    private:
+        ForecastConfig config_; ///< Параметри прогнозу.
+
+    public:
+        /// @brief Конструктор із параметрами прогнозу.
+        explicit ValueForecaster(ForecastConfig config = {});
+
+        /**
+         * @brief Спрогнозувати вартість кожного гравця списку.
+         * @param players Гравці (nullptr пропускаються).
+         * @return Прогнози у порядку вхідного списку.
+         */
+        [[nodiscard]] std::vector<ValueForecast>
+        Forecast(const std::vector<std::shared_ptr<Player>>& players) const;
+    };
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "ContractedPlayer.h"
+#include "FreeAgent.h"
+#include "Goalkeeper.h"
+
+namespace FootballManagement
+{
+    class ClubManager;
+
+    /**
+     * @file VariantRoster.h
+     * @brief Склад клубу без поліморфних вказівників: окремий вектор на тип.
+     * @details Ієрархія гравців закрита (три final-класи), тож гравця можна
+     *          зберігати за значенням. Пакетні операції проходять кожен вектор
+     *          окремим циклом над конкретним типом — виклики методів
+     *          девіртуалізуються, дані лежать суцільно, dynamic_pointer_cast
+     *          не потрібен. Порядок гравців: спершу контрактні, далі вільні
+     *          агенти, далі воротарі (у порядку додавання всередині типу).
+     */
+
+    /// @brief Гравець будь-якого конкретного типу (за значенням).
+    using PlayerVariant = std::variant<ContractedPlayer, FreeAgent, Goalkeeper>;
+
+    /**
+     * @class VariantRoster
+     * @brief Контейнер гравців із вектором на кожен конкретний тип.
+     */
+    class VariantRoster
+    {
+    private:
+        std::vector<ContractedPlayer> contracted_; ///< Контрактні гравці.
+        std::vector<FreeAgent> freeAgents_; ///< Вільні агенти.
+        std::vector<Goalkeeper> goalkeepers_; ///< Воротарі.
+
+    public:
+        /// @brief Порожній склад.
+        VariantRoster() = default;
+
+        /**
+         * @brief Скопіювати склад ClubManager (розподіл за типами — один раз).
+         */
+        explicit VariantRoster(const ClubManager& club);
+
+        /// @brief Додати гравця у вектор його типу.
+        void Add(PlayerVariant player);
+
+        /// @brief Загальна кількість гравців.
+        [[nodiscard]] std::size_t Size() const;
+
+        /// @brief Видалити всіх гравців.
+        void Clear();
+
+        /// @brief Гравці одного типу.
+        template <typename T>
+        [[nodiscard]] const std::vector<T>& GetAll() const
+        {
+            if constexpr (std::is_same_v<T, ContractedPlayer>)
+                return contracted_;
+            else if constexpr (std::is_same_v<T, FreeAgent>)
+                return freeAgents_;
+            else
+            {
+                static_assert(std::is_same_v<T, Goalkeeper>,
+                              "Невідомий тип гравця.");
+                return goalkeepers_;
+            }
+        }
+
+        /**
+         * @brief Викликати @p f для кожного гравця з конкретним типом.
+         * @param f Узагальнена лямбда: [](const auto& player) { ... }.
+         */
+        template <typename F>
+        void ForEach(F&& f) const
+        {
+            for (const auto& p : contracted_) f(p);
+            for (const auto& p : freeAgents_) f(p);
+            for (const auto& p : goalkeepers_) f(p);
+        }
+
+        /// @brief Змінювальний варіант ForEach().
+        template <typename F>
+        void ForEach(F&& f)
+        {
+            for (auto& p : contracted_) f(p);
+            for (auto& p : freeAgents_) f(p);
+            for (auto& p : goalkeepers_) f(p);
+        }
+
+        /**
+         * @brief Знайти гравця за ID і викликати для нього @p f.
+         * @return false, якщо гравця немає.
+         */
+        template <typename F>
+        bool VisitById(int playerId, F&& f)
+        {
+            bool found = false;
+            auto visit = [&](auto& players)
+            {
+                for (auto& p : players)
+                {
+                    if (p.GetPlayerId() != playerId) continue;
+                    f(p);
+                    found = true;
+                    return;
+                }
+            };
+            visit(contracted_);
+            if (!found) visit(freeAgents_);
+            if (!found) visit(goalkeepers_);
+            return found;
+        }
+
+        /**
+         * @brief ID гравців, що задовольняють предикат.
+         * @param pred Узагальнена лямбда: [](const auto& player) -> bool.
+         */
+        template <typename F>
+        [[nodiscard]] std::vector<int> FilterIds(F&& pred) const
+        {
+            std::vector<int> ids;
+            ForEach([&](const auto& p)
+            {
+                if (pred(p)) ids.push_back(p.GetPlayerId());
+            });
+            return ids;
+        }
+
+    public:
+        /// @name Пакетні операції
+        /// @{
+
+        /// @brief Сума CalculateValue() усіх гравців.
+        [[nodiscard]] double TotalValue() const;
+
+        /// @brief Пари (ID, рейтинг ефективності) для всіх гравців.
+        [[nodiscard]] std::vector<std::pair<int, double>> RateAll() const;
+
+        /// @brief ID гравців, статус яких містить @p status (без регістру).
+        [[nodiscard]] std::vector<int>
+        FilterByStatus(const std::string& status) const;
+
+        /**
+         * @brief Рядки гравців у форматі players.txt.
+         * @details Сумісні з ClubManager::DeserializeAllPlayers().
+         */
+        [[nodiscard]] std::vector<std::string> SerializeAll() const;
+        /// @}
+    };
+}
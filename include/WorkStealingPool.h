@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @file WorkStealingPool.h
+     * @brief Пул робочих потоків із крадіжкою задач.
+     * @details Кожен потік має власну чергу: бере задачі з її кінця (LIFO,
+     *          «гарячий» кеш), а коли черга порожня — краде з початку черг
+     *          інших потоків (FIFO). Задачі, подані з робочого потоку, лягають
+     *          у його власну чергу; подані ззовні — розподіляються по колу.
+     */
+    class WorkStealingPool
+    {
+    private:
+        /// @brief Черга одного робочого потоку.
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues_; ///< Черги потоків.
+        std::vector<std::thread> workers_; ///< Робочі потоки.
+
+        std::mutex stateMutex_; ///< Захищає очікування та першу помилку.
+        std::condition_variable workAvailable_; ///< Є нові задачі / зупинка.
+        std::condition_variable idle_; ///< Усі задачі завершено.
+        std::atomic<std::size_t> pending_; ///< Подано, але ще не завершено.
+        std::atomic<std::size_t> queued_; ///< Лежать у чергах.
+        std::atomic<std::size_t> nextQueue_; ///< Кругова подача ззовні.
+        bool stopping_; ///< Пул завершує роботу.
+        std::exception_ptr firstError_; ///< Перший виняток із задачі.
+
+        /// @brief Головний цикл робочого потоку @p index.
+        void WorkerLoop(unsigned index);
+
+        /// @brief Взяти задачу зі своєї черги або вкрасти з чужої.
+        bool TryTake(unsigned index, std::function<void()>& task);
+
+    public:
+        /**
+         * @brief Створити пул.
+         * @param threadCount Кількість потоків; 0 — std::thread::hardware_concurrency().
+         */
+        explicit WorkStealingPool(unsigned threadCount = 0);
+
+        /// @brief Дочекатися черг і зупинити потоки.
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /// @brief Подати задачу на виконання.
+        void Submit(std::function<void()> task);
+
+        /**
+         * @brief Дочекатися завершення всіх поданих задач.
+         * @throws Перший виняток, кинутий будь-якою задачею.
+         */
+        void WaitIdle();
+
+        /// @brief Кількість робочих потоків.
+        [[nodiscard]] unsigned GetThreadCount() const;
+
+        /**
+         * @brief Індекс поточного робочого потоку.
+         * @return 0..GetThreadCount()-1 у робочому потоці, або -1 поза пулом.
+         */
+        [[nodiscard]] static int CurrentWorkerIndex();
+    };
+}
@@ -0,0 +1,439 @@
+#include "../include/AsyncFileEngine.h"
+#include "../include/WorkStealingPool.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define FOOTBALLMGMT_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#endif
+
+namespace
+{
+    using namespace FootballManagement;
+
+    /// Потоків у резервному пулі: операції чекають на диск, а не на CPU.
+    constexpr unsigned IO_POOL_THREADS = 4;
+
+    /// Код помилки останньої операції потоку (EIO, якщо errno не задано).
+    int LastError()
+    {
+        return errno != 0 ? errno : EIO;
+    }
+
+    /// fsync за шляхом; на системах без POSIX дані лише скидаються потоком.
+    int SyncPath(const std::string& path)
+    {
+#if defined(__unix__)
+        const int fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+        if (fd < 0) return LastError();
+        const int result = ::fsync(fd) == 0 ? 0 : LastError();
+        ::close(fd);
+        return result;
+#else
+        static_cast<void>(path);
+        return 0;
+#endif
+    }
+
+    /// Блокуюче виконання однієї операції (резервний рушій).
+    void RunBlocking(FileOp& op)
+    {
+        errno = 0;
+        if (op.kind == FileOpKind::Read)
+        {
+            std::ifstream in(op.path, std::ios::binary);
+            if (!in.is_open())
+            {
+                op.error = LastError();
+                return;
+            }
+            in.seekg(0, std::ios::end);
+            op.data.resize(static_cast<std::size_t>(in.tellg()));
+            in.seekg(0, std::ios::beg);
+            in.read(op.data.data(),
+                    static_cast<std::streamsize>(op.data.size()));
+            op.error = in ? 0 : LastError();
+            return;
+        }
+
+        {
+            std::ofstream out(op.path, std::ios::binary | std::ios::trunc);
+            if (!out.is_open())
+            {
+                op.error = LastError();
+                return;
+            }
+            out.write(op.data.data(),
+                      static_cast<std::streamsize>(op.data.size()));
+            out.flush();
+            if (!out)
+            {
+                op.error = LastError();
+                return;
+            }
+        }
+        op.error = op.sync ? SyncPath(op.path) : 0;
+    }
+
+    /**
+     * Резервний рушій: кожна операція пакета — задача пулу потоків.
+     */
+    class ThreadPoolFileEngine final : public AsyncFileEngine
+    {
+    private:
+        WorkStealingPool pool_;
+        std::mutex mutex_; ///< Один пакет за раз.
+
+    public:
+        ThreadPoolFileEngine()
+            : pool_(IO_POOL_THREADS)
+        {
+        }
+
+        bool Execute(std::vector<FileOp>& ops) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& op : ops)
+                pool_.Submit([&op]() { RunBlocking(op); });
+            pool_.WaitIdle();
+
+            return std::all_of(ops.begin(), ops.end(),
+                               [](const FileOp& op) { return op.error == 0; });
+        }
+
+        [[nodiscard]] const char* GetName() const override
+        {
+            return "thread_pool";
+        }
+    };
+
+#ifdef FOOTBALLMGMT_HAVE_IO_URING
+    /// Розмір черги подання (CQ ядро робить удвічі більшою).
+    constexpr unsigned URING_ENTRIES = 64;
+
+    /// Найбільший обсяг однієї операції читання/запису.
+    constexpr std::size_t URING_MAX_CHUNK = 1u << 30;
+
+    template <typename T>
+    T LoadAcquire(const T* p)
+    {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+
+    template <typename T>
+    void StoreRelease(T* p, T value)
+    {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * Рушій на io_uring: кільця подання/завершення спільні з ядром (mmap).
+     */
+    class IoUringFileEngine final : public AsyncFileEngine
+    {
+    private:
+        /// Етап операції пакета.
+        enum class Stage : std::uint8_t { Data, Sync, Done };
+
+        /// Стан операції пакета.
+        struct Pending
+        {
+            int fd = -1;
+            std::size_t done = 0; ///< Прочитано/записано байтів.
+            Stage stage = Stage::Done;
+        };
+
+        int ringFd_ = -1;
+        unsigned entries_ = 0;
+
+        void* sqRing_ = MAP_FAILED;
+        std::size_t sqRingSize_ = 0;
+        void* cqRing_ = MAP_FAILED;
+        std::size_t cqRingSize_ = 0;
+        io_uring_sqe* sqes_ = nullptr;
+        std::size_t sqesSize_ = 0;
+
+        unsigned* sqHead_ = nullptr;
+        unsigned* sqTail_ = nullptr;
+        unsigned sqMask_ = 0;
+        unsigned* sqArray_ = nullptr;
+        unsigned* cqHead_ = nullptr;
+        unsigned* cqTail_ = nullptr;
+        unsigned cqMask_ = 0;
+        io_uring_cqe* cqes_ = nullptr;
+
+        std::mutex mutex_; ///< Один пакет за раз.
+
+        /// Відобразити кільця ядра; false — io_uring недоступний.
+        bool Setup()
+        {
+            io_uring_params params{};
+            ringFd_ = static_cast<int>(
+                ::syscall(__NR_io_uring_setup, URING_ENTRIES, &params));
+            if (ringFd_ < 0) return false;
+            entries_ = params.sq_entries;
+
+            sqRingSize_ = params.sq_off.array +
+                params.sq_entries * sizeof(unsigned);
+            cqRingSize_ = params.cq_off.cqes +
+                params.cq_entries * sizeof(io_uring_cqe);
+            const bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single) sqRingSize_ = cqRingSize_ =
+                std::max(sqRingSize_, cqRingSize_);
+
+            sqRing_ = ::mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, ringFd_,
+                             IORING_OFF_SQ_RING);
+            if (sqRing_ == MAP_FAILED) return false;
+            cqRing_ = single
+                          ? sqRing_
+                          : ::mmap(nullptr, cqRingSize_,
+                                   PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_POPULATE, ringFd_,
+                                   IORING_OFF_CQ_RING);
+            if (cqRing_ == MAP_FAILED) return false;
+
+            sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqes = ::mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, ringFd_,
+                                IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) return false;
+            sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+            auto* sq = static_cast<char*>(sqRing_);
+            sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+            sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+            auto* cq = static_cast<char*>(cqRing_);
+            cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            return true;
+        }
+
+        /// Поставити наступний крок операції @p index у чергу подання.
+        void Prepare(std::size_t index, FileOp& op, const Pending& pending)
+        {
+            const unsigned tail = *sqTail_;
+            const unsigned slot = tail & sqMask_;
+            io_uring_sqe& sqe = sqes_[slot];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.fd = pending.fd;
+            sqe.user_data = index;
+
+            if (pending.stage == Stage::Sync)
+            {
+                sqe.opcode = IORING_OP_FSYNC;
+            }
+            else
+            {
+                sqe.opcode = op.kind == FileOpKind::Read
+                                 ? IORING_OP_READ
+                                 : IORING_OP_WRITE;
+                sqe.addr = reinterpret_cast<std::uint64_t>(
+                    op.data.data() + pending.done);
+                sqe.len = static_cast<std::uint32_t>(std::min(
+                    op.data.size() - pending.done, URING_MAX_CHUNK));
+                sqe.off = pending.done;
+            }
+
+            sqArray_[slot] = slot;
+            StoreRelease(sqTail_, tail + 1);
+        }
+
+        /// Наступний етап операції після завершення поточного.
+        static Stage NextStage(const FileOp& op, const Pending& pending)
+        {
+            if (pending.stage == Stage::Data && pending.done < op.data.size())
+                return Stage::Data;
+            if (pending.stage == Stage::Data && op.kind == FileOpKind::Write &&
+                op.sync)
+                return Stage::Sync;
+            return Stage::Done;
+        }
+
+        /// Відкрити файл операції та визначити перший етап.
+        static Pending Open(FileOp& op)
+        {
+            Pending pending;
+            if (op.kind == FileOpKind::Read)
+            {
+                pending.fd = ::open(op.path.c_str(), O_RDONLY | O_CLOEXEC);
+                struct stat info{};
+                if (pending.fd < 0 || ::fstat(pending.fd, &info) != 0)
+                {
+                    op.error = LastError();
+                    return pending;
+                }
+                op.data.resize(static_cast<std::size_t>(info.st_size));
+            }
+            else
+            {
+                pending.fd = ::open(op.path.c_str(),
+                                    O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                                    0644);
+                if (pending.fd < 0)
+                {
+                    op.error = LastError();
+                    return pending;
+                }
+            }
+
+            pending.stage = op.data.empty() ? Stage::Sync : Stage::Data;
+            if (pending.stage == Stage::Sync &&
+                (op.kind == FileOpKind::Read || !op.sync))
+                pending.stage = Stage::Done;
+            return pending;
+        }
+
+    public:
+        IoUringFileEngine() = default;
+
+        ~IoUringFileEngine() override
+        {
+            if (sqes_) ::munmap(sqes_, sqesSize_);
+            if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_)
+                ::munmap(cqRing_, cqRingSize_);
+            if (sqRing_ != MAP_FAILED) ::munmap(sqRing_, sqRingSize_);
+            if (ringFd_ >= 0) ::close(ringFd_);
+        }
+
+        IoUringFileEngine(const IoUringFileEngine&) = delete;
+        IoUringFileEngine& operator=(const IoUringFileEngine&) = delete;
+
+        /// Рушій або nullptr, якщо ядро не дозволяє io_uring.
+        static std::unique_ptr<AsyncFileEngine> TryCreate()
+        {
+            auto engine = std::make_unique<IoUringFileEngine>();
+            if (!engine->Setup()) return nullptr;
+            return engine;
+        }
+
+        bool Execute(std::vector<FileOp>& ops) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            std::vector<Pending> pending;
+            pending.reserve(ops.size());
+            std::deque<std::size_t> ready;
+            for (std::size_t i = 0; i < ops.size(); ++i)
+            {
+                ops[i].error = 0;
+                pending.push_back(Open(ops[i]));
+                if (pending[i].stage != Stage::Done) ready.push_back(i);
+            }
+
+            unsigned inFlight = 0;
+            while (!ready.empty() || inFlight > 0)
+            {
+                while (!ready.empty() && inFlight < entries_)
+                {
+                    const std::size_t i = ready.front();
+                    ready.pop_front();
+                    Prepare(i, ops[i], pending[i]);
+                    ++inFlight;
+                }
+
+                const unsigned toSubmit = *sqTail_ - LoadAcquire(sqHead_);
+                if (::syscall(__NR_io_uring_enter, ringFd_, toSubmit, 1u,
+                              IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+                    errno != EINTR)
+                {
+                    // Кільце недоступне: незавершені операції пакета невдалі.
+                    const int error = LastError();
+                    for (std::size_t i = 0; i < ops.size(); ++i)
+                        if (pending[i].stage != Stage::Done && ops[i].error == 0)
+                            ops[i].error = error;
+                    break;
+                }
+
+                unsigned head = *cqHead_;
+                const unsigned tail = LoadAcquire(cqTail_);
+                for (; head != tail; ++head)
+                {
+                    const io_uring_cqe& cqe = cqes_[head & cqMask_];
+                    const auto i = static_cast<std::size_t>(cqe.user_data);
+                    --inFlight;
+
+                    if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+                    {
+                        ready.push_back(i);
+                        continue;
+                    }
+                    if (cqe.res < 0)
+                    {
+                        ops[i].error = -cqe.res;
+                        pending[i].stage = Stage::Done;
+                        continue;
+                    }
+                    if (pending[i].stage == Stage::Data)
+                    {
+                        // Файл укоротився під час читання — беремо наявне.
+                        if (cqe.res == 0 && ops[i].kind == FileOpKind::Read)
+                            ops[i].data.resize(pending[i].done);
+                        else if (cqe.res == 0)
+                        {
+                            ops[i].error = EIO;
+                            pending[i].stage = Stage::Done;
+                            continue;
+                        }
+                        pending[i].done += static_cast<std::size_t>(cqe.res);
+                    }
+                    pending[i].stage = NextStage(ops[i], pending[i]);
+                    if (pending[i].stage != Stage::Done) ready.push_back(i);
+                }
+                StoreRelease(cqHead_, head);
+            }
+
+            for (const auto& p : pending)
+                if (p.fd >= 0) ::close(p.fd);
+
+            return std::all_of(ops.begin(), ops.end(),
+                               [](const FileOp& op) { return op.error == 0; });
+        }
+
+        [[nodiscard]] const char* GetName() const override
+        {
+            return "io_uring";
+        }
+    };
+#endif
+}
+
+namespace FootballManagement
+{
+    std::unique_ptr<AsyncFileEngine>
+    AsyncFileEngine::Create(AsyncFileBackend backend)
+    {
+#ifdef FOOTBALLMGMT_HAVE_IO_URING
+        if (backend != AsyncFileBackend::ThreadPool)
+            if (auto engine = IoUringFileEngine::TryCreate()) return engine;
+#endif
+        if (backend == AsyncFileBackend::IoUring) return nullptr;
+        return std::make_unique<ThreadPoolFileEngine>();
+    }
+
+    AsyncFileEngine& AsyncFileEngine::GetDefault()
+    {
+        static const std::unique_ptr<AsyncFileEngine> engine = Create();
+        return *engine;
+    }
+}
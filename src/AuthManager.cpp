@@ -1,4 +1,6 @@
 #include "../include/AuthManager.h"
+#include "../include/Console.h"
+#include "../include/Trace.h"
 
 #include <iostream>
 #include <algorithm>
@@ -26,14 +28,14 @@ namespace FootballManagement
     {
         if (registeredUsers_.count(userName) > 0)
         {
-            std::cout << "[ПОМИЛКА] Користувач \"" << userName
+            Console() << "[ПОМИЛКА] Користувач \"" << userName
                 << "\" уже існує.\n";
             return false;
         }
 
         if (userName.length() < 3 || password.length() < 6)
         {
-            std::cout <<
+            Console() <<
                 "[ПОМИЛКА] Логін має бути ≥ 3 символів, пароль ≥ 6 символів.\n";
             return false;
         }
@@ -42,13 +44,13 @@ namespace FootballManagement
         {
             auto newUser = std::make_shared<User>(userName, password, userRole);
             registeredUsers_[userName] = newUser;
-            std::cout << "[УСПІХ] Користувача \"" << userName <<
+            Console() << "[УСПІХ] Користувача \"" << userName <<
                 "\" зареєстровано.\n";
             return true;
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Неможливо зареєструвати користувача: "
+            Console() << "[ПОМИЛКА] Неможливо зареєструвати користувача: "
                 << e.what() << "\n";
             return false;
         }
@@ -60,7 +62,7 @@ namespace FootballManagement
         const auto it = registeredUsers_.find(userName);
         if (it == registeredUsers_.end())
         {
-            std::cout << "[ПОМИЛКА] Користувача \"" << userName <<
+            Console() << "[ПОМИЛКА] Користувача \"" << userName <<
                 "\" не знайдено.\n";
             return false;
         }
@@ -69,13 +71,13 @@ namespace FootballManagement
         if (user->VerifyPassword(password))
         {
             currentUser_ = user;
-            std::cout << "[ВХІД] Вітаємо, " << userName << "! Роль: "
+            Console() << "[ВХІД] Вітаємо, " << userName << "! Роль: "
                 << (user->IsAdmin() ? "Адміністратор" : "Користувач")
                 << ".\n";
             return true;
         }
 
-        std::cout << "[ПОМИЛКА] Невірний пароль для користувача \"" << userName
+        Console() << "[ПОМИЛКА] Невірний пароль для користувача \"" << userName
             << "\".\n";
         return false;
     }
@@ -84,15 +86,48 @@ namespace FootballManagement
     {
         currentUser_ = std::make_shared<User>("guest", "", UserRole::Guest);
         guestSessionActive_ = true;
-        std::cout << "[ІНФО] Вхід як гість. Доступ обмежений.\n";
+        Console() << "[ІНФО] Вхід як гість. Доступ обмежений.\n";
         return true;
     }
 
+    std::shared_ptr<User> AuthManager::Authenticate(
+        const std::string& userName, const std::string& password) const
+    {
+        const auto it = registeredUsers_.find(userName);
+        if (it == registeredUsers_.end()) return nullptr;
+        return it->second->VerifyPassword(password) ? it->second : nullptr;
+    }
+
+    std::string AuthManager::CreateSession(const std::string& userName,
+                                           const std::string& password)
+    {
+        const auto user = Authenticate(userName, password);
+        if (!user) return {};
+        return sessions_.Issue(user->GetUserName(), user->GetUserRole(),
+                               user->GetPermissions());
+    }
+
+    std::optional<SessionInfo> AuthManager::ResolveSession(
+        const std::string& token) const
+    {
+        return sessions_.Resolve(token);
+    }
+
+    bool AuthManager::EndSession(const std::string& token)
+    {
+        return sessions_.Revoke(token);
+    }
+
+    SessionCache& AuthManager::GetSessions()
+    {
+        return sessions_;
+    }
+
     void AuthManager::Logout()
     {
         if (IsLoggedIn())
         {
-            std::cout << "[ІНФО] Користувач \"" << currentUser_->GetUserName()
+            Console() << "[ІНФО] Користувач \"" << currentUser_->GetUserName()
                 << "\" вийшов із системи.\n";
         }
         currentUser_ = std::make_shared<User>();
@@ -101,16 +136,16 @@ namespace FootballManagement
 
     bool AuthManager::DeleteUser(const std::string& userName)
     {
-        if (!IsLoggedIn() || !currentUser_->IsAdmin())
+        if (!CurrentUserCan(Permission::ManageUsers))
         {
-            std::cout <<
+            Console() <<
                 "[ВІДМОВА] Лише адміністратор може видаляти користувачів.\n";
             return false;
         }
 
         if (userName == currentUser_->GetUserName())
         {
-            std::cout <<
+            Console() <<
                 "[ПОМИЛКА] Неможливо видалити свій активний обліковий запис.\n";
             return false;
         }
@@ -118,12 +153,13 @@ namespace FootballManagement
         const std::size_t erased = registeredUsers_.erase(userName);
         if (erased > 0)
         {
-            std::cout << "[УСПІХ] Користувача \"" << userName <<
+            sessions_.RevokeUser(userName);
+            Console() << "[УСПІХ] Користувача \"" << userName <<
                 "\" видалено.\n";
             return true;
         }
 
-        std::cout << "[ПОМИЛКА] Користувача \"" << userName <<
+        Console() << "[ПОМИЛКА] Користувача \"" << userName <<
             "\" не знайдено.\n";
         return false;
     }
@@ -131,9 +167,9 @@ namespace FootballManagement
     bool AuthManager::ChangeUserRole(const std::string& userName,
                                      UserRole newRole)
     {
-        if (!IsLoggedIn() || !currentUser_->IsAdmin())
+        if (!CurrentUserCan(Permission::ManageUsers))
         {
-            std::cout <<
+            Console() <<
                 "[ВІДМОВА] Тільки адміністратор може змінювати ролі.\n";
             return false;
         }
@@ -141,33 +177,136 @@ namespace FootballManagement
         auto it = registeredUsers_.find(userName);
         if (it == registeredUsers_.end())
         {
-            std::cout << "[ПОМИЛКА] Користувача \"" << userName <<
+            Console() << "[ПОМИЛКА] Користувача \"" << userName <<
                 "\" не знайдено.\n";
             return false;
         }
 
         it->second->SetRole(newRole);
-        std::cout << "[ІНФО] Роль користувача \"" << userName <<
+        sessions_.RevokeUser(userName);
+        Console() << "[ІНФО] Роль користувача \"" << userName <<
             "\" змінено.\n";
         return true;
     }
 
+    bool AuthManager::AssignCustomRole(const std::string& userName,
+                                       const std::string& roleName)
+    {
+        if (!CurrentUserCan(Permission::ManageUsers))
+        {
+            Console() <<
+                "[ВІДМОВА] Тільки адміністратор може призначати ролі.\n";
+            return false;
+        }
+
+        const auto it = registeredUsers_.find(userName);
+        if (it == registeredUsers_.end())
+        {
+            Console() << "[ПОМИЛКА] Користувача \"" << userName <<
+                "\" не знайдено.\n";
+            return false;
+        }
+
+        PermissionSet permissions = NO_PERMISSIONS;
+        if (!roleName.empty())
+        {
+            const auto role = customRoles_.find(roleName);
+            if (role == customRoles_.end())
+            {
+                Console() << "[ПОМИЛКА] Роль \"" << roleName <<
+                    "\" не визначено у " << ROLES_CONFIG_FILE << ".\n";
+                return false;
+            }
+            permissions = role->second;
+        }
+
+        it->second->SetCustomRole(roleName, permissions);
+        sessions_.RevokeUser(userName);
+        Console() << "[ІНФО] Користувачу \"" << userName
+            << "\" призначено роль \""
+            << (roleName.empty() ? "стандартна" : roleName) << "\".\n";
+        return true;
+    }
+
+    std::size_t AuthManager::LoadCustomRoles(
+        const std::vector<std::string>& lines)
+    {
+        customRoles_.clear();
+        for (const auto& line : lines)
+        {
+            if (line.empty() || line.front() == '#') continue;
+
+            try
+            {
+                std::string name;
+                const PermissionSet permissions = ParseRoleLine(line, name);
+                customRoles_[name] = permissions;
+            }
+            catch (const std::exception& e)
+            {
+                Console() << "[ПОМИЛКА] Пропущено рядок ролі: " << e.what()
+                    << "\n";
+            }
+        }
+
+        for (const auto& [_, user] : registeredUsers_)
+            ResolvePermissions(*user);
+
+        Console() << "[ІНФО] Завантажено власних ролей: " << customRoles_.size()
+            << "\n";
+        return customRoles_.size();
+    }
+
+    void AuthManager::ResolvePermissions(User& user) const
+    {
+        const std::string roleName = user.GetCustomRole();
+        if (roleName.empty()) return;
+
+        const auto it = customRoles_.find(roleName);
+        if (it != customRoles_.end())
+        {
+            user.SetCustomRole(roleName, it->second);
+            return;
+        }
+
+        // Невідома роль: назву зберігаємо (файл не втрачає призначення),
+        // але права — лише стандартні для базової ролі.
+        user.SetCustomRole(roleName, DefaultPermissions(user.GetUserRole()));
+    }
+
+    bool AuthManager::CurrentUserCan(Permission permission) const
+    {
+        return IsLoggedIn() && currentUser_->HasPermission(permission);
+    }
+
     void AuthManager::ViewAllUsers() const
     {
-        if (!IsLoggedIn() || !currentUser_->IsAdmin())
+        if (!CurrentUserCan(Permission::ManageUsers))
         {
-            std::cout <<
+            Console() <<
                 "[ВІДМОВА] Лише адміністратор може переглядати список користувачів.\n";
             return;
         }
 
-        std::cout << "\n=== СПИСОК КОРИСТУВАЧІВ (" << registeredUsers_.size() <<
+        Console() << "\n=== СПИСОК КОРИСТУВАЧІВ (" << registeredUsers_.size() <<
             ") ===\n";
         for (const auto& [name, user] : registeredUsers_)
         {
             user->ShowUserInfo();
         }
-        std::cout << "===========================================\n";
+        Console() << "===========================================\n";
+    }
+
+    std::shared_ptr<User> AuthManager::FindUser(
+        const std::string& userName) const
+    {
+        const auto it = registeredUsers_.find(userName);
+        return it == registeredUsers_.end() ? nullptr : it->second;
+    }
+
+    int AuthManager::GetMigratedUserCount() const
+    {
+        return migratedUsers_;
     }
 
     std::shared_ptr<User> AuthManager::GetCurrentUser() const
@@ -187,9 +326,20 @@ namespace FootballManagement
 
     std::string AuthManager::Serialize() const
     {
+        // Сортування за логіном: файл не залежить від порядку хеш-таблиці.
+        std::vector<const User*> users;
+        users.reserve(registeredUsers_.size());
+        for (const auto& [_, user] : registeredUsers_)
+            users.push_back(user.get());
+        std::sort(users.begin(), users.end(),
+                  [](const User* a, const User* b)
+                  {
+                      return a->GetUserName() < b->GetUserName();
+                  });
+
         std::stringstream ss;
         bool first = true;
-        for (const auto& [_, user] : registeredUsers_)
+        for (const User* user : users)
         {
             if (!first) ss << "\n";
             ss << user->Serialize();
@@ -209,13 +359,13 @@ namespace FootballManagement
             if (!u->GetUserName().empty())
             {
                 registeredUsers_[u->GetUserName()] = u;
-                std::cout << "[ІНФО] Додано користувача \"" << u->GetUserName()
+                Console() << "[ІНФО] Додано користувача \"" << u->GetUserName()
                     << "\" з десеріалізації одного запису.\n";
             }
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Не вдалося десеріалізувати користувача: "
+            Console() << "[ПОМИЛКА] Не вдалося десеріалізувати користувача: "
                 << e.what() << "\n";
         }
     }
@@ -223,7 +373,10 @@ namespace FootballManagement
     void AuthManager::DeserializeAllUsers(
         const std::vector<std::string>& userDatas)
     {
+        FM_TRACE_SCOPE("AuthManager::DeserializeAllUsers");
         registeredUsers_.clear();
+        sessions_.Clear();
+        migratedUsers_ = 0;
         int count = 0;
 
         for (const auto& line : userDatas)
@@ -237,13 +390,15 @@ namespace FootballManagement
 
                 if (!u->GetUserName().empty())
                 {
+                    ResolvePermissions(*u);
+                    if (u->WasMigrated()) ++migratedUsers_;
                     registeredUsers_[u->GetUserName()] = u;
                     ++count;
                 }
             }
             catch (const std::exception& e)
             {
-                std::cout <<
+                Console() <<
                     "[ПОМИЛКА] Пропущено рядок користувача через помилку: "
                     << e.what() << "\n";
             }
@@ -251,13 +406,16 @@ namespace FootballManagement
 
         if (count == 0)
         {
-            std::cout << "[ПОПЕРЕДЖЕННЯ] Користувачів не знайдено. "
+            Console() << "[ПОПЕРЕДЖЕННЯ] Користувачів не знайдено. "
                 "Створюється обліковий запис адміністратора за замовчуванням.\n";
             Register(DEFAULT_ADMIN_LOGIN, DEFAULT_ADMIN_PASSWORD,
                      UserRole::Admin);
         }
 
-        std::cout << "[ІНФО] Завантажено користувачів: " << count << "\n";
+        Console() << "[ІНФО] Завантажено користувачів: " << count << "\n";
+        if (migratedUsers_ > 0)
+            Console() << "[ІНФО] Паролі " << migratedUsers_
+                << " користувачів переведено з відкритого тексту на хеш.\n";
         currentUser_ = std::make_shared<User>();
     }
 }
@@ -0,0 +1,270 @@
+#include "../include/BatchProcessor.h"
+#include "../include/Console.h"
+#include "../include/Goalkeeper.h"
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    std::string Trim(const std::string& s)
+    {
+        const auto first = s.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return {};
+        const auto last = s.find_last_not_of(" \t\r");
+        return s.substr(first, last - first + 1);
+    }
+
+    std::vector<std::string> SplitFields(const std::string& line)
+    {
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, '|')) fields.push_back(Trim(field));
+        return fields;
+    }
+
+    int ParseInt(const std::string& s, const char* what)
+    {
+        try
+        {
+            std::size_t used = 0;
+            const int value = std::stoi(s, &used);
+            if (used == s.size()) return value;
+        }
+        catch (const std::exception&)
+        {
+        }
+        throw std::invalid_argument(std::string("некоректне значення «")
+                                    + what + "»: " + s);
+    }
+
+    double ParseDouble(const std::string& s, const char* what)
+    {
+        try
+        {
+            std::size_t used = 0;
+            const double value = std::stod(s, &used);
+            if (used == s.size()) return value;
+        }
+        catch (const std::exception&)
+        {
+        }
+        throw std::invalid_argument(std::string("некоректне значення «")
+                                    + what + "»: " + s);
+    }
+
+    Position ParsePosition(const std::string& s)
+    {
+        if (s == "GK" || s == "0") return Position::Goalkeeper;
+        if (s == "DEF" || s == "1") return Position::Defender;
+        if (s == "MID" || s == "2") return Position::Midfielder;
+        if (s == "FWD" || s == "3") return Position::Forward;
+        throw std::invalid_argument("невідома позиція: " + s);
+    }
+
+    void RequireFields(const std::vector<std::string>& fields,
+                       std::size_t count, const char* usage)
+    {
+        if (fields.size() != count)
+            throw std::invalid_argument(std::string("очікується ") + usage);
+    }
+}
+
+namespace FootballManagement
+{
+    BatchProcessor::BatchProcessor(ClubManager& club)
+        : club_(club)
+    {
+    }
+
+    BatchSummary BatchProcessor::Run(std::istream& script)
+    {
+        summary_ = BatchSummary{};
+        pendingRemoval_.clear();
+
+        std::string line;
+        std::size_t lineNo = 0;
+        while (std::getline(script, line))
+        {
+            ++lineNo;
+            const std::string trimmed = Trim(line);
+            if (trimmed.empty() || trimmed[0] == '#') continue;
+
+            ++summary_.lines;
+            try
+            {
+                ApplyLine(SplitFields(trimmed));
+                ++summary_.applied;
+            }
+            catch (const std::exception& e)
+            {
+                summary_.errors.push_back("Рядок " + std::to_string(lineNo)
+                                          + ": " + e.what());
+            }
+        }
+
+        club_.RemovePlayers(pendingRemoval_);
+        pendingRemoval_.clear();
+
+        Console() << "[ІНФО] Сценарій виконано: " << summary_.applied << " з "
+            << summary_.lines << " операцій.\n";
+        return summary_;
+    }
+
+    void BatchProcessor::ApplyLine(const std::vector<std::string>& fields)
+    {
+        const std::string& command = fields.front();
+        if (command == "add") Add(fields);
+        else if (command == "remove") Remove(fields);
+        else if (command == "revalue") Revalue(fields);
+        else if (command == "sign") Sign(fields);
+        else if (command == "transfer") Transfer(fields);
+        else throw std::invalid_argument("невідома команда: " + command);
+    }
+
+    std::shared_ptr<Player> BatchProcessor::Find(int playerId) const
+    {
+        if (pendingRemoval_.count(playerId)) return nullptr;
+        return club_.FindPlayerById(playerId);
+    }
+
+    void BatchProcessor::Add(const std::vector<std::string>& fields)
+    {
+        if (fields.size() < 2)
+            throw std::invalid_argument("очікується add|тип|...");
+
+        const std::string& type = fields[1];
+        const std::size_t expected = type == "goalkeeper" ? 9 : 12;
+        if (type != "goalkeeper" && type != "contracted" && type != "free")
+            throw std::invalid_argument(
+                "тип гравця має бути goalkeeper, contracted або free");
+        if (fields.size() != expected)
+            throw std::invalid_argument(
+                "add|" + type + " очікує " + std::to_string(expected - 1)
+                + " полів після команди");
+
+        const std::string& name = fields[2];
+        const int age = ParseInt(fields[3], "вік");
+        const std::string& nationality = fields[4];
+        const std::string& origin = fields[5];
+        const double height = ParseDouble(fields[6], "зріст");
+        const double weight = ParseDouble(fields[7], "вага");
+        const double value = ParseDouble(fields[8], "вартість");
+
+        std::shared_ptr<Player> player;
+        if (type == "goalkeeper")
+        {
+            player = std::make_shared<Goalkeeper>(
+                name, age, nationality, origin, height, weight, value);
+        }
+        else if (type == "contracted")
+        {
+            player = std::make_shared<ContractedPlayer>(
+                name, age, nationality, origin, height, weight, value,
+                ParsePosition(fields[9]), ParseDouble(fields[10], "зарплата"),
+                fields[11]);
+        }
+        else
+        {
+            player = std::make_shared<FreeAgent>(
+                name, age, nationality, origin, height, weight, value,
+                ParsePosition(fields[9]),
+                ParseDouble(fields[10], "очікувана зарплата"), fields[11]);
+        }
+
+        // Без права edit_players AddPlayer лише повідомляє і не додає.
+        club_.AddPlayer(player);
+        if (club_.FindPlayerById(player->GetPlayerId()) != player)
+            throw std::invalid_argument("не вдалося додати " + name);
+        ++summary_.added;
+    }
+
+    void BatchProcessor::Remove(const std::vector<std::string>& fields)
+    {
+        RequireFields(fields, 2, "remove|ID");
+        const int id = ParseInt(fields[1], "ID");
+        if (!Find(id))
+            throw std::invalid_argument("гравця з ID " + std::to_string(id)
+                                        + " немає у складі");
+
+        pendingRemoval_.insert(id);
+        ++summary_.removed;
+    }
+
+    void BatchProcessor::Revalue(const std::vector<std::string>& fields)
+    {
+        RequireFields(fields, 3, "revalue|ID або *|відсоток");
+        const double percent = ParseDouble(fields[2], "відсоток");
+
+        if (fields[1] == "*")
+        {
+            for (const auto& p : club_.GetAll())
+            {
+                if (!p || pendingRemoval_.count(p->GetPlayerId())) continue;
+                p->UpdateMarketValue(percent);
+                ++summary_.revalued;
+            }
+            return;
+        }
+
+        const int id = ParseInt(fields[1], "ID");
+        const auto player = Find(id);
+        if (!player)
+            throw std::invalid_argument("гравця з ID " + std::to_string(id)
+                                        + " немає у складі");
+
+        player->UpdateMarketValue(percent);
+        ++summary_.revalued;
+    }
+
+    void BatchProcessor::Sign(const std::vector<std::string>& fields)
+    {
+        RequireFields(fields, 4, "sign|ID|зарплата|YYYY-MM-DD");
+        const int id = ParseInt(fields[1], "ID");
+        const double salary = ParseDouble(fields[2], "зарплата");
+
+        const auto agent = std::dynamic_pointer_cast<FreeAgent>(Find(id));
+        if (!agent)
+            throw std::invalid_argument("вільного агента з ID "
+                                        + std::to_string(id)
+                                        + " немає у складі");
+        if (!agent->IsAvailableForNegotiation())
+            throw std::invalid_argument(agent->GetName()
+                                        + " не веде переговорів");
+        if (salary < agent->GetExpectedSalary())
+            throw std::invalid_argument("зарплата нижча за очікувану "
+                                        + agent->GetName());
+        if (!club_.SignFreeAgent(agent, salary, fields[3]))
+            throw std::invalid_argument("не вдалося підписати "
+                                        + agent->GetName());
+        ++summary_.signings;
+    }
+
+    void BatchProcessor::Transfer(const std::vector<std::string>& fields)
+    {
+        RequireFields(fields, 4, "transfer|ID|клуб|сума");
+        const int id = ParseInt(fields[1], "ID");
+        const double fee = ParseDouble(fields[3], "сума");
+        if (fields[2].empty() || fields[2] == club_.GetClubName())
+            throw std::invalid_argument("некоректний клуб-покупець");
+
+        const auto player = std::dynamic_pointer_cast<ContractedPlayer>(
+            Find(id));
+        if (!player)
+            throw std::invalid_argument("контрактного гравця з ID "
+                                        + std::to_string(id)
+                                        + " немає у складі");
+        if (!player->IsListedForTransfer() || fee < player->GetTransferFee())
+            throw std::invalid_argument(player->GetName()
+                                        + " не продається за цю суму");
+
+        player->TransferToClub(fields[2], fee);
+        club_.SetTransferBudget(club_.GetTransferBudget() + fee);
+        pendingRemoval_.insert(id);
+        ++summary_.transfers;
+    }
+}
@@ -1,27 +1,101 @@
 #include "../include/ClubManager.h"
+#include "../include/Console.h"
 #include "../include/Goalkeeper.h"
+#include "../include/Metrics.h"
+#include "../include/Trace.h"
 
 
 #include <iostream>
+#include <charconv>
 #include <sstream>
 #include <algorithm>
 #include <stdexcept>
 #include <iomanip>
-#include <cctype>
+#include <ctime>
+#include <unordered_set>
+
+namespace
+{
+    using FootballManagement::Player;
+
+    /// Створює гравця за міткою role і розбирає рядок; nullptr — невідома мітка.
+    std::shared_ptr<Player> DecodePlayer(std::string_view role,
+                                         const std::string& row)
+    {
+        using namespace FootballManagement;
+        std::shared_ptr<Player> p;
+        if (role == "FreeAgent")
+            p = std::make_shared<FreeAgent>();
+        else if (role == "Goalkeeper")
+            p = std::make_shared<Goalkeeper>();
+        else if (role == "ContractedPlayer")
+            p = std::make_shared<ContractedPlayer>();
+        else
+            return nullptr;
+
+        p->Deserialize(row);
+        return p;
+    }
+
+    /// Формує дату у форматі YYYY-MM-DD (день не перевіряється на календарність).
+    std::string FormatIsoDate(int year, int month, int day)
+    {
+        std::ostringstream ss;
+        ss << std::setfill('0') << std::setw(4) << year << '-'
+            << std::setw(2) << month << '-' << std::setw(2) << day;
+        return ss.str();
+    }
+
+    /// Позначка розбору відкладених записів; другий одночасний розбір — помилка.
+    class MaterializeScope
+    {
+    private:
+        std::atomic<bool>& busy_;
+
+    public:
+        explicit MaterializeScope(std::atomic<bool>& busy)
+            : busy_(busy)
+        {
+            if (busy_.exchange(true, std::memory_order_acquire))
+                throw std::logic_error(
+                    "Відкладений склад читається з кількох потоків.");
+        }
+
+        ~MaterializeScope() { busy_.store(false, std::memory_order_release); }
+
+        MaterializeScope(const MaterializeScope&) = delete;
+        MaterializeScope& operator=(const MaterializeScope&) = delete;
+    };
+}
 
 namespace FootballManagement
 {
     ClubManager::ClubManager(const std::string& name, double budget)
         : players_(),
           transferBudget_(budget),
-          clubName_(name)
+          clubName_(name),
+          playersById_(),
+          maxPlayerId_(1000),
+          journal_(),
+          actorPermissions_(ALL_PERMISSIONS),
+          nextChangeSequence_(1),
+          nextSubscriberId_(1)
     {
-        std::cout << "[ІНФО] Менеджер клубу \"" << clubName_
+        Console() << "[ІНФО] Менеджер клубу \"" << clubName_
             << "\" ініціалізований (Бюджет: " << std::fixed <<
             std::setprecision(2)
             << transferBudget_ << " €).\n";
     }
 
+    ClubManager::~ClubManager() noexcept
+    {
+        // Розібрані відкладені записи є лише в індексі, не в players_.
+        for (const auto& [_, p] : playersById_)
+            if (p) DetachPlayer(*p);
+        for (const auto& p : players_)
+            if (p) DetachPlayer(*p);
+    }
+
     double ClubManager::GetTransferBudget() const { return transferBudget_; }
 
     void ClubManager::SetTransferBudget(double budget)
@@ -35,34 +109,89 @@ namespace FootballManagement
 
     int ClubManager::GenerateUniqueId() const
     {
-        int maxId = 1000;
-        for (const auto& p : players_)
-        {
-            if (p && p->GetPlayerId() > maxId)
-                maxId = p->GetPlayerId();
-        }
-        return maxId + 1;
+        return maxPlayerId_ + 1;
     }
 
-    void ClubManager::AddPlayer(std::shared_ptr<Player> p)
+    void ClubManager::InsertPlayer(const std::shared_ptr<Player>& p)
     {
-        if (!p)
-            throw std::invalid_argument("Неможливо додати порожнього гравця.");
-
         if (p->GetPlayerId() == 0)
             p->SetPlayerId(GenerateUniqueId());
+        if (p->GetPlayerId() > maxPlayerId_)
+            maxPlayerId_ = p->GetPlayerId();
 
         players_.push_back(p);
-        std::cout << "[УСПІХ] Додано гравця: " << p->GetName()
+        playersById_[p->GetPlayerId()] = p;
+        if (auto cp = std::dynamic_pointer_cast<ContractedPlayer>(p))
+            IndexContract(cp);
+
+        p->SetObserver(this);
+        PublishChange(PlayerChangeKind::Added, p->GetPlayerId(),
+                      p->GetVersion(), ALL_PLAYER_FIELDS);
+    }
+
+    void ClubManager::DetachPlayer(Player& p)
+    {
+        if (p.GetObserver() == this) p.SetObserver(nullptr);
+    }
+
+    bool ClubManager::IsOwnedElsewhere(const Player& p) const
+    {
+        return p.GetObserver() != nullptr && p.GetObserver() != this;
+    }
+
+    std::shared_ptr<Player> ClubManager::FindPlayerById(int playerId) const
+    {
+        const auto it = playersById_.find(playerId);
+        if (it != playersById_.end()) return it->second;
+        return lazyRecords_.empty() ? nullptr : MaterializeRecord(playerId);
+    }
+
+    void ClubManager::SetActorPermissions(PermissionSet permissions)
+    {
+        actorPermissions_ = permissions;
+    }
+
+    PermissionSet ClubManager::GetActorPermissions() const
+    {
+        return actorPermissions_;
+    }
+
+    bool ClubManager::Permits(Permission permission) const
+    {
+        if (HasPermission(actorPermissions_, permission)) return true;
+        Console() << "[ВІДМОВА] Недостатньо прав для цієї операції.\n";
+        return false;
+    }
+
+    void ClubManager::AddPlayer(std::shared_ptr<Player> p)
+    {
+        if (!p)
+            throw std::invalid_argument("Неможливо додати порожнього гравця.");
+        if (IsOwnedElsewhere(*p))
+            throw std::invalid_argument(
+                "Гравець уже у складі іншого клубу.");
+        if (!Permits(Permission::EditPlayers)) return;
+        if (p->GetObserver() == this)
+        {
+            Console() << "[ПОМИЛКА] " << p->GetName()
+                << " уже у складі клубу.\n";
+            return;
+        }
+
+        if (p->GetPlayerId() != 0 && FindPlayerById(p->GetPlayerId()))
+            p->SetPlayerId(GenerateUniqueId()); // зайнятий ID
+        InsertPlayer(p);
+        Console() << "[УСПІХ] Додано гравця: " << p->GetName()
             << " (ID: " << p->GetPlayerId() << ").\n";
     }
 
     void ClubManager::ViewAllPlayers() const
     {
-        std::cout << "\n=== СКЛАД КЛУБУ \"" << clubName_ << "\" ===\n";
+        EnsureLoaded();
+        Console() << "\n=== СКЛАД КЛУБУ \"" << clubName_ << "\" ===\n";
         if (players_.empty())
         {
-            std::cout << "Немає зареєстрованих гравців.\n";
+            Console() << "Немає зареєстрованих гравців.\n";
             return;
         }
 
@@ -71,13 +200,25 @@ namespace FootballManagement
             if (!p) continue;
 
             if (p) p->ShowInfo();
-            std::cout << "--------------------------------------------\n";
+            Console() << "--------------------------------------------\n";
         }
     }
 
     void ClubManager::RemovePlayers(int playerId)
     {
+        if (!Permits(Permission::EditPlayers)) return;
+
+        EnsureLoaded();
         const auto before = players_.size();
+        if (const auto p = FindPlayerById(playerId))
+        {
+            DetachPlayer(*p);
+            PublishChange(PlayerChangeKind::Removed, p->GetPlayerId(),
+                          p->GetVersion(), ALL_PLAYER_FIELDS);
+        }
+        UnindexContract(playerId);
+        dirtyPlayerIds_.erase(playerId);
+        playersById_.erase(playerId);
         players_.erase(std::remove_if(players_.begin(), players_.end(),
                                       [playerId](
                                       const std::shared_ptr<Player>& p)
@@ -88,14 +229,49 @@ namespace FootballManagement
                        players_.end());
 
         if (players_.size() < before)
-            std::cout << "[УСПІХ] Гравця з ID " << playerId << " видалено.\n";
+            Console() << "[УСПІХ] Гравця з ID " << playerId << " видалено.\n";
         else
-            std::cout << "[НЕ ЗНАЙДЕНО] Гравця з ID " << playerId <<
+            Console() << "[НЕ ЗНАЙДЕНО] Гравця з ID " << playerId <<
                 " немає у складі.\n";
     }
 
+    std::size_t ClubManager::RemovePlayers(
+        const std::unordered_set<int>& playerIds)
+    {
+        if (playerIds.empty() || !Permits(Permission::EditPlayers)) return 0;
+
+        EnsureLoaded();
+        for (const int id : playerIds)
+        {
+            if (const auto p = FindPlayerById(id))
+            {
+                DetachPlayer(*p);
+                PublishChange(PlayerChangeKind::Removed, p->GetPlayerId(),
+                              p->GetVersion(), ALL_PLAYER_FIELDS);
+            }
+            UnindexContract(id);
+            dirtyPlayerIds_.erase(id);
+            playersById_.erase(id);
+        }
+
+        const auto before = players_.size();
+        players_.erase(std::remove_if(players_.begin(), players_.end(),
+                                      [&playerIds](
+                                      const std::shared_ptr<Player>& p)
+                                      {
+                                          return p && playerIds.count(
+                                              p->GetPlayerId()) > 0;
+                                      }),
+                       players_.end());
+
+        const auto removed = before - players_.size();
+        Console() << "[УСПІХ] Видалено гравців: " << removed << ".\n";
+        return removed;
+    }
+
     void ClubManager::SortByPerformanceRating()
     {
+        EnsureLoaded();
         std::sort(players_.begin(), players_.end(),
                   [](const std::shared_ptr<Player>& a,
                      const std::shared_ptr<Player>& b)
@@ -105,63 +281,55 @@ namespace FootballManagement
                       return a->CalculatePerformanceRating() > b->
                           CalculatePerformanceRating();
                   });
-        std::cout <<
+        Console() <<
             "[ІНФО] Гравців відсортовано за рейтингом ефективності (спадно).\n";
     }
 
     std::vector<std::shared_ptr<Player>>
     ClubManager::SearchByName(const std::string& q) const
     {
+        const ScopedLatency latency(MetricHistogram::SearchByName);
         std::vector<std::shared_ptr<Player>> results;
 
-        std::string lowerQuery = q;
-        std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(),
-                       [](unsigned char c)
-                       {
-                           return static_cast<char>(std::tolower(c));
-                       });
+        // Відкладені записи порівнюються за ім'ям з індексу й розбираються
+        // лише при збігу.
+        for (const int id : lazyOrder_)
+        {
+            const auto lazy = lazyRecords_.find(id);
+            if (lazy != lazyRecords_.end())
+            {
+                if (!ContainsIgnoreCase(lazy->second.name, q)) continue;
+                if (auto p = MaterializeRecord(id))
+                    results.push_back(std::move(p));
+                continue;
+            }
+            const auto it = playersById_.find(id);
+            if (it != playersById_.end() && it->second &&
+                ContainsIgnoreCase(it->second->GetName(), q))
+                results.push_back(it->second);
+        }
 
         for (const auto& p : players_)
         {
             if (!p) continue;
-            std::string name = p->GetName();
-            std::transform(name.begin(), name.end(), name.begin(),
-                           [](unsigned char c)
-                           {
-                               return static_cast<char>(std::tolower(c));
-                           });
-
-            if (name.find(lowerQuery) != std::string::npos)
-                results.push_back(p);
+            if (ContainsIgnoreCase(p->GetName(), q)) results.push_back(p);
         }
+        MetricsRegistry::GetInstance().Increment(MetricCounter::SearchResults,
+                                                 results.size());
         return results;
     }
 
     std::vector<std::shared_ptr<Player>>
     ClubManager::FilterByStatus(const std::string& status) const
     {
+        const ScopedLatency latency(MetricHistogram::FilterByStatus);
+        EnsureLoaded();
         std::vector<std::shared_ptr<Player>> filtered;
 
-        std::string lowerStatus = status;
-        std::transform(lowerStatus.begin(), lowerStatus.end(),
-                       lowerStatus.begin(),
-                       [](unsigned char c)
-                       {
-                           return static_cast<char>(std::tolower(c));
-                       });
-
         for (const auto& p : players_)
         {
             if (!p) continue;
-            std::string playerStatus = p->GetStatus();
-            std::transform(playerStatus.begin(), playerStatus.end(),
-                           playerStatus.begin(),
-                           [](unsigned char c)
-                           {
-                               return static_cast<char>(std::tolower(c));
-                           });
-
-            if (playerStatus.find(lowerStatus) != std::string::npos)
+            if (ContainsIgnoreCase(p->GetStatus(), status))
                 filtered.push_back(p);
         }
 
@@ -172,63 +340,598 @@ namespace FootballManagement
                                     double salaryOffer,
                                     const std::string& contractUntil)
     {
+        const ScopedLatency latency(MetricHistogram::SignFreeAgent);
         if (!player)
         {
-            std::cout <<
+            Console() <<
                 "[ПОМИЛКА] Неможливо підписати: гравець не визначений.\n";
             return false;
         }
+        if (!Permits(Permission::SignAgents)) return false;
+
+        if (IsOwnedElsewhere(*player))
+        {
+            Console() << "[ПОМИЛКА] " << player->GetName()
+                << " у складі іншого клубу.\n";
+            return false;
+        }
 
         if (salaryOffer <= 0.0)
         {
-            std::cout << "[ПОМИЛКА] Некоректна сума зарплати.\n";
+            Console() << "[ПОМИЛКА] Некоректна сума зарплати.\n";
             return false;
         }
 
         if (salaryOffer > transferBudget_)
         {
-            std::cout <<
+            Console() <<
                 "[ПОМИЛКА] Недостатньо коштів у бюджеті для підписання.\n";
             return false;
         }
 
         if (!player->NegotiateOffer(salaryOffer))
         {
-            std::cout << "[ВІДМОВА] Гравець відхилив пропозицію.\n";
+            Console() << "[ВІДМОВА] Гравець відхилив пропозицію.\n";
             return false;
         }
 
         player->AcceptContract(clubName_);
         transferBudget_ -= salaryOffer;
 
-        bool present = false;
-        for (const auto& p : players_)
+        // Право SignAgents включає зарахування підписаного гравця у склад.
+        if (const auto holder = FindPlayerById(player->GetPlayerId());
+            holder != player)
         {
-            if (p && p->GetPlayerId() == player->GetPlayerId())
-            {
-                present = true;
-                break;
-            }
+            if (holder) player->SetPlayerId(GenerateUniqueId()); // зайнятий ID
+            InsertPlayer(player);
         }
-        if (!present) AddPlayer(player);
 
-        std::cout << "[УСПІХ] Вільного агента " << player->GetName()
+        Console() << "[УСПІХ] Вільного агента " << player->GetName()
             << " підписано до клубу \"" << clubName_ << "\" "
             << "до " << contractUntil << ". Залишок бюджету: "
             << std::fixed << std::setprecision(2) << transferBudget_ << " €.\n";
+        MetricsRegistry::GetInstance().Increment(
+            MetricCounter::SigningsCompleted);
         return true;
     }
 
+    TransactionRecord ClubManager::ApplyTransaction(
+        const std::vector<RosterOperation>& batch)
+    {
+        TransactionRecord record;
+        record.batchId = static_cast<int>(journal_.size()) + 1;
+        record.operationCount = batch.size();
+        record.budgetBefore = transferBudget_;
+        record.budgetAfter = transferBudget_;
+
+        auto finish = [&](bool committed, const std::string& message)
+        {
+            record.committed = committed;
+            record.message = message;
+            journal_.push_back(record);
+            Console() << "[ТРАНЗАКЦІЯ] #" << record.batchId << " "
+                << (committed ? "ПІДТВЕРДЖЕНО" : "ВІДХИЛЕНО") << ": "
+                << message << " | Бюджет: " << std::fixed
+                << std::setprecision(2) << record.budgetBefore << " → "
+                << record.budgetAfter << " €.\n";
+            return record;
+        };
+
+        if (!HasPermission(actorPermissions_, Permission::SignAgents))
+            return finish(false, "недостатньо прав (sign_agents)");
+
+        // Фаза 1: перевірка всього пакету без зміни стану.
+        std::vector<std::shared_ptr<Player>> resolved(batch.size());
+        std::unordered_set<const Player*> touched;
+        double ledger = transferBudget_;
+
+        for (std::size_t i = 0; i < batch.size(); ++i)
+        {
+            const auto& op = batch[i];
+            const std::string where = "операція " + std::to_string(i + 1) +
+                ": ";
+
+            switch (op.kind)
+            {
+            case TransactionKind::Signing:
+                {
+                    const auto fa = std::dynamic_pointer_cast<FreeAgent>(
+                        op.player);
+                    if (!fa)
+                        return finish(false, where + "очікується вільний агент");
+                    if (!fa->IsAvailableForNegotiation())
+                        return finish(false, where + fa->GetName() +
+                                      " не веде переговорів");
+                    if (IsOwnedElsewhere(*fa))
+                        return finish(false, where + fa->GetName() +
+                                      " у складі іншого клубу");
+                    if (op.amount <= 0.0 || op.amount < fa->
+                        GetExpectedSalary())
+                        return finish(false, where + fa->GetName() +
+                                      " відхилить пропозицію");
+                    if (!ContractDetails::ValidateIsoDate(op.detail))
+                        return finish(false, where +
+                                      "некоректна дата контракту");
+                    resolved[i] = fa;
+                    ledger -= op.amount;
+                    break;
+                }
+            case TransactionKind::TransferIn:
+                {
+                    const auto cp = std::dynamic_pointer_cast<ContractedPlayer>(
+                        op.player);
+                    if (!cp)
+                        return finish(false, where +
+                                      "очікується контрактний гравець");
+                    if (!cp->IsListedForTransfer() ||
+                        op.amount < cp->GetTransferFee())
+                        return finish(false, where + cp->GetName() +
+                                      " недоступний за цю суму");
+                    if (FindPlayerById(cp->GetPlayerId()) == cp)
+                        return finish(false, where + cp->GetName() +
+                                      " вже у складі");
+                    if (IsOwnedElsewhere(*cp))
+                        return finish(false, where + cp->GetName() +
+                                      " у складі іншого клубу");
+                    if (clubName_.empty())
+                        return finish(false, where +
+                                      "у клубу немає назви для контракту");
+                    resolved[i] = cp;
+                    ledger -= op.amount;
+                    break;
+                }
+            case TransactionKind::TransferOut:
+                {
+                    // Продаж прибирає гравця зі складу.
+                    if (!HasPermission(actorPermissions_,
+                                       Permission::EditPlayers))
+                        return finish(false, where +
+                                      "недостатньо прав (edit_players)");
+                    const auto cp = std::dynamic_pointer_cast<ContractedPlayer>(
+                        FindPlayerById(op.playerId));
+                    if (!cp)
+                        return finish(false, where + "контрактного гравця ID " +
+                                      std::to_string(op.playerId) +
+                                      " немає у складі");
+                    if (!cp->IsListedForTransfer() ||
+                        op.amount < cp->GetTransferFee())
+                        return finish(false, where + cp->GetName() +
+                                      " не продається за цю суму");
+                    if (op.detail.empty() || op.detail == clubName_)
+                        return finish(false, where +
+                                      "некоректний клуб-покупець");
+                    resolved[i] = cp;
+                    ledger += op.amount;
+                    break;
+                }
+            case TransactionKind::SalaryChange:
+                {
+                    const auto cp = std::dynamic_pointer_cast<ContractedPlayer>(
+                        FindPlayerById(op.playerId));
+                    if (!cp)
+                        return finish(false, where + "контрактного гравця ID " +
+                                      std::to_string(op.playerId) +
+                                      " немає у складі");
+                    if (op.amount <= 0.0)
+                        return finish(false, where +
+                                      "зарплата повинна бути додатною");
+                    resolved[i] = cp;
+                    ledger -= op.amount - cp->GetContractDetails().GetSalary();
+                    break;
+                }
+            }
+
+            if (!touched.insert(resolved[i].get()).second)
+                return finish(false, where + resolved[i]->GetName() +
+                              " вже бере участь у пакеті");
+            if (ledger < 0.0)
+                return finish(false, where + "бюджет вичерпано");
+        }
+
+        // Фаза 2: застосування. Фаза 1 перевірила всі передумови викликів
+        // нижче (назви клубів, суми, типи, ID), тож вони не кидають винятків
+        // і пакет не може зупинитися на півдорозі.
+        std::unordered_set<int> departed;
+        int signings = 0, transfersIn = 0, transfersOut = 0, salaries = 0;
+
+        for (std::size_t i = 0; i < batch.size(); ++i)
+        {
+            const auto& op = batch[i];
+            switch (op.kind)
+            {
+            case TransactionKind::Signing:
+                {
+                    const auto fa = std::static_pointer_cast<FreeAgent>(
+                        resolved[i]);
+                    fa->AcceptContract(clubName_);
+                    if (const auto holder = FindPlayerById(fa->GetPlayerId());
+                        holder != fa)
+                    {
+                        if (holder) fa->SetPlayerId(GenerateUniqueId());
+                        InsertPlayer(fa);
+                    }
+                    ++signings;
+                    break;
+                }
+            case TransactionKind::TransferIn:
+                {
+                    const auto cp = std::static_pointer_cast<ContractedPlayer>(
+                        resolved[i]);
+                    cp->TransferToClub(clubName_, op.amount);
+                    if (FindPlayerById(cp->GetPlayerId()))
+                        cp->SetPlayerId(GenerateUniqueId()); // зайнятий ID
+                    InsertPlayer(cp);
+                    ++transfersIn;
+                    break;
+                }
+            case TransactionKind::TransferOut:
+                {
+                    const auto cp = std::static_pointer_cast<ContractedPlayer>(
+                        resolved[i]);
+                    cp->TransferToClub(op.detail, op.amount);
+                    departed.insert(cp->GetPlayerId());
+                    ++transfersOut;
+                    break;
+                }
+            case TransactionKind::SalaryChange:
+                {
+                    std::static_pointer_cast<ContractedPlayer>(resolved[i])->
+                        ChangeSalary(op.amount);
+                    ++salaries;
+                    break;
+                }
+            }
+        }
+
+        if (!departed.empty())
+        {
+            ScopedConsoleMute mute; // підсумок друкує finish()
+            RemovePlayers(departed);
+        }
+
+        transferBudget_ = ledger;
+        record.budgetAfter = ledger;
+        return finish(true, "підписань " + std::to_string(signings) +
+                      ", купівель " + std::to_string(transfersIn) +
+                      ", продажів " + std::to_string(transfersOut) +
+                      ", змін зарплат " + std::to_string(salaries));
+    }
+
+    const std::vector<TransactionRecord>& ClubManager::GetJournal() const
+    {
+        return journal_;
+    }
+
+    void ClubManager::IndexContract(const std::shared_ptr<ContractedPlayer>& p)
+    {
+        if (!p) return;
+        UnindexContract(p->GetPlayerId());
+
+        CalendarEntry entry;
+        entry.player = p;
+
+        const ContractDetails& details = p->GetContractDetails();
+        if (!p->IsContractTerminated() && details.IsContractValid())
+            entry.contractIt = contractExpiryIndex_.emplace(
+                details.GetContractUntil(), p);
+        if (details.IsPlayerOnLoan() && !details.GetLoanEndDate().empty())
+            entry.loanIt = loanEndIndex_.emplace(details.GetLoanEndDate(), p);
+
+        contractedById_[p->GetPlayerId()] = std::move(entry);
+    }
+
+    void ClubManager::UnindexContract(int playerId)
+    {
+        const auto it = contractedById_.find(playerId);
+        if (it == contractedById_.end()) return;
+
+        if (it->second.contractIt)
+            contractExpiryIndex_.erase(*it->second.contractIt);
+        if (it->second.loanIt)
+            loanEndIndex_.erase(*it->second.loanIt);
+        contractedById_.erase(it);
+    }
+
+    std::shared_ptr<ContractedPlayer>
+    ClubManager::FindContracted(int playerId) const
+    {
+        const auto it = contractedById_.find(playerId);
+        if (it != contractedById_.end()) return it->second.player;
+        if (lazyRecords_.count(playerId) == 0) return nullptr;
+        return std::dynamic_pointer_cast<ContractedPlayer>(
+            MaterializeRecord(playerId));
+    }
+
+    std::vector<std::shared_ptr<ContractedPlayer>>
+    ClubManager::CollectRange(const DateIndex& index, const std::string& from,
+                              const std::string& to)
+    {
+        std::vector<std::shared_ptr<ContractedPlayer>> result;
+        if (to < from) return result;
+
+        // ISO-дати впорядковуються лексикографічно так само, як хронологічно.
+        const auto first = index.lower_bound(from);
+        const auto last = index.upper_bound(to);
+        for (auto it = first; it != last; ++it)
+            result.push_back(it->second);
+        return result;
+    }
+
+    bool ClubManager::ExtendPlayerContract(int playerId,
+                                           const std::string& newDate,
+                                           double newSalary)
+    {
+        if (!Permits(Permission::EditPlayers)) return false;
+
+        const auto p = FindContracted(playerId);
+        if (!p)
+        {
+            Console() << "[НЕ ЗНАЙДЕНО] Контрактного гравця з ID " << playerId
+                << " немає у складі.\n";
+            return false;
+        }
+
+        bool ok = true;
+        try
+        {
+            p->ExtendedContract(newDate, newSalary);
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося продовжити контракт: "
+                << e.what() << "\n";
+            // Дата могла змінитися до винятку, а сповіщення не надійшло.
+            IndexContract(p);
+            ok = false;
+        }
+
+        return ok;
+    }
+
+    bool ClubManager::SendPlayerOnLoan(int playerId,
+                                       const std::string& otherClub,
+                                       const std::string& endDate)
+    {
+        if (!Permits(Permission::EditPlayers)) return false;
+
+        const auto p = FindContracted(playerId);
+        if (!p)
+        {
+            Console() << "[НЕ ЗНАЙДЕНО] Контрактного гравця з ID " << playerId
+                << " немає у складі.\n";
+            return false;
+        }
+
+        try
+        {
+            p->SendOnLoan(otherClub, endDate);
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося оформити оренду: "
+                << e.what() << "\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ClubManager::ReturnPlayerFromLoan(int playerId)
+    {
+        if (!Permits(Permission::EditPlayers)) return false;
+
+        const auto p = FindContracted(playerId);
+        if (!p)
+        {
+            Console() << "[НЕ ЗНАЙДЕНО] Контрактного гравця з ID " << playerId
+                << " немає у складі.\n";
+            return false;
+        }
+
+        p->ReturnFromLoan();
+        return true;
+    }
+
+    bool ClubManager::TerminatePlayerContract(int playerId,
+                                              const std::string& reason)
+    {
+        if (!Permits(Permission::EditPlayers)) return false;
+
+        const auto p = FindContracted(playerId);
+        if (!p)
+        {
+            Console() << "[НЕ ЗНАЙДЕНО] Контрактного гравця з ID " << playerId
+                << " немає у складі.\n";
+            return false;
+        }
+
+        p->TerminateContract(reason);
+        return true;
+    }
+
+    void ClubManager::ReindexPlayerId(Player& p, int oldId)
+    {
+        const int newId = p.GetPlayerId();
+        const auto it = playersById_.find(oldId);
+        if (it == playersById_.end() || it->second.get() != &p) return;
+
+        const auto shared = it->second;
+        playersById_.erase(it);
+        playersById_[newId] = shared;
+        if (newId > maxPlayerId_) maxPlayerId_ = newId;
+        if (dirtyPlayerIds_.erase(oldId) > 0) dirtyPlayerIds_.insert(newId);
+        if (!lazyOrder_.empty()) // лише поки є відкладені записи
+            std::replace(lazyOrder_.begin(), lazyOrder_.end(), oldId, newId);
+
+        if (contractedById_.count(oldId) > 0)
+        {
+            UnindexContract(oldId);
+            IndexContract(std::static_pointer_cast<ContractedPlayer>(shared));
+        }
+    }
+
+    void ClubManager::PublishChange(PlayerChangeKind kind, int playerId,
+                                    std::uint64_t version,
+                                    PlayerFieldMask fields)
+    {
+        PlayerChange change;
+        change.sequence = nextChangeSequence_++;
+        change.playerId = playerId;
+        change.version = version;
+        change.fields = fields;
+        change.kind = kind;
+
+        changeLog_.push_back(change);
+        if (changeLog_.size() > CHANGE_LOG_CAPACITY) changeLog_.pop_front();
+
+        for (const auto& subscriber : changeSubscribers_)
+            subscriber.second(change);
+    }
+
+    void ClubManager::OnPlayerChanged(Player& player, PlayerFieldMask fields)
+    {
+        if (HasPlayerField(fields, PlayerField::Contract))
+        {
+            if (const auto cp = FindContracted(player.GetPlayerId()))
+                IndexContract(cp);
+        }
+
+        dirtyPlayerIds_.insert(player.GetPlayerId());
+        PublishChange(PlayerChangeKind::Updated, player.GetPlayerId(),
+                      player.GetVersion(), fields);
+    }
+
+    void ClubManager::OnPlayerIdChanged(Player& player, int oldId)
+    {
+        ReindexPlayerId(player, oldId);
+    }
+
+    int ClubManager::SubscribeChanges(
+        std::function<void(const PlayerChange&)> handler)
+    {
+        if (!handler)
+            throw std::invalid_argument("Обробник змін не може бути порожнім.");
+        const int id = nextSubscriberId_++;
+        changeSubscribers_.emplace_back(id, std::move(handler));
+        return id;
+    }
+
+    bool ClubManager::UnsubscribeChanges(int subscriptionId)
+    {
+        const auto it = std::find_if(
+            changeSubscribers_.begin(), changeSubscribers_.end(),
+            [subscriptionId](const auto& s) { return s.first == subscriptionId; });
+        if (it == changeSubscribers_.end()) return false;
+        changeSubscribers_.erase(it);
+        return true;
+    }
+
+    std::uint64_t ClubManager::GetLastChangeSequence() const
+    {
+        return nextChangeSequence_ - 1;
+    }
+
+    std::optional<std::vector<PlayerChange>>
+    ClubManager::GetChangesSince(std::uint64_t sequence) const
+    {
+        // Події нумеруються без пропусків, тож стрічка — суцільний діапазон.
+        const std::uint64_t oldest = changeLog_.empty()
+                                         ? nextChangeSequence_
+                                         : changeLog_.front().sequence;
+        if (sequence + 1 < oldest) return std::nullopt;
+
+        std::vector<PlayerChange> result;
+        if (sequence + 1 >= nextChangeSequence_) return result;
+        const auto first = changeLog_.begin() +
+            static_cast<std::ptrdiff_t>(sequence + 1 - oldest);
+        result.assign(first, changeLog_.end());
+        return result;
+    }
+
+    std::vector<std::shared_ptr<Player>> ClubManager::GetDirtyPlayers() const
+    {
+        std::vector<std::shared_ptr<Player>> result;
+        result.reserve(dirtyPlayerIds_.size());
+        for (const int id : dirtyPlayerIds_)
+            if (auto p = FindPlayerById(id)) result.push_back(std::move(p));
+        return result;
+    }
+
+    void ClubManager::ClearDirtyPlayers()
+    {
+        for (const int id : dirtyPlayerIds_)
+            if (const auto p = FindPlayerById(id)) p->ClearDirtyFields();
+        dirtyPlayerIds_.clear();
+    }
+
+    std::vector<std::shared_ptr<ContractedPlayer>>
+    ClubManager::GetContractsExpiringBetween(const std::string& from,
+                                             const std::string& to) const
+    {
+        EnsureLoaded();
+        return CollectRange(contractExpiryIndex_, from, to);
+    }
+
+    std::vector<std::shared_ptr<ContractedPlayer>>
+    ClubManager::GetContractsExpiringSoon(int months) const
+    {
+        if (months < 0) return {};
+
+        std::time_t t = std::time(nullptr);
+        std::tm* now = std::localtime(&t);
+        const int cy = now->tm_year + 1900;
+        const int cm = now->tm_mon + 1;
+
+        // Та сама місячна гранулярність, що й у ContractDetails::IsExpiringSoon().
+        const int endIndex = cy * 12 + (cm - 1) + months;
+        EnsureLoaded();
+        return CollectRange(contractExpiryIndex_,
+                            FormatIsoDate(cy, cm, 1),
+                            FormatIsoDate(endIndex / 12, endIndex % 12 + 1,
+                                          31));
+    }
+
+    std::vector<std::shared_ptr<ContractedPlayer>>
+    ClubManager::GetLoansEndingBetween(const std::string& from,
+                                       const std::string& to) const
+    {
+        EnsureLoaded();
+        return CollectRange(loanEndIndex_, from, to);
+    }
+
+    std::vector<std::shared_ptr<ContractedPlayer>>
+    ClubManager::GetLoansEndingInMonth(int year, int month) const
+    {
+        if (month < 1 || month > 12) return {};
+        EnsureLoaded();
+        return CollectRange(loanEndIndex_, FormatIsoDate(year, month, 1),
+                            FormatIsoDate(year, month, 31));
+    }
+
     std::string ClubManager::Serialize() const
     {
+        FM_TRACE_SCOPE("ClubManager::Serialize");
         std::ostringstream ss;
         ss << clubName_ << "," << std::fixed << std::setprecision(2) <<
             transferBudget_ << "\n";
+        for (const int id : lazyOrder_)
+        {
+            const auto lazy = lazyRecords_.find(id);
+            if (lazy != lazyRecords_.end())
+            {
+                ss << lazy->second.text << "\n"; // нерозібраний — як був
+                continue;
+            }
+            const auto it = playersById_.find(id);
+            if (it != playersById_.end() && it->second)
+                ss << it->second->Serialize() << "\n";
+        }
         for (const auto& p : players_)
         {
             if (!p) continue;
             ss << p->Serialize() << "\n";
         }
+        for (const auto& row : unreadableRecords_) ss << row << "\n";
         return ss.str();
     }
 
@@ -248,98 +951,269 @@ namespace FootballManagement
             if (std::getline(header, budgetStr))
                 transferBudget_ = std::stod(budgetStr);
 
-            std::cout << "[ІНФО] Завантажено клуб: " << clubName_
+            Console() << "[ІНФО] Завантажено клуб: " << clubName_
                 << " | Бюджет: " << std::fixed << std::setprecision(2)
                 << transferBudget_ << " €.\n";
 
             if (ss.peek() != std::stringstream::traits_type::eof())
             {
-                std::cout <<
+                Console() <<
                     "[ПОПЕРЕДЖЕННЯ] Для повного складу використайте DeserializeAllPlayers().\n";
             }
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Помилка під час розбору даних клубу: "
+            Console() << "[ПОМИЛКА] Помилка під час розбору даних клубу: "
                 << e.what() << "\n";
         }
     }
 
-    void ClubManager::DeserializeAllPlayers(
-        const std::vector<std::string>& lines)
+    void ClubManager::ClearRoster()
     {
-        players_.clear();
-
-        if (lines.empty())
+        for (const auto& [id, p] : playersById_)
         {
-            std::cout << "[ПОПЕРЕДЖЕННЯ] Порожні дані — гравців не знайдено.\n";
-            return;
+            if (!p) continue;
+            DetachPlayer(*p);
+            PublishChange(PlayerChangeKind::Removed, id, p->GetVersion(),
+                          ALL_PLAYER_FIELDS);
         }
+        for (const auto& [id, _] : lazyRecords_)
+            PublishChange(PlayerChangeKind::Removed, id, 0, ALL_PLAYER_FIELDS);
 
+        dirtyPlayerIds_.clear();
+        players_.clear();
+        playersById_.clear();
+        maxPlayerId_ = 1000;
+        contractExpiryIndex_.clear();
+        loanEndIndex_.clear();
+        contractedById_.clear();
+        lazyOrder_.clear();
+        lazyRecords_.clear();
+        lazySource_.clear();
+        unreadableRecords_.clear();
+    }
+
+    void ClubManager::ApplyHeader(const std::string& line)
+    {
         try
         {
-            std::stringstream ss(lines[0]);
+            std::stringstream ss(line);
             std::string budgetStr;
             std::getline(ss, clubName_, ',');
             if (std::getline(ss, budgetStr))
                 transferBudget_ = std::stod(budgetStr);
 
-            std::cout << "[ІНФО] Завантажено дані клубу: " << clubName_
+            Console() << "[ІНФО] Завантажено дані клубу: " << clubName_
                 << " | Бюджет: " << std::fixed << std::setprecision(2)
                 << transferBudget_ << " €.\n";
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Помилка при розборі шапки клубу: " << e.
+            Console() << "[ПОМИЛКА] Помилка при розборі шапки клубу: " << e.
                 what() << "\n";
         }
+    }
+
+    void ClubManager::DeserializeAllPlayers(
+        const std::vector<std::string>& lines)
+    {
+        FM_TRACE_SCOPE("ClubManager::DeserializeAllPlayers");
+        ClearRoster();
+
+        if (lines.empty())
+        {
+            Console() << "[ПОПЕРЕДЖЕННЯ] Порожні дані — гравців не знайдено.\n";
+            return;
+        }
+
+        ApplyHeader(lines[0]);
 
         for (size_t i = 1; i < lines.size(); ++i)
         {
             const std::string& row = lines[i];
             if (row.empty()) continue;
 
-            auto findRole = [&](const std::string& s)-> std::string
+            const auto p = DecodeRecord(row);
+            if (!p)
             {
-                const std::string k = "\"role\":\"";
-                const auto pos = s.find(k);
-                if (pos == std::string::npos) return {};
-                auto start = pos + k.size();
-                auto end = s.find('\"', start);
-                if (end == std::string::npos) return {};
-                return s.substr(start, end - start);
-            };
-
-            const std::string role = findRole(row);
-            std::shared_ptr<Player> p;
-
-            if (role == "FreeAgent")
+                Console() <<
+                    "[ПОПЕРЕДЖЕННЯ] Невідомий role, рядок пропущено.\n";
+                continue;
+            }
+
+            InsertPlayer(p);
+        }
+    }
+
+    std::shared_ptr<Player> ClubManager::DecodeRecord(const std::string& row)
+    {
+        return DecodePlayer(FindTextValue(row, "role"), row);
+    }
+
+    void ClubManager::ResetFromHeader(const std::string& header)
+    {
+        ClearRoster();
+        if (!header.empty()) ApplyHeader(header);
+    }
+
+    bool ClubManager::AdoptLoadedPlayer(const std::shared_ptr<Player>& p)
+    {
+        if (!p || (p->GetPlayerId() != 0 &&
+                   playersById_.count(p->GetPlayerId()) != 0))
+            return false;
+        InsertPlayer(p);
+        return true;
+    }
+
+    void ClubManager::IndexAllPlayers(std::string content)
+    {
+        FM_TRACE_SCOPE("ClubManager::IndexAllPlayers");
+        ClearRoster();
+
+        // Записи вказують у lazySource_, тож індекс будується вже після
+        // переміщення буфера.
+        lazySource_ = std::move(content);
+        const std::string_view source = lazySource_;
+        const auto expected = static_cast<std::size_t>(
+            std::count(source.begin(), source.end(), '\n'));
+        lazyOrder_.reserve(expected);
+        lazyRecords_.reserve(expected);
+
+        std::size_t pos = 0;
+        bool header = true;
+        while (pos < source.size())
+        {
+            std::size_t end = source.find('\n', pos);
+            if (end == std::string_view::npos) end = source.size();
+            std::string_view row = source.substr(pos, end - pos);
+            pos = end + 1;
+            if (!row.empty() && row.back() == '\r') row.remove_suffix(1);
+            if (row.empty()) continue;
+
+            if (header)
             {
-                auto obj = std::make_shared<FreeAgent>();
-                obj->Deserialize(row);
-                p = obj;
+                ApplyHeader(std::string(row));
+                header = false;
+                continue;
             }
-            else if (role == "Goalkeeper")
+
+            // Один прохід по парам запису до трьох потрібних ключів.
+            LazyRecord record{row, {}, {}};
+            std::string_view idText;
+            std::size_t at = 0;
+            std::string_view key;
+            std::string_view value;
+            int found = 0;
+            while (found < 3 && SchemaDetail::NextPair(row, at, key, value))
             {
-                auto obj = std::make_shared<Goalkeeper>();
-                obj->Deserialize(row);
-                p = obj;
+                if (key == "id") idText = value;
+                else if (key == "name") record.name = value;
+                else if (key == "role") record.role = value;
+                else continue;
+                ++found;
             }
-            else if (role == "ContractedPlayer")
+
+            if (record.role != "FreeAgent" && record.role != "Goalkeeper" &&
+                record.role != "ContractedPlayer")
             {
-                auto obj = std::make_shared<ContractedPlayer>();
-                obj->Deserialize(row);
-                p = obj;
+                Console() << "[ПОПЕРЕДЖЕННЯ] Невідомий role, рядок збережеться "
+                    "у файлі без змін.\n";
+                unreadableRecords_.emplace_back(row);
+                continue;
             }
-            else
+
+            int id = 0;
+            std::from_chars(idText.data(), idText.data() + idText.size(), id);
+            if (id <= 0) id = GenerateUniqueId();
+            if (lazyRecords_.count(id) > 0)
             {
-                std::cout <<
-                    "[ПОПЕРЕДЖЕННЯ] Невідомий role, рядок пропущено.\n";
+                Console() << "[ПОПЕРЕДЖЕННЯ] Повторний ID " << id
+                    << ", рядок збережеться у файлі без змін.\n";
+                unreadableRecords_.emplace_back(row);
                 continue;
             }
 
-            if (p->GetPlayerId() == 0) p->SetPlayerId(GenerateUniqueId());
-            players_.push_back(std::move(p));
+            if (id > maxPlayerId_) maxPlayerId_ = id;
+            lazyOrder_.push_back(id);
+            lazyRecords_.emplace(id, record);
+            PublishChange(PlayerChangeKind::Added, id, 0, ALL_PLAYER_FIELDS);
+        }
+
+        if (header)
+            Console() << "[ПОПЕРЕДЖЕННЯ] Порожні дані — гравців не знайдено.\n";
+    }
+
+    std::shared_ptr<Player> ClubManager::MaterializeRecord(int playerId) const
+    {
+        const auto it = lazyRecords_.find(playerId);
+        if (it == lazyRecords_.end()) return nullptr;
+
+        // Логічно склад не змінюється: гравець уже належав клубу. Зміна
+        // індексів із const-методу безпечна лише в одному потоці.
+        const MaterializeScope scope(materializing_);
+        auto& self = const_cast<ClubManager&>(*this);
+        std::shared_ptr<Player> p;
+        try
+        {
+            p = DecodePlayer(it->second.role, std::string(it->second.text));
         }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося розібрати гравця з ID "
+                << playerId << ": " << e.what() << "\n";
+        }
+        // Нерозібраний запис не зникає: Serialize() запише його як був.
+        if (!p) self.unreadableRecords_.emplace_back(it->second.text);
+        self.lazyRecords_.erase(it);
+        if (!p) return nullptr;
+
+        if (p->GetPlayerId() != playerId) p->SetPlayerId(playerId);
+        self.playersById_[playerId] = p;
+        if (auto cp = std::dynamic_pointer_cast<ContractedPlayer>(p))
+            self.IndexContract(cp);
+        p->SetObserver(&self);
+        return p;
+    }
+
+    void ClubManager::LoadPendingRecords() const
+    {
+        FM_TRACE_SCOPE("ClubManager::LoadPendingRecords");
+        auto& self = const_cast<ClubManager&>(*this);
+
+        std::vector<std::shared_ptr<Player>> ordered;
+        ordered.reserve(lazyOrder_.size() + players_.size());
+        for (const int id : lazyOrder_)
+        {
+            auto p = lazyRecords_.count(id) > 0
+                         ? MaterializeRecord(id)
+                         : FindPlayerById(id);
+            if (p) ordered.push_back(std::move(p));
+        }
+        // Гравці, додані після завантаження, — у кінці, як і при повному.
+        const MaterializeScope scope(materializing_);
+        for (auto& p : self.players_) ordered.push_back(std::move(p));
+
+        self.players_ = std::move(ordered);
+        self.lazyOrder_.clear();
+        self.lazyOrder_.shrink_to_fit();
+        self.lazyRecords_.clear();
+        self.lazySource_.clear();
+        self.lazySource_.shrink_to_fit();
+    }
+
+    std::size_t ClubManager::GetPlayerCount() const
+    {
+        // Розібрані відкладені записи вже в lazyOrder_, а не в players_.
+        return lazyOrder_.size() + players_.size();
+    }
+
+    std::size_t ClubManager::GetPendingCount() const
+    {
+        return lazyRecords_.size();
+    }
+
+    std::size_t ClubManager::GetUnreadableCount() const
+    {
+        return unreadableRecords_.size();
     }
 }
@@ -0,0 +1,247 @@
+#include "../include/ClubService.h"
+
+#include <iostream>
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    std::vector<std::string> SplitFields(const std::string& request)
+    {
+        std::vector<std::string> fields;
+        std::stringstream ss(request);
+        std::string field;
+        while (std::getline(ss, field, '|')) fields.push_back(field);
+        if (fields.empty()) fields.emplace_back();
+        return fields;
+    }
+
+    std::string Error(const std::string& reason)
+    {
+        return "ERR|" + reason;
+    }
+
+    constexpr std::size_t MAX_TOP_RATED = 10'000;
+
+    /// Готовий текст складу для FileManager::SaveBatch().
+    class RosterSnapshot : public FootballManagement::IFileHandler
+    {
+    public:
+        explicit RosterSnapshot(std::string text) : text_(std::move(text)) {}
+
+        [[nodiscard]] std::string Serialize() const override { return text_; }
+
+        void Deserialize(const std::string&) override
+        {
+            throw std::logic_error("Знімок складу лише для запису.");
+        }
+
+    private:
+        std::string text_;
+    };
+}
+
+namespace FootballManagement
+{
+    ClubService::ClubService(ClubManager& club, AuthManager& auth,
+                             FileManager fileManager)
+        : club_(club),
+          auth_(auth),
+          fileManager_(std::move(fileManager))
+    {
+        // Запити читають склад паралельно (shared_lock): відкладені записи
+        // розбираються тут, а не з const-методів у робочих потоках.
+        club_.LoadPending();
+    }
+
+    std::string ClubService::Handle(const std::string& request,
+                                    ServiceSession& session)
+    {
+        const auto fields = SplitFields(request);
+        const std::string& command = fields.front();
+
+        try
+        {
+            if (command == "ping") return "OK|pong";
+            if (command == "login") return Login(fields, session);
+            if (command == "auth") return Attach(fields, session);
+            if (command == "logout")
+            {
+                auth_.EndSession(session.token);
+                session.token.clear();
+                return "OK";
+            }
+            if (command == "search") return Search(fields);
+            if (command == "filter") return Filter(fields);
+            if (command == "rating") return TopRated(fields);
+            if (command == "sign") return Sign(fields, session);
+            if (command == "save")
+            {
+                if (!SessionCan(session, Permission::ManageUsers))
+                    return Error("лише адміністратор може зберігати дані");
+                return Save() ? "OK" : Error("не вдалося зберегти склад");
+            }
+            return Error("невідома команда: " + command);
+        }
+        catch (const std::exception& e)
+        {
+            return Error(e.what());
+        }
+    }
+
+    bool ClubService::Save() const
+    {
+        // Два збереження (запит і зупинка сервера) не пишуть файл разом;
+        // запис іде у .tmp з підміною, тож обрив не лишає обрізаного файлу.
+        std::lock_guard<std::mutex> saveLock(saveMutex_);
+        std::string text;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            text = club_.Serialize();
+        }
+
+        const RosterSnapshot snapshot(std::move(text));
+        FileSaveRequest request;
+        request.fileName = PLAYERS_DATA_FILE;
+        request.object = &snapshot;
+        request.atomic = true;
+        return fileManager_.SaveBatch({request});
+    }
+
+    std::string ClubService::Login(const std::vector<std::string>& args,
+                                   ServiceSession& session)
+    {
+        if (args.size() != 3) return Error("очікується login|логін|пароль");
+
+        std::string token = auth_.CreateSession(args[1], args[2]);
+        if (token.empty()) return Error("невірний логін або пароль");
+
+        session.token = std::move(token);
+        return "OK|" + session.token + "|"
+            + (SessionRole(session) == UserRole::Admin ? "admin" : "user");
+    }
+
+    std::string ClubService::Attach(const std::vector<std::string>& args,
+                                    ServiceSession& session) const
+    {
+        if (args.size() != 2) return Error("очікується auth|токен");
+
+        const auto info = auth_.ResolveSession(args[1]);
+        if (!info) return Error("сесія недійсна або прострочена");
+
+        session.token = args[1];
+        return info->role == UserRole::Admin ? "OK|admin" : "OK|user";
+    }
+
+    std::optional<UserRole> ClubService::SessionRole(
+        const ServiceSession& session) const
+    {
+        if (session.token.empty()) return std::nullopt;
+        const auto info = auth_.ResolveSession(session.token);
+        if (!info) return std::nullopt;
+        return info->role;
+    }
+
+    bool ClubService::SessionCan(const ServiceSession& session,
+                                 Permission permission) const
+    {
+        if (session.token.empty()) return false;
+        const auto info = auth_.ResolveSession(session.token);
+        return info && HasPermission(info->permissions, permission);
+    }
+
+    std::string ClubService::Search(const std::vector<std::string>& args) const
+    {
+        if (args.size() != 2) return Error("очікується search|ім'я");
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return PlayerRows(club_.SearchByName(args[1]));
+    }
+
+    std::string ClubService::Filter(const std::vector<std::string>& args) const
+    {
+        if (args.size() != 2) return Error("очікується filter|статус");
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return PlayerRows(club_.FilterByStatus(args[1]));
+    }
+
+    std::string ClubService::TopRated(
+        const std::vector<std::string>& args) const
+    {
+        if (args.size() != 2) return Error("очікується rating|N");
+
+        const std::size_t n = std::min<std::size_t>(
+            MAX_TOP_RATED, static_cast<std::size_t>(std::max(
+                0, std::stoi(args[1]))));
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        // Рейтинг рахується один раз на гравця; склад не пересортовується.
+        std::vector<std::pair<double, std::shared_ptr<Player>>> rated;
+        rated.reserve(club_.GetAll().size());
+        for (const auto& p : club_.GetAll())
+            if (p) rated.emplace_back(p->CalculatePerformanceRating(), p);
+
+        const auto top = std::min(n, rated.size());
+        std::partial_sort(rated.begin(), rated.begin() + top, rated.end(),
+                          [](const auto& a, const auto& b)
+                          {
+                              return a.first > b.first;
+                          });
+
+        std::vector<std::shared_ptr<Player>> players;
+        players.reserve(top);
+        for (std::size_t i = 0; i < top; ++i)
+            players.push_back(rated[i].second);
+        return PlayerRows(players);
+    }
+
+    std::string ClubService::Sign(const std::vector<std::string>& args,
+                                  const ServiceSession& session)
+    {
+        if (!SessionCan(session, Permission::SignAgents))
+            return Error("підписання потребує сесії з правом sign_agents");
+        if (args.size() != 4)
+            return Error("очікується sign|ID|зарплата|YYYY-MM-DD");
+
+        const int id = std::stoi(args[1]);
+        const double salary = std::stod(args[2]);
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        const auto agent = std::dynamic_pointer_cast<FreeAgent>(
+            club_.FindPlayerById(id));
+        if (!agent)
+            return Error("вільного агента з ID " + std::to_string(id)
+                         + " немає у складі");
+        if (!club_.SignFreeAgent(agent, salary, args[3]))
+            return Error("не вдалося підписати " + agent->GetName());
+
+        if (!SessionCan(session, Permission::ViewFinances)) return "OK";
+
+        std::ostringstream ss;
+        ss << "OK|" << std::fixed << std::setprecision(2)
+            << club_.GetTransferBudget();
+        return ss.str();
+    }
+
+    std::string ClubService::PlayerRows(
+        const std::vector<std::shared_ptr<Player>>& players)
+    {
+        std::ostringstream ss;
+        ss << "OK";
+        ss << std::fixed << std::setprecision(2);
+        for (const auto& p : players)
+        {
+            if (!p) continue;
+            ss << '\n' << p->GetPlayerId() << '|' << p->GetName() << '|'
+                << p->GetStatus() << '|' << p->GetMarketValue() << '|'
+                << p->CalculatePerformanceRating();
+        }
+        return ss.str();
+    }
+}
@@ -0,0 +1,47 @@
+#include "../include/Console.h"
+
+#include <iostream>
+#include <streambuf>
+
+namespace
+{
+    /// Буфер, що відкидає все записане, не змінюючи стану потоку.
+    class NullBuffer final : public std::streambuf
+    {
+    protected:
+        int_type overflow(int_type c) override
+        {
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char_type*, std::streamsize n) override
+        {
+            return n;
+        }
+    };
+
+    thread_local bool muted = false;
+}
+
+namespace FootballManagement
+{
+    std::ostream& Console()
+    {
+        if (!muted) return std::cout;
+
+        thread_local NullBuffer buffer;
+        thread_local std::ostream sink(&buffer);
+        return sink;
+    }
+
+    ScopedConsoleMute::ScopedConsoleMute()
+        : previous_(muted)
+    {
+        muted = true;
+    }
+
+    ScopedConsoleMute::~ScopedConsoleMute()
+    {
+        muted = previous_;
+    }
+}
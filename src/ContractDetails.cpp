@@ -1,4 +1,5 @@
 #include "../include/ContractDetails.h"
+#include "../include/Console.h"
 
 #include <iostream>
 #include <iomanip>
@@ -87,10 +88,10 @@ namespace FootballManagement
         return *this;
     }
 
-    std::string ContractDetails::GetClubName() const { return clubName_; }
+    const std::string& ContractDetails::GetClubName() const { return clubName_; }
     double ContractDetails::GetSalary() const { return salary_; }
 
-    std::string ContractDetails::GetContractUntil() const
+    const std::string& ContractDetails::GetContractUntil() const
     {
         return contractUntil_;
     }
@@ -118,7 +119,10 @@ namespace FootballManagement
         return diffMonths >= 0 && diffMonths <= 6;
     }
 
-    std::string ContractDetails::GetLoanEndDate() const { return loanEndDate_; }
+    const std::string& ContractDetails::GetLoanEndDate() const
+    {
+        return loanEndDate_;
+    }
 
     void ContractDetails::SetClubName(const std::string& clubName)
     {
@@ -150,14 +154,14 @@ namespace FootballManagement
         isLoaned_ = true;
         loanEndDate_ = loanEndDate;
 
-        std::cout << "[ІНФО] Гравця орендовано до " << loanEndDate_ << ".\n";
+        Console() << "[ІНФО] Гравця орендовано до " << loanEndDate_ << ".\n";
     }
 
     void ContractDetails::ReturnFromLoan()
     {
         isLoaned_ = false;
         loanEndDate_.clear();
-        std::cout << "[ІНФО] Гравець повернувся з оренди.\n";
+        Console() << "[ІНФО] Гравець повернувся з оренди.\n";
     }
 
     void ContractDetails::AdjustSalary(double percentage)
@@ -169,7 +173,7 @@ namespace FootballManagement
         const double factor = 1.0 + (percentage / 100.0);
         salary_ *= factor;
 
-        std::cout << "[ІНФО] Зарплата змінена на " << percentage
+        Console() << "[ІНФО] Зарплата змінена на " << percentage
             << "%. Нова зарплата: " << std::fixed << std::setprecision(2)
             << salary_ << " €\n";
     }
@@ -180,17 +184,17 @@ namespace FootballManagement
             throw std::invalid_argument("Формат дати має бути YYYY-MM-DD.");
         contractUntil_ = newDate;
 
-        std::cout << "[ІНФО] Контракт продовжено до " << newDate << ".\n";
+        Console() << "[ІНФО] Контракт продовжено до " << newDate << ".\n";
     }
 
     void ContractDetails::ShowDetails() const
     {
-        std::cout << "\n=== Інформація про контракт ===\n";
-        std::cout << "Клуб: " << clubName_
+        Console() << "\n=== Інформація про контракт ===\n";
+        Console() << "Клуб: " << clubName_
             << " | Зарплата: " << std::fixed << std::setprecision(2)
             << salary_ << " €\n";
-        std::cout << "Контракт дійсний до: " << contractUntil_;
-        if (isLoaned_) std::cout << " (Оренда до: " << loanEndDate_ << ")";
-        std::cout << "\n";
+        Console() << "Контракт дійсний до: " << contractUntil_;
+        if (isLoaned_) Console() << " (Оренда до: " << loanEndDate_ << ")";
+        Console() << "\n";
     }
 }
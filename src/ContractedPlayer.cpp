@@ -1,11 +1,18 @@
 #include "../include/ContractedPlayer.h"
+#include "../include/Console.h"
 
 #include <iostream>
+#include <array>
 #include <iomanip>
-#include <sstream>
 #include <stdexcept>
 #include <utility>
 
+namespace
+{
+    /// Назва "клубу" після розірвання контракту.
+    const std::string TERMINATED_CLUB_NAME = "Без клубу (контракт розірвано)";
+}
+
 namespace FootballManagement
 {
     ContractedPlayer::ContractedPlayer()
@@ -89,7 +96,7 @@ namespace FootballManagement
 
     ContractedPlayer::~ContractedPlayer() noexcept
     {
-        std::cout << "[ДЕБАГ] Контрактного гравця \"" << GetName() <<
+        Console() << "[ДЕБАГ] Контрактного гравця \"" << GetName() <<
             "\" видалено.\n";
     }
 
@@ -100,7 +107,7 @@ namespace FootballManagement
 
     double ContractedPlayer::GetTransferFee() const { return transferFee_; }
 
-    ContractDetails ContractedPlayer::GetContractDetails() const
+    const ContractDetails& ContractedPlayer::GetContractDetails() const
     {
         return contractDetails_;
     }
@@ -114,8 +121,9 @@ namespace FootballManagement
         listedForTransfer_ = true;
         transferFee_ = fee;
         transferConditions_ = conditions;
+        MarkDirty(PlayerField::Transfer);
 
-        std::cout << "[ІНФО] " << GetName()
+        Console() << "[ІНФО] " << GetName()
             << " виставлений на трансфер. Мінімальна сума: "
             << std::fixed << std::setprecision(2) << fee << " €.\n";
     }
@@ -125,8 +133,9 @@ namespace FootballManagement
         listedForTransfer_ = false;
         transferFee_ = 0.0;
         transferConditions_.clear();
+        MarkDirty(PlayerField::Transfer);
 
-        std::cout << "[ІНФО] " << GetName() <<
+        Console() << "[ІНФО] " << GetName() <<
             " знятий із трансферного списку.\n";
     }
 
@@ -135,12 +144,12 @@ namespace FootballManagement
     {
         if (!listedForTransfer_)
         {
-            std::cout << "[ПОМИЛКА] Гравець не виставлений на трансфер.\n";
+            Console() << "[ПОМИЛКА] Гравець не виставлений на трансфер.\n";
             return;
         }
         if (fee < transferFee_)
         {
-            std::cout << "[ПОМИЛКА] Запропонована сума " << std::fixed <<
+            Console() << "[ПОМИЛКА] Запропонована сума " << std::fixed <<
                 std::setprecision(2)
                 << fee << " € менша за мінімальну (" << transferFee_ <<
                 " €).\n";
@@ -150,8 +159,10 @@ namespace FootballManagement
         previousClub_ = contractDetails_.GetClubName();
         contractDetails_.SetClubName(newClub);
         listedForTransfer_ = false;
+        MarkDirty(PlayerFieldBit(PlayerField::Contract) |
+            PlayerFieldBit(PlayerField::Transfer));
 
-        std::cout << "[УСПІХ] " << GetName() << " проданий у клуб \"" << newClub
+        Console() << "[УСПІХ] " << GetName() << " проданий у клуб \"" << newClub
             << "\" за " << std::fixed << std::setprecision(2) << fee << " €.\n";
     }
 
@@ -168,16 +179,18 @@ namespace FootballManagement
                                 ? ((newSalary - oldSalary) / oldSalary) * 100.0
                                 : 100.0;
         contractDetails_.AdjustSalary(perc);
+        MarkDirty(PlayerField::Contract);
 
-        std::cout << "[ІНФО] Контракт " << GetName() << " продовжено до "
+        Console() << "[ІНФО] Контракт " << GetName() << " продовжено до "
             << newDate << ". Нова зарплата: "
             << std::fixed << std::setprecision(2) << newSalary << " €.\n";
     }
 
     void ContractedPlayer::TerminateContract(const std::string& reason)
     {
-        contractDetails_.SetClubName("Без клубу (контракт розірвано)");
-        std::cout << "[ПОПЕРЕДЖЕННЯ] Контракт " << GetName()
+        contractDetails_.SetClubName(TERMINATED_CLUB_NAME);
+        MarkDirty(PlayerField::Contract);
+        Console() << "[ПОПЕРЕДЖЕННЯ] Контракт " << GetName()
             << " розірвано. Причина: " << reason << "\n";
     }
 
@@ -185,27 +198,47 @@ namespace FootballManagement
                                       const std::string& endDate)
     {
         contractDetails_.SetOnLoan(endDate);
-        std::cout << "[ІНФО] " << GetName() << " відправлений в оренду до "
+        MarkDirty(PlayerField::Contract);
+        Console() << "[ІНФО] " << GetName() << " відправлений в оренду до "
             << otherClub << " до " << endDate << ".\n";
     }
 
+    void ContractedPlayer::ChangeSalary(double newSalary)
+    {
+        if (newSalary <= 0.0)
+            throw std::invalid_argument("Зарплата повинна бути додатною.");
+        contractDetails_.SetSalary(newSalary);
+        MarkDirty(PlayerField::Contract);
+    }
+
+    void ContractedPlayer::ReturnFromLoan()
+    {
+        contractDetails_.ReturnFromLoan();
+        MarkDirty(PlayerField::Contract);
+    }
+
+    bool ContractedPlayer::IsContractTerminated() const
+    {
+        return contractDetails_.GetClubName() == TERMINATED_CLUB_NAME;
+    }
+
     void ContractedPlayer::ShowInfo() const
     {
-        std::cout << "\n=== КОНТРАКТНИЙ ГРАВЕЦЬ ===\n";
+        Console() << "\n=== КОНТРАКТНИЙ ГРАВЕЦЬ ===\n";
         FieldPlayer::ShowInfo();
         contractDetails_.ShowDetails();
 
         if (listedForTransfer_)
         {
-            std::cout << "Статус трансферу: У списку | Мін. сума: "
+            Console() << "Статус трансферу: У списку | Мін. сума: "
                 << std::fixed << std::setprecision(2)
                 << transferFee_ << " €\n";
             if (!transferConditions_.empty())
-                std::cout << "Додаткові умови: " << transferConditions_ << "\n";
+                Console() << "Додаткові умови: " << transferConditions_ << "\n";
         }
         else
         {
-            std::cout << "Статус трансферу: Не виставлений\n";
+            Console() << "Статус трансферу: Не виставлений\n";
         }
     }
 
@@ -213,7 +246,7 @@ namespace FootballManagement
     {
         const int newAge = GetAge() + 1;
         SetAge(newAge);
-        std::cout << "[ІНФО] З днем народження, " << GetName()
+        Console() << "[ІНФО] З днем народження, " << GetName()
             << "! Тепер вам " << newAge << " років.\n";
 
         // Невелике вікове зниження після 30
@@ -244,160 +277,162 @@ namespace FootballManagement
         return baseValue + perfBonus + salaryImpact;
     }
 
-    std::string ContractedPlayer::GetStatus() const
+    std::string_view ContractedPlayer::GetStatus() const
     {
         if (IsInjured()) return "Травмований гравець";
         if (contractDetails_.IsPlayerOnLoan()) return "В оренді";
         return "Активний гравець";
     }
 
-    std::string ContractedPlayer::Serialize() const
+    std::unique_ptr<Player> ContractedPlayer::Clone() const
     {
-        std::ostringstream ss;
-        ss << "{"
-
-            << Player::SerializeBase() << ","
-
-            << "\"role\":\"ContractedPlayer\","
-            << "\"position\":" << static_cast<int>(GetPosition()) << ","
-            << "\"totalGames\":" << GetTotalGames() << ","
-            << "\"totalGoals\":" << GetTotalGoals() << ","
-            << "\"totalAssists\":" << GetTotalAssists() << ","
-            << "\"totalShots\":" << GetTotalShots() << ","
-            << "\"totalTackles\":" << GetTotalTackles() << ","
-            << "\"keyPasses\":" << GetKeyPasses() << ","
-
-
-            << "\"clubName\":\"" << contractDetails_.GetClubName() << "\","
-            << "\"previousClub\":\"" << previousClub_ << "\","
-
-            << "\"salary\":" << std::fixed << std::setprecision(2) <<
-            contractDetails_.GetSalary() << ","
-            << "\"contractUntil\":\"" << contractDetails_.GetContractUntil() <<
-            "\","
-            << "\"loaned\":" << (contractDetails_.IsPlayerOnLoan()
-                                     ? "true"
-                                     : "false");
-
-        if (contractDetails_.IsPlayerOnLoan())
-        {
-            ss << "\"loanEndDate\":\"" << contractDetails_.GetLoanEndDate() <<
-                "\",";
-        }
-        ss << ","
-            <<
-            "\"listedForTransfer\":" << (listedForTransfer_
-                                             ? "true"
-                                             : "false") << ","
-            << "\"transferFee\":" << std::fixed << std::setprecision(2) <<
-            transferFee_ << ","
-            << "\"transferConditions\":\"" << transferConditions_ << "\""
-            << "}";
-        return ss.str();
+        return std::make_unique<ContractedPlayer>(*this);
     }
 
-    void ContractedPlayer::Deserialize(const std::string& data)
+    const FieldSchema<ContractedPlayer>& ContractedPlayer::GetSchema()
     {
-        DeserializeBase(data);
-
-        auto findString = [&](const std::string& key) -> std::string
-        {
-            const std::string pat = "\"" + key + "\":\"";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return {};
-            const auto start = pos + pat.size();
-            const auto end = data.find('"', start);
-            if (end == std::string::npos) return {};
-            return data.substr(start, end - start);
-        };
-        auto findNumber = [&](const std::string& key) -> double
-        {
-            const std::string pat = "\"" + key + "\":";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return 0.0;
-            const auto start = pos + pat.size();
-            size_t end = start;
-            while (end < data.size() && (isdigit(data[end]) || data[end] == '.'
-                || data[end] == '-'))
-                ++end;
-            return std::stod(data.substr(start, end - start));
-        };
-        auto findBool = [&](const std::string& key) -> bool
-        {
-            const std::string pat = "\"" + key + "\":";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return false;
-            const auto start = pos + pat.size();
-            if (data.compare(start, 4, "true") == 0) return true;
-            if (data.compare(start, 5, "false") == 0) return false;
-            return false;
-        };
-
-        {
-            const std::string k = "\"position\":";
-            auto pos = data.find(k);
-            if (pos != std::string::npos)
+        static constexpr std::array<Field<ContractedPlayer>, 1> ROLE_FIELD = {{
             {
-                size_t i = pos + k.size();
-                while (i < data.size() && (data[i] == ' ')) ++i;
-                int p = 0;
-                try { p = std::stoi(data.substr(i)); }
-                catch (...) { p = 0; }
-                SetPosition(static_cast<Position>(p));
+                "role", FieldType::Tag,
+                [](const ContractedPlayer&, FieldValue& v)
+                {
+                    v.text = "ContractedPlayer";
+                },
+                nullptr
             }
-        }
-
-        const int games = static_cast<int>(findNumber("totalGames"));
-        const int goals = static_cast<int>(findNumber("totalGoals"));
-        const int assists = static_cast<int>(findNumber("totalAssists"));
-        const int shots = static_cast<int>(findNumber("totalShots"));
-        const int tackles = static_cast<int>(findNumber("totalTackles"));
-        const int kpasses = static_cast<int>(findNumber("keyPasses"));
-
-        for (int i = 0; i < games; ++i) RegisterMatchPlayed();
-        if (goals > 0 || assists > 0 || shots > 0)
-            UpdateAttackingStats(
-                goals, assists, shots);
-        if (tackles > 0) UpdateDefensiveStats(tackles);
-        for (int i = 0; i < kpasses; ++i) RegisterKeyPass();
-
-        const std::string club = findString("clubName");
-        const double sal = findNumber("salary");
-        const std::string until = findString("contractUntil");
-        const bool loan = findBool("loaned");
-        const std::string loanEnd = findString("loanEndDate");
-
-        if (!club.empty()) contractDetails_.SetClubName(club);
-        if (sal >= 0.0) contractDetails_.SetSalary(sal);
-        if (!until.empty()) contractDetails_.SetContractUntil(until);
-        if (loan)
-        {
-            try
+        }};
+        static constexpr std::array<Field<ContractedPlayer>, 9> OWN_FIELDS = {{
             {
-                if (!loanEnd.empty())
+                "clubName", FieldType::Text,
+                [](const ContractedPlayer& p, FieldValue& v)
                 {
-                    contractDetails_.SetOnLoan(loanEnd);
+                    v.text = p.contractDetails_.GetClubName();
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    if (!v.text.empty())
+                        p.contractDetails_.SetClubName(std::string(v.text));
                 }
-                else
+            },
+            {
+                "previousClub", FieldType::Text,
+                [](const ContractedPlayer& p, FieldValue& v)
                 {
+                    v.text = p.previousClub_;
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    if (!v.text.empty()) p.previousClub_ = v.text;
                 }
-            }
-            catch (const std::exception& e)
+            },
             {
-                std::cout << "[ПОПЕРЕДЖЕННЯ] Некоректна loanEndDate у даних: "
-                    << e.what() << "\n";
+                "salary", FieldType::Money,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    v.number = p.contractDetails_.GetSalary();
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    p.contractDetails_.SetSalary(v.number);
+                }
+            },
+            {
+                "contractUntil", FieldType::Text,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    v.text = p.contractDetails_.GetContractUntil();
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    if (!v.text.empty())
+                        p.contractDetails_.SetContractUntil(
+                            std::string(v.text));
+                }
+            },
+            {
+                // Стан оренди задає loanEndDate; тут лише скасування.
+                "loaned", FieldType::Bool,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    v.flag = p.contractDetails_.IsPlayerOnLoan();
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    if (!v.flag && p.contractDetails_.IsPlayerOnLoan())
+                        p.contractDetails_.ReturnFromLoan();
+                }
+            },
+            {
+                "loanEndDate", FieldType::Text,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    // після ReturnFromLoan() дата порожня
+                    v.text = p.contractDetails_.GetLoanEndDate();
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    if (v.text.empty()) return;
+                    try
+                    {
+                        p.contractDetails_.SetOnLoan(std::string(v.text));
+                    }
+                    catch (const std::exception& e)
+                    {
+                        Console() <<
+                            "[ПОПЕРЕДЖЕННЯ] Некоректна loanEndDate у даних: "
+                            << e.what() << "\n";
+                    }
+                }
+            },
+            {
+                "listedForTransfer", FieldType::Bool,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    v.flag = p.listedForTransfer_;
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    p.listedForTransfer_ = v.flag;
+                }
+            },
+            {
+                "transferFee", FieldType::Money,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    v.number = p.transferFee_;
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    p.transferFee_ = v.number;
+                }
+            },
+            {
+                "transferConditions", FieldType::Text,
+                [](const ContractedPlayer& p, FieldValue& v)
+                {
+                    v.text = p.transferConditions_;
+                },
+                [](ContractedPlayer& p, const FieldValue& v)
+                {
+                    if (!v.text.empty()) p.transferConditions_ = v.text;
+                }
             }
-        }
-        else
-        {
-            contractDetails_.ReturnFromLoan();
-        }
+        }};
+        static constexpr auto FIELDS =
+            ConcatFields(BaseFields<ContractedPlayer>(), ROLE_FIELD,
+                         StatFields<ContractedPlayer>(), OWN_FIELDS);
+        static constexpr FieldSchema<ContractedPlayer> SCHEMA(FIELDS.data(),
+            FIELDS.size());
+        return SCHEMA;
+    }
 
-        listedForTransfer_ = findBool("listedForTransfer");
-        transferFee_ = findNumber("transferFee");
-        const std::string cond = findString("transferConditions");
-        if (!cond.empty()) transferConditions_ = cond;
-        const std::string prev = findString("previousClub");
-        if (!prev.empty()) previousClub_ = prev;
+    std::string ContractedPlayer::Serialize() const
+    {
+        return GetSchema().EncodeText(*this);
+    }
+
+    void ContractedPlayer::Deserialize(const std::string& data)
+    {
+        GetSchema().DecodeText(*this, data);
     }
 }
@@ -1,4 +1,5 @@
 #include "../include/FieldPlayer.h"
+#include "../include/Console.h"
 
 #include <iostream>
 #include <iomanip>
@@ -123,7 +124,7 @@ namespace FootballManagement
 
     FieldPlayer::~FieldPlayer()
     {
-        std::cout << "[ДЕБАГ] Польового гравця \"" << GetName()
+        Console() << "[ДЕБАГ] Польового гравця \"" << GetName()
             << "\" знищено.\n";
     }
 
@@ -138,6 +139,7 @@ namespace FootballManagement
     void FieldPlayer::SetPosition(Position position)
     {
         position_ = position;
+        MarkDirty(PlayerField::Position);
     }
 
     void FieldPlayer::UpdateAttackingStats(int goals, int assists, int shots)
@@ -149,6 +151,7 @@ namespace FootballManagement
         totalGoals_ += goals;
         totalAssists_ += assists;
         totalShots_ += shots;
+        MarkDirty(PlayerField::Stats);
     }
 
     void FieldPlayer::UpdateDefensiveStats(int tackles)
@@ -158,11 +161,13 @@ namespace FootballManagement
                 "Помилка: кількість відборів не може бути від’ємною.");
 
         totalTackles_ += tackles;
+        MarkDirty(PlayerField::Stats);
     }
 
     void FieldPlayer::RegisterKeyPass()
     {
         ++keyPasses_;
+        MarkDirty(PlayerField::Stats);
     }
 
     double FieldPlayer::CalculateConversionRate() const
@@ -174,6 +179,7 @@ namespace FootballManagement
     void FieldPlayer::RegisterMatchPlayed()
     {
         ++totalGames_;
+        MarkDirty(PlayerField::Stats);
     }
 
     void FieldPlayer::ResetSeasonStats()
@@ -184,28 +190,29 @@ namespace FootballManagement
         totalShots_ = 0;
         totalTackles_ = 0;
         keyPasses_ = 0;
+        MarkDirty(PlayerField::Stats);
 
-        std::cout << "[ІНФО] Статистику сезону для гравця \"" << GetName()
+        Console() << "[ІНФО] Статистику сезону для гравця \"" << GetName()
             << "\" обнулено.\n";
     }
 
     void FieldPlayer::ShowInfo() const
     {
-        std::cout << "\n=== Інформація про польового гравця ===\n";
-        std::cout << "ID: " << GetPlayerId() << "\n";
-        std::cout << "Ім’я: " << GetName()
+        Console() << "\n=== Інформація про польового гравця ===\n";
+        Console() << "ID: " << GetPlayerId() << "\n";
+        Console() << "Ім’я: " << GetName()
             << " | Вік: " << GetAge()
             << " | Позиція: " << PositionToString(position_) << "\n";
 
-        std::cout << "Матчів: " << totalGames_
+        Console() << "Матчів: " << totalGames_
             << " | Голів: " << totalGoals_
             << " | Асистів: " << totalAssists_ << "\n";
 
-        std::cout << "Удари: " << totalShots_
+        Console() << "Удари: " << totalShots_
             << " | Відбори: " << totalTackles_
             << " | Ключові паси: " << keyPasses_ << "\n";
 
-        std::cout << "Конверсія ударів: " << std::fixed << std::setprecision(2)
+        Console() << "Конверсія ударів: " << std::fixed << std::setprecision(2)
             << CalculateConversionRate() << "%\n";
     }
 
@@ -214,7 +221,7 @@ namespace FootballManagement
         const int newAge = GetAge() + 1;
         SetAge(newAge); // потребує наявності сетера в Player
 
-        std::cout << "[ІНФО] З днем народження, " << GetName()
+        Console() << "[ІНФО] З днем народження, " << GetName()
             << "! Тепер вам " << newAge << " років. "
             << "Бажаємо нових перемог!\n";
     }
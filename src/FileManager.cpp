@@ -1,15 +1,28 @@
 #include "../include/FileManager.h"
+#include "../include/AsyncFileEngine.h"
+#include "../include/Console.h"
+#include "../include/Metrics.h"
+#include "../include/RosterArchive.h"
+#include "../include/Trace.h"
 
 #include <iostream>
+#include <cerrno>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
+#include <system_error>
 #include <filesystem>
+#include <utility>
 
 namespace fs = std::filesystem;
 
 namespace FootballManagement
 {
+    FileManager::FileManager(std::string directoryPath)
+        : directoryPath_(std::move(directoryPath))
+    {
+    }
+
     std::string FileManager::GetFullPath(const std::string& fileName) const
     {
         fs::path base(directoryPath_);
@@ -26,14 +39,14 @@ namespace FootballManagement
             if (!fs::exists(base))
             {
                 fs::create_directories(base);
-                std::cout << "[ІНФО] Створено каталог даних: "
+                Console() << "[ІНФО] Створено каталог даних: "
                     << base.string() << "\n";
             }
             return true;
         }
         catch (const fs::filesystem_error& e)
         {
-            std::cout <<
+            Console() <<
                 "[КРИТИЧНА ПОМИЛКА] Не вдалося забезпечити каталог даних: "
                 << e.what() << "\n";
             return false;
@@ -55,7 +68,14 @@ namespace FootballManagement
     bool FileManager::SaveToFile(const std::string& fileName,
                                  const IFileHandler& serializableObject) const
     {
-        if (!EnsureDirectoryExists()) return false;
+        FM_TRACE_SCOPE("FileManager::SaveToFile");
+        const ScopedLatency latency(MetricHistogram::FileSave);
+        if (!EnsureDirectoryExists())
+        {
+            MetricsRegistry::GetInstance().Increment(
+                MetricCounter::FileSaveErrors);
+            return false;
+        }
 
         const std::string fullPath = GetFullPath(fileName);
 
@@ -73,13 +93,56 @@ namespace FootballManagement
             file.flush();
             file.close();
 
-            std::cout << "[ІНФО] Дані збережено у файл: " << fileName << "\n";
+            Console() << "[ІНФО] Дані збережено у файл: " << fileName << "\n";
             return true;
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Не вдалося зберегти дані у файл \""
+            Console() << "[ПОМИЛКА] Не вдалося зберегти дані у файл \""
                 << fileName << "\": " << e.what() << "\n";
+            MetricsRegistry::GetInstance().Increment(
+                MetricCounter::FileSaveErrors);
+            return false;
+        }
+    }
+
+    bool FileManager::AppendLine(const std::string& fileName,
+                                 const std::string& line) const
+    {
+        if (!EnsureDirectoryExists()) return false;
+
+        try
+        {
+            std::ofstream file(GetFullPath(fileName),
+                               std::ios::out | std::ios::app);
+            if (!file.is_open())
+                throw std::runtime_error(
+                    "Не вдалося відкрити файл для дозапису.");
+
+            file << line << '\n';
+            file.flush();
+            return static_cast<bool>(file);
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося дописати у файл \""
+                << fileName << "\": " << e.what() << "\n";
+            return false;
+        }
+    }
+
+    bool FileManager::ReplaceFile(const std::string& sourceName,
+                                  const std::string& targetName) const
+    {
+        try
+        {
+            fs::rename(GetFullPath(sourceName), GetFullPath(targetName));
+            return true;
+        }
+        catch (const fs::filesystem_error& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося замінити файл \""
+                << targetName << "\": " << e.what() << "\n";
             return false;
         }
     }
@@ -87,11 +150,13 @@ namespace FootballManagement
     std::vector<std::string>
     FileManager::LoadFromFile(const std::string& fileName) const
     {
+        FM_TRACE_SCOPE("FileManager::LoadFromFile");
+        const ScopedLatency latency(MetricHistogram::FileLoad);
         std::vector<std::string> lines;
 
         if (!FileExists(fileName))
         {
-            std::cout << "[ПОПЕРЕДЖЕННЯ] Файл не знайдено: " << fileName
+            Console() << "[ПОПЕРЕДЖЕННЯ] Файл не знайдено: " << fileName
                 << ". Повертається порожній набір даних.\n";
             return lines;
         }
@@ -115,28 +180,221 @@ namespace FootballManagement
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Не вдалося прочитати дані з \""
+            Console() << "[ПОМИЛКА] Не вдалося прочитати дані з \""
                 << fileName << "\": " << e.what() << "\n";
+            MetricsRegistry::GetInstance().Increment(
+                MetricCounter::FileLoadErrors);
             lines.clear();
         }
 
         return lines;
     }
 
+    std::string FileManager::LoadFileContent(const std::string& fileName) const
+    {
+        FM_TRACE_SCOPE("FileManager::LoadFileContent");
+        const ScopedLatency latency(MetricHistogram::FileLoad);
+        if (!FileExists(fileName))
+        {
+            Console() << "[ПОПЕРЕДЖЕННЯ] Файл не знайдено: " << fileName
+                << ". Повертається порожній набір даних.\n";
+            return {};
+        }
+
+        try
+        {
+            std::ifstream file(GetFullPath(fileName), std::ios::binary);
+            if (!file.is_open())
+                throw std::runtime_error(
+                    "Не вдалося відкрити файл для читання.");
+
+            std::string content;
+            file.seekg(0, std::ios::end);
+            content.resize(static_cast<std::size_t>(file.tellg()));
+            file.seekg(0, std::ios::beg);
+            file.read(content.data(),
+                      static_cast<std::streamsize>(content.size()));
+            if (!file)
+                throw std::runtime_error("Файл прочитано не повністю.");
+            return content;
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося прочитати дані з \""
+                << fileName << "\": " << e.what() << "\n";
+            MetricsRegistry::GetInstance().Increment(
+                MetricCounter::FileLoadErrors);
+            return {};
+        }
+    }
+
+    bool FileManager::SaveBatch(
+        const std::vector<FileSaveRequest>& requests) const
+    {
+        FM_TRACE_SCOPE("FileManager::SaveBatch");
+        const ScopedLatency latency(MetricHistogram::FileSave);
+        auto& metrics = MetricsRegistry::GetInstance();
+        if (!EnsureDirectoryExists())
+        {
+            metrics.Increment(MetricCounter::FileSaveErrors,
+                              requests.size());
+            return false;
+        }
+
+        std::vector<FileOp> ops(requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            const FileSaveRequest& request = requests[i];
+            FileOp& op = ops[i];
+            op.kind = FileOpKind::Write;
+            op.path = GetFullPath(request.atomic ? request.fileName + ".tmp"
+                                                 : request.fileName);
+            op.data = request.object->Serialize();
+            if (!op.data.empty() && op.data.back() != '\n')
+                op.data.push_back('\n');
+            op.sync = true;
+        }
+
+        AsyncFileEngine::GetDefault().Execute(ops);
+
+        bool saved = true;
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            const std::string& fileName = requests[i].fileName;
+            if (ops[i].error == 0 && requests[i].atomic &&
+                !ReplaceFile(fileName + ".tmp", fileName))
+                ops[i].error = EIO;
+
+            if (ops[i].error != 0)
+            {
+                Console() << "[ПОМИЛКА] Не вдалося зберегти дані у файл \""
+                    << fileName << "\": "
+                    << std::generic_category().message(ops[i].error) << "\n";
+                metrics.Increment(MetricCounter::FileSaveErrors);
+                saved = false;
+                continue;
+            }
+            Console() << "[ІНФО] Дані збережено у файл: " << fileName << "\n";
+        }
+        return saved;
+    }
+
+    std::vector<std::string> FileManager::LoadFileContents(
+        const std::vector<std::string>& fileNames) const
+    {
+        FM_TRACE_SCOPE("FileManager::LoadFileContents");
+        const ScopedLatency latency(MetricHistogram::FileLoad);
+        std::vector<FileOp> ops(fileNames.size());
+        for (std::size_t i = 0; i < fileNames.size(); ++i)
+        {
+            ops[i].kind = FileOpKind::Read;
+            ops[i].path = GetFullPath(fileNames[i]);
+        }
+
+        AsyncFileEngine::GetDefault().Execute(ops);
+
+        std::vector<std::string> contents;
+        contents.reserve(ops.size());
+        for (std::size_t i = 0; i < ops.size(); ++i)
+        {
+            if (ops[i].error != 0)
+            {
+                Console() << "[ПОПЕРЕДЖЕННЯ] Не вдалося прочитати файл "
+                    << fileNames[i] << ": "
+                    << std::generic_category().message(ops[i].error)
+                    << ". Повертається порожній набір даних.\n";
+                MetricsRegistry::GetInstance().Increment(
+                    MetricCounter::FileLoadErrors);
+                ops[i].data.clear();
+            }
+            contents.push_back(std::move(ops[i].data));
+        }
+        return contents;
+    }
+
+    bool FileManager::SaveCompressed(
+        const std::string& fileName,
+        const IFileHandler& serializableObject) const
+    {
+        FM_TRACE_SCOPE("FileManager::SaveCompressed");
+        if (!EnsureDirectoryExists()) return false;
+
+        try
+        {
+            std::vector<std::string> records;
+            std::stringstream ss(serializableObject.Serialize());
+            std::string line;
+            while (std::getline(ss, line))
+                if (!line.empty()) records.push_back(std::move(line));
+
+            RosterArchive::Write(GetFullPath(fileName), records);
+            Console() << "[ІНФО] Дані збережено в архів: " << fileName << "\n";
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося зберегти архів \""
+                << fileName << "\": " << e.what() << "\n";
+            return false;
+        }
+    }
+
+    std::vector<std::string>
+    FileManager::LoadCompressed(const std::string& fileName) const
+    {
+        FM_TRACE_SCOPE("FileManager::LoadCompressed");
+        if (!FileExists(fileName))
+        {
+            Console() << "[ПОПЕРЕДЖЕННЯ] Файл не знайдено: " << fileName
+                << ". Повертається порожній набір даних.\n";
+            return {};
+        }
+
+        try
+        {
+            RosterArchive archive;
+            archive.Open(GetFullPath(fileName));
+            return archive.ReadAll();
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося прочитати архів \""
+                << fileName << "\": " << e.what() << "\n";
+            return {};
+        }
+    }
+
+    std::optional<std::string> FileManager::LoadCompressedRecord(
+        const std::string& fileName, int playerId) const
+    {
+        try
+        {
+            RosterArchive archive;
+            archive.Open(GetFullPath(fileName));
+            return archive.FindById(playerId);
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося прочитати архів \""
+                << fileName << "\": " << e.what() << "\n";
+            return std::nullopt;
+        }
+    }
+
     void FileManager::DisplayFileContent(const std::string& fileName) const
     {
         if (!FileExists(fileName))
         {
-            std::cout << "[ПОМИЛКА] Неможливо відобразити: файл \""
+            Console() << "[ПОМИЛКА] Неможливо відобразити: файл \""
                 << fileName << "\" не знайдено.\n";
             return;
         }
 
-        std::cout << "\n--- ВМІСТ ФАЙЛУ " << fileName << " ---\n";
+        Console() << "\n--- ВМІСТ ФАЙЛУ " << fileName << " ---\n";
         const auto lines = LoadFromFile(fileName);
         for (const auto& line : lines)
-            std::cout << line << "\n";
-        std::cout << "----------------------------------------\n\n";
+            Console() << line << "\n";
+        Console() << "----------------------------------------\n\n";
     }
 
     bool FileManager::DeleteFile(const std::string& fileName) const
@@ -146,18 +404,18 @@ namespace FootballManagement
         {
             if (fs::remove(fullPath))
             {
-                std::cout << "[ІНФО] Файл успішно видалено: " << fileName <<
+                Console() << "[ІНФО] Файл успішно видалено: " << fileName <<
                     "\n";
                 return true;
             }
 
-            std::cout << "[ПОПЕРЕДЖЕННЯ] Файл не видалено (можливо, не існує): "
+            Console() << "[ПОПЕРЕДЖЕННЯ] Файл не видалено (можливо, не існує): "
                 << fileName << "\n";
             return false;
         }
         catch (const fs::filesystem_error& e)
         {
-            std::cout << "[ПОМИЛКА] Не вдалося видалити файл \""
+            Console() << "[ПОМИЛКА] Не вдалося видалити файл \""
                 << fileName << "\": " << e.what() << "\n";
             return false;
         }
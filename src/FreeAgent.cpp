@@ -1,11 +1,11 @@
 #include "../include/FreeAgent.h"
+#include "../include/Console.h"
 
 #include <iostream>
+#include <array>
 #include <iomanip>
-#include <sstream>
 #include <stdexcept>
 #include <utility>
-#include <cctype>
 
 namespace FootballManagement
 {
@@ -89,12 +89,12 @@ namespace FootballManagement
 
     FreeAgent::~FreeAgent() noexcept
     {
-        std::cout << "[ДЕБАГ] Вільного агента \"" << GetName() <<
+        Console() << "[ДЕБАГ] Вільного агента \"" << GetName() <<
             "\" знищено.\n";
     }
 
     double FreeAgent::GetExpectedSalary() const { return expectedSalary_; }
-    std::string FreeAgent::GetLastClub() const { return lastClub_; }
+    const std::string& FreeAgent::GetLastClub() const { return lastClub_; }
 
     bool FreeAgent::IsAvailableForNegotiation() const
     {
@@ -106,6 +106,7 @@ namespace FootballManagement
     void FreeAgent::SetLastClub(const std::string& lastClub)
     {
         lastClub_ = lastClub;
+        MarkDirty(PlayerField::Negotiation);
     }
 
     void FreeAgent::SetMonthWithoutClub(int months)
@@ -114,12 +115,14 @@ namespace FootballManagement
             throw std::invalid_argument(
                 "Кількість місяців без клубу не може бути від’ємною.");
         monthsWithoutClub_ = months;
+        MarkDirty(PlayerField::Negotiation);
     }
 
     void FreeAgent::SetAvailability(bool isAvailable)
     {
         availableForNegotiation_ = isAvailable;
-        std::cout << "[ІНФО] " << GetName()
+        MarkDirty(PlayerField::Negotiation);
+        Console() << "[ІНФО] " << GetName()
             << (isAvailable ? " відкрив " : " закрив ")
             << "переговори.\n";
     }
@@ -128,22 +131,23 @@ namespace FootballManagement
     {
         if (!availableForNegotiation_)
         {
-            std::cout << "[ПОМИЛКА] " << GetName() <<
+            Console() << "[ПОМИЛКА] " << GetName() <<
                 " не веде переговорів зараз.\n";
             return false;
         }
 
         if (offer >= expectedSalary_)
         {
-            std::cout << "[УСПІХ] " << GetName()
+            Console() << "[УСПІХ] " << GetName()
                 << " прийняв пропозицію із зарплатою "
                 << std::fixed << std::setprecision(2)
                 << offer << " €.\n";
             availableForNegotiation_ = false;
+            MarkDirty(PlayerField::Negotiation);
             return true;
         }
 
-        std::cout << "[ІНФО] " << GetName()
+        Console() << "[ІНФО] " << GetName()
             << " відхилив пропозицію " << std::fixed << std::setprecision(2)
             << offer << " € (очікує "
             << expectedSalary_ << " €).\n";
@@ -154,7 +158,8 @@ namespace FootballManagement
     {
         if (percentage <= 0.0) return;
         expectedSalary_ *= (1.0 + percentage / 100.0);
-        std::cout << "[ІНФО] Очікування " << GetName()
+        MarkDirty(PlayerField::Negotiation);
+        Console() << "[ІНФО] Очікування " << GetName()
             << " зросли на " << percentage << "%. Нова зарплата: "
             << std::fixed << std::setprecision(2)
             << expectedSalary_ << " €.\n";
@@ -165,7 +170,8 @@ namespace FootballManagement
         if (percentage <= 0.0) return;
         expectedSalary_ *= (1.0 - percentage / 100.0);
         if (expectedSalary_ < 0.0) expectedSalary_ = 0.0;
-        std::cout << "[ІНФО] Очікування " << GetName()
+        MarkDirty(PlayerField::Negotiation);
+        Console() << "[ІНФО] Очікування " << GetName()
             << " знижено на " << percentage << "%. Нова зарплата: "
             << std::fixed << std::setprecision(2)
             << expectedSalary_ << " €.\n";
@@ -176,7 +182,8 @@ namespace FootballManagement
         SetAvailability(false);
         lastClub_ = club;
         monthsWithoutClub_ = 0;
-        std::cout << "[УСПІХ] " << GetName()
+        MarkDirty(PlayerField::Negotiation);
+        Console() << "[УСПІХ] " << GetName()
             << " підписав контракт із клубом \"" << club << "\".\n";
     }
 
@@ -187,12 +194,12 @@ namespace FootballManagement
 
     void FreeAgent::ShowInfo() const
     {
-        std::cout << "\n=== ВІЛЬНИЙ АГЕНТ ===\n";
+        Console() << "\n=== ВІЛЬНИЙ АГЕНТ ===\n";
         FieldPlayer::ShowInfo();
-        std::cout << "ID: " << GetPlayerId() << "\n";
-        std::cout << "Останній клуб: " << lastClub_
+        Console() << "ID: " << GetPlayerId() << "\n";
+        Console() << "Останній клуб: " << lastClub_
             << " | Місяців без клубу: " << monthsWithoutClub_ << "\n";
-        std::cout << "Очікувана зарплата: " << std::fixed <<
+        Console() << "Очікувана зарплата: " << std::fixed <<
             std::setprecision(2)
             << expectedSalary_ << " € | Доступний до переговорів: "
             << (availableForNegotiation_ ? "Так" : "Ні") << "\n";
@@ -202,7 +209,7 @@ namespace FootballManagement
     {
         const int newAge = GetAge() + 1;
         SetAge(newAge);
-        std::cout << "[ІНФО] З днем народження, " << GetName()
+        Console() << "[ІНФО] З днем народження, " << GetName()
             << "! Тепер вам " << newAge << " років.\n";
         IncreaseExpectations(3.0);
     }
@@ -237,7 +244,7 @@ namespace FootballManagement
         return GetMarketValue() * discount + perfBonus;
     }
 
-    std::string FreeAgent::GetStatus() const
+    std::string_view FreeAgent::GetStatus() const
     {
         if (IsInjured()) return "Травмований вільний агент";
         return availableForNegotiation_
@@ -245,100 +252,76 @@ namespace FootballManagement
                    : "Контракт підписано";
     }
 
-    std::string FreeAgent::Serialize() const
+    std::unique_ptr<Player> FreeAgent::Clone() const
     {
-        std::ostringstream ss;
-        ss << "{"
-            << SerializeBase() << ","
-            << "\"position\":" << static_cast<int>(GetPosition()) << ","
-            << "\"totalGames\":" << GetTotalGames() << ","
-            << "\"totalGoals\":" << GetTotalGoals() << ","
-            << "\"totalAssists\":" << GetTotalAssists() << ","
-            << "\"totalShots\":" << GetTotalShots() << ","
-            << "\"totalTackles\":" << GetTotalTackles() << ","
-            << "\"keyPasses\":" << GetKeyPasses() << ","
-
-            << "\"role\":\"FreeAgent\","
-            << "\"expectedSalary\":" << std::fixed << std::setprecision(2) <<
-            expectedSalary_ << ","
-            << "\"lastClub\":\"" << lastClub_ << "\","
-            << "\"monthsWithoutClub\":" << monthsWithoutClub_ << ","
-            << "\"available\":" << (availableForNegotiation_ ? "true" : "false")
-            << "}";
-        return ss.str();
+        return std::make_unique<FreeAgent>(*this);
     }
 
-    void FreeAgent::Deserialize(const std::string& data)
+    const FieldSchema<FreeAgent>& FreeAgent::GetSchema()
     {
-        DeserializeBase(data);
-        auto findString = [&](const std::string& key) -> std::string
-        {
-            const std::string pat = "\"" + key + "\":\"";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return {};
-            const auto start = pos + pat.size();
-            const auto end = data.find('"', start);
-            if (end == std::string::npos) return {};
-            return data.substr(start, end - start);
-        };
-        auto findNumber = [&](const std::string& key) -> double
-        {
-            const std::string pat = "\"" + key + "\":";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return 0.0;
-            const auto start = pos + pat.size();
-            size_t end = start;
-            while (end < data.size() && (isdigit(
-                    static_cast<unsigned char>(data[end])) || data[end] == '.'
-                ||
-                data[end] == '-'))
-                ++end;
-            try { return std::stod(data.substr(start, end - start)); }
-            catch (...) { return 0.0; }
-        };
-        auto findBool = [&](const std::string& key) -> bool
-        {
-            const std::string pat = "\"" + key + "\":";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return false;
-            const auto start = pos + pat.size();
-            if (data.compare(start, 4, "true") == 0) return true;
-            if (data.compare(start, 5, "false") == 0) return false;
-            return false;
-        };
-
-        {
-            const std::string k = "\"position\":";
-            auto pos = data.find(k);
-            if (pos != std::string::npos)
+        static constexpr std::array<Field<FreeAgent>, 5> OWN_FIELDS = {{
+            {
+                "role", FieldType::Tag,
+                [](const FreeAgent&, FieldValue& v) { v.text = "FreeAgent"; },
+                nullptr
+            },
+            {
+                "expectedSalary", FieldType::Money,
+                [](const FreeAgent& a, FieldValue& v)
+                {
+                    v.number = a.expectedSalary_;
+                },
+                [](FreeAgent& a, const FieldValue& v)
+                {
+                    a.expectedSalary_ = v.number;
+                }
+            },
+            {
+                "lastClub", FieldType::Text,
+                [](const FreeAgent& a, FieldValue& v) { v.text = a.lastClub_; },
+                [](FreeAgent& a, const FieldValue& v)
+                {
+                    if (!v.text.empty()) a.lastClub_ = v.text;
+                }
+            },
             {
-                size_t i = pos + k.size();
-                while (i < data.size() && data[i] == ' ') ++i;
-                int p = 0;
-                try { p = std::stoi(data.substr(i)); }
-                catch (...) { p = 0; }
-                SetPosition(static_cast<Position>(p));
+                "monthsWithoutClub", FieldType::Int,
+                [](const FreeAgent& a, FieldValue& v)
+                {
+                    v.integer = a.monthsWithoutClub_;
+                },
+                [](FreeAgent& a, const FieldValue& v)
+                {
+                    a.monthsWithoutClub_ = static_cast<int>(v.integer);
+                }
+            },
+            {
+                "available", FieldType::Bool,
+                [](const FreeAgent& a, FieldValue& v)
+                {
+                    v.flag = a.availableForNegotiation_;
+                },
+                [](FreeAgent& a, const FieldValue& v)
+                {
+                    a.availableForNegotiation_ = v.flag;
+                }
             }
-        }
-        const int games = static_cast<int>(findNumber("totalGames"));
-        const int goals = static_cast<int>(findNumber("totalGoals"));
-        const int assists = static_cast<int>(findNumber("totalAssists"));
-        const int shots = static_cast<int>(findNumber("totalShots"));
-        const int tackles = static_cast<int>(findNumber("totalTackles"));
-        const int kpasses = static_cast<int>(findNumber("keyPasses"));
-
-        for (int i = 0; i < games; ++i) RegisterMatchPlayed();
-        if (goals > 0 || assists > 0 || shots > 0)
-            UpdateAttackingStats(
-                goals, assists, shots);
-        if (tackles > 0) UpdateDefensiveStats(tackles);
-        for (int i = 0; i < kpasses; ++i) RegisterKeyPass();
-
-        const std::string club = findString("lastClub");
-        if (!club.empty()) lastClub_ = club;
-
-        expectedSalary_ = findNumber("expectedSalary");
-        monthsWithoutClub_ = static_cast<int>(findNumber("monthsWithoutClub"));
-        availableForNegotiation_ = findBool("available");
+        }};
+        static constexpr auto FIELDS =
+            ConcatFields(BaseFields<FreeAgent>(), StatFields<FreeAgent>(),
+                         OWN_FIELDS);
+        static constexpr FieldSchema<FreeAgent> SCHEMA(FIELDS.data(),
+                                                       FIELDS.size());
+        return SCHEMA;
+    }
+
+    std::string FreeAgent::Serialize() const
+    {
+        return GetSchema().EncodeText(*this);
+    }
+
+    void FreeAgent::Deserialize(const std::string& data)
+    {
+        GetSchema().DecodeText(*this, data);
     }
 }
@@ -1,11 +1,11 @@
 #include "../include/Goalkeeper.h"
+#include "../include/Console.h"
 
 #include <iostream>
+#include <array>
 #include <iomanip>
-#include <sstream>
 #include <stdexcept>
 #include <utility>
-#include <cctype>
 
 namespace FootballManagement
 {
@@ -93,7 +93,7 @@ namespace FootballManagement
 
     Goalkeeper::~Goalkeeper() noexcept
     {
-        std::cout << "[ДЕБАГ] Воротаря \"" << GetName() << "\" знищено.\n";
+        Console() << "[ДЕБАГ] Воротаря \"" << GetName() << "\" знищено.\n";
     }
 
     int Goalkeeper::GetMatchesPlayed() const { return matchesPlayed_; }
@@ -111,17 +111,20 @@ namespace FootballManagement
         ++matchesPlayed_;
         goalsConceded_ += goalsAgainst;
         savesTotal_ += saves;
+        MarkDirty(PlayerField::Stats);
         if (goalsAgainst == 0) RegisterCleanSheet();
     }
 
     void Goalkeeper::RegisterCleanSheet()
     {
         ++cleanSheets_;
+        MarkDirty(PlayerField::Stats);
     }
 
     void Goalkeeper::RegisterPenaltySave()
     {
         ++penaltiesSaved_;
+        MarkDirty(PlayerField::Stats);
     }
 
     double Goalkeeper::CalculateSavePercentage() const
@@ -143,25 +146,26 @@ namespace FootballManagement
         savesTotal_ = 0;
         goalsConceded_ = 0;
         penaltiesSaved_ = 0;
+        MarkDirty(PlayerField::Stats);
 
-        std::cout << "[ІНФО] Статистику воротаря \"" << GetName()
+        Console() << "[ІНФО] Статистику воротаря \"" << GetName()
             << "\" обнулено.\n";
     }
 
 
     void Goalkeeper::ShowInfo() const
     {
-        std::cout << "\n=== ІНФОРМАЦІЯ ПРО ВОРОТАРЯ ===\n";
-        std::cout << "ID: " << GetPlayerId() << "\n";
-        std::cout << "Ім’я: " << GetName()
+        Console() << "\n=== ІНФОРМАЦІЯ ПРО ВОРОТАРЯ ===\n";
+        Console() << "ID: " << GetPlayerId() << "\n";
+        Console() << "Ім’я: " << GetName()
             << " | Вік: " << GetAge()
             << " | Статус: " << GetStatus() << "\n";
-        std::cout << "Матчів: " << matchesPlayed_
+        Console() << "Матчів: " << matchesPlayed_
             << " | Сухих матчів: " << cleanSheets_ << "\n";
-        std::cout << "Сейви: " << savesTotal_
+        Console() << "Сейви: " << savesTotal_
             << " | Пропущено голів: " << goalsConceded_
             << " | Відбиті пенальті: " << penaltiesSaved_ << "\n";
-        std::cout << "Відсоток сейвів: " << std::fixed << std::setprecision(2)
+        Console() << "Відсоток сейвів: " << std::fixed << std::setprecision(2)
             << CalculateSavePercentage() << "%\n";
     }
 
@@ -169,7 +173,7 @@ namespace FootballManagement
     {
         const int newAge = GetAge() + 1;
         SetAge(newAge); // сетер ми додали у Player
-        std::cout << "[ІНФО] З днем народження, воротарю " << GetName()
+        Console() << "[ІНФО] З днем народження, воротарю " << GetName()
             << "! Тепер вам " << newAge << " років.\n";
     }
 
@@ -196,49 +200,94 @@ namespace FootballManagement
         return base + perf + csBonus;
     }
 
-    std::string Goalkeeper::GetStatus() const
+    std::string_view Goalkeeper::GetStatus() const
     {
         return IsInjured() ? "Травмований воротар" : "Активний воротар";
     }
 
+    std::unique_ptr<Player> Goalkeeper::Clone() const
+    {
+        return std::make_unique<Goalkeeper>(*this);
+    }
+
+    const FieldSchema<Goalkeeper>& Goalkeeper::GetSchema()
+    {
+        static constexpr std::array<Field<Goalkeeper>, 6> OWN_FIELDS = {{
+            {
+                "role", FieldType::Tag,
+                [](const Goalkeeper&, FieldValue& v) { v.text = "Goalkeeper"; },
+                nullptr
+            },
+            {
+                "matchesPlayed", FieldType::Int,
+                [](const Goalkeeper& g, FieldValue& v)
+                {
+                    v.integer = g.matchesPlayed_;
+                },
+                [](Goalkeeper& g, const FieldValue& v)
+                {
+                    g.matchesPlayed_ = static_cast<int>(v.integer);
+                }
+            },
+            {
+                "cleanSheets", FieldType::Int,
+                [](const Goalkeeper& g, FieldValue& v)
+                {
+                    v.integer = g.cleanSheets_;
+                },
+                [](Goalkeeper& g, const FieldValue& v)
+                {
+                    g.cleanSheets_ = static_cast<int>(v.integer);
+                }
+            },
+            {
+                "savesTotal", FieldType::Int,
+                [](const Goalkeeper& g, FieldValue& v)
+                {
+                    v.integer = g.savesTotal_;
+                },
+                [](Goalkeeper& g, const FieldValue& v)
+                {
+                    g.savesTotal_ = static_cast<int>(v.integer);
+                }
+            },
+            {
+                "goalsConceded", FieldType::Int,
+                [](const Goalkeeper& g, FieldValue& v)
+                {
+                    v.integer = g.goalsConceded_;
+                },
+                [](Goalkeeper& g, const FieldValue& v)
+                {
+                    g.goalsConceded_ = static_cast<int>(v.integer);
+                }
+            },
+            {
+                "penaltiesSaved", FieldType::Int,
+                [](const Goalkeeper& g, FieldValue& v)
+                {
+                    v.integer = g.penaltiesSaved_;
+                },
+                [](Goalkeeper& g, const FieldValue& v)
+                {
+                    g.penaltiesSaved_ = static_cast<int>(v.integer);
+                }
+            }
+        }};
+        static constexpr auto FIELDS =
+            ConcatFields(BaseFields<Goalkeeper>(), OWN_FIELDS);
+        static constexpr FieldSchema<Goalkeeper> SCHEMA(FIELDS.data(),
+                                                        FIELDS.size());
+        return SCHEMA;
+    }
+
     std::string Goalkeeper::Serialize() const
     {
-        std::ostringstream ss;
-        ss << "{"
-            << SerializeBase() << "," // базові поля Player
-            << "\"role\":\"Goalkeeper\"," // корисна мітка типу
-            << "\"matchesPlayed\":" << matchesPlayed_ << ","
-            << "\"cleanSheets\":" << cleanSheets_ << ","
-            << "\"savesTotal\":" << savesTotal_ << ","
-            << "\"goalsConceded\":" << goalsConceded_ << ","
-            << "\"penaltiesSaved\":" << penaltiesSaved_
-            << "}";
-        return ss.str();
+        return GetSchema().EncodeText(*this);
     }
 
     void Goalkeeper::Deserialize(const std::string& data)
     {
-        DeserializeBase(data);
-        auto findNumber = [&](const std::string& key, int def = 0) -> int
-        {
-            const std::string pat = "\"" + key + "\":";
-            const auto pos = data.find(pat);
-            if (pos == std::string::npos) return def;
-            size_t i = pos + pat.size();
-            // пропустити пробіли/знаки
-            while (i < data.size() && (data[i] == ' ')) ++i;
-            size_t j = i;
-            while (j < data.size() && (std::isdigit(
-                static_cast<unsigned char>(data[j])) || data[j] == '-'))
-                ++j;
-            try { return std::stoi(data.substr(i, j - i)); }
-            catch (...) { return def; }
-        };
-
-        matchesPlayed_ = findNumber("matchesPlayed", 0);
-        cleanSheets_ = findNumber("cleanSheets", 0);
-        savesTotal_ = findNumber("savesTotal", 0);
-        goalsConceded_ = findNumber("goalsConceded", 0);
-        penaltiesSaved_ = findNumber("penaltiesSaved", 0);
+        GetSchema().DecodeText(*this, data);
     }
 }
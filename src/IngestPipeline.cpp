@@ -0,0 +1,380 @@
+#include "../include/IngestPipeline.h"
+#include "../include/Console.h"
+#include "../include/Trace.h"
+
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+    using namespace FootballManagement;
+    using Clock = std::chrono::steady_clock;
+
+    /// Шматок файлу (read → split).
+    struct TextChunk
+    {
+        std::string bytes;
+    };
+
+    /// Пакет рядків (split → parse); пакет 0 — лише шапка.
+    struct LineBatch
+    {
+        std::uint64_t sequence = 0;
+        bool header = false;
+        std::vector<std::string> lines;
+    };
+
+    /// Пакет гравців (parse → validate → insert); nullptr — нерозібраний рядок.
+    struct PlayerBatch
+    {
+        std::uint64_t sequence = 0;
+        std::string header; ///< Шапка (лише в пакеті 0).
+        bool hasHeader = false;
+        std::vector<std::shared_ptr<Player>> players;
+        std::size_t rejected = 0; ///< Відкинуто validate.
+    };
+
+    /// Наносекунди від @p mark; @p mark переводиться на «зараз».
+    std::uint64_t Lap(Clock::time_point& mark)
+    {
+        const auto now = Clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            now - mark).count();
+        mark = now;
+        return static_cast<std::uint64_t>(ns);
+    }
+
+    /// Черги конвеєра; деструктор закриває їх, щоб етапи завершилися навіть
+    /// після винятку в потоці виклику.
+    struct Channels
+    {
+        BoundedQueue<TextChunk> chunks;
+        BoundedQueue<LineBatch> lines;
+        BoundedQueue<PlayerBatch> parsed;
+        BoundedQueue<PlayerBatch> valid;
+        std::vector<std::thread> threads;
+
+        explicit Channels(std::size_t capacity)
+            : chunks(capacity),
+              lines(capacity),
+              parsed(capacity),
+              valid(capacity)
+        {
+        }
+
+        ~Channels()
+        {
+            chunks.Close();
+            lines.Close();
+            parsed.Close();
+            valid.Close();
+            for (auto& t : threads)
+                if (t.joinable()) t.join();
+        }
+    };
+
+    /// Етап read: файл шматками по readChunk байтів.
+    void ReadStage(const std::string& path, std::size_t chunkSize,
+                   BoundedQueue<TextChunk>& out, IngestStageStats& stats,
+                   bool& ok)
+    {
+        auto mark = Clock::now();
+        std::ifstream file(path, std::ios::binary);
+        ok = file.is_open();
+        while (ok)
+        {
+            TextChunk chunk;
+            chunk.bytes.resize(chunkSize);
+            file.read(chunk.bytes.data(),
+                      static_cast<std::streamsize>(chunk.bytes.size()));
+            chunk.bytes.resize(static_cast<std::size_t>(file.gcount()));
+            if (chunk.bytes.empty())
+            {
+                ok = !file.bad();
+                break;
+            }
+            stats.items += chunk.bytes.size();
+            stats.busyNs += Lap(mark);
+
+            if (!out.Push(std::move(chunk))) break;
+            stats.waitNs += Lap(mark);
+        }
+        stats.busyNs += Lap(mark);
+        out.Close();
+    }
+
+    /// Етап split: шматки → непорожні рядки, пакетами по batchLines.
+    void SplitStage(std::size_t batchLines, BoundedQueue<TextChunk>& in,
+                    BoundedQueue<LineBatch>& out, IngestStageStats& stats)
+    {
+        auto mark = Clock::now();
+        std::string carry; ///< Незавершений рядок попереднього шматка.
+        LineBatch batch;
+        std::uint64_t nextSequence = 0;
+        bool headerDone = false;
+
+        const auto emit = [&](std::string line)
+        {
+            if (line.empty()) return true;
+            ++stats.items;
+            if (!headerDone)
+            {
+                headerDone = true;
+                LineBatch header;
+                header.sequence = nextSequence++;
+                header.header = true;
+                header.lines.push_back(std::move(line));
+                stats.busyNs += Lap(mark);
+                const bool pushed = out.Push(std::move(header));
+                stats.waitNs += Lap(mark);
+                return pushed;
+            }
+
+            batch.lines.push_back(std::move(line));
+            if (batch.lines.size() < batchLines) return true;
+            batch.sequence = nextSequence++;
+            stats.busyNs += Lap(mark);
+            const bool pushed = out.Push(std::move(batch));
+            stats.waitNs += Lap(mark);
+            batch = LineBatch();
+            batch.lines.reserve(batchLines);
+            return pushed;
+        };
+
+        batch.lines.reserve(batchLines);
+        bool open = true;
+        while (open)
+        {
+            auto chunk = in.Pop();
+            stats.waitNs += Lap(mark);
+            if (!chunk) break;
+
+            const std::string& bytes = chunk->bytes;
+            std::size_t pos = 0;
+            for (std::size_t end; open &&
+                 (end = bytes.find('\n', pos)) != std::string::npos;
+                 pos = end + 1)
+            {
+                std::string line;
+                if (carry.empty())
+                {
+                    line.assign(bytes, pos, end - pos);
+                }
+                else
+                {
+                    line = std::move(carry);
+                    carry.clear();
+                    line.append(bytes, pos, end - pos);
+                }
+                open = emit(std::move(line));
+            }
+            carry.append(bytes, std::min(pos, bytes.size()), std::string::npos);
+        }
+
+        if (open && emit(std::move(carry)) && !batch.lines.empty())
+        {
+            batch.sequence = nextSequence;
+            stats.busyNs += Lap(mark);
+            out.Push(std::move(batch));
+        }
+        stats.busyNs += Lap(mark);
+        out.Close();
+    }
+
+    /// Етап parse (один із N потоків): рядки → гравці.
+    void ParseStage(BoundedQueue<LineBatch>& in,
+                    BoundedQueue<PlayerBatch>& out, IngestStageStats& stats)
+    {
+        ScopedConsoleMute mute;
+        auto mark = Clock::now();
+        while (auto batch = in.Pop())
+        {
+            stats.waitNs += Lap(mark);
+            PlayerBatch parsed;
+            parsed.sequence = batch->sequence;
+            if (batch->header)
+            {
+                parsed.hasHeader = true;
+                parsed.header = std::move(batch->lines.front());
+            }
+            else
+            {
+                parsed.players.reserve(batch->lines.size());
+                for (const auto& line : batch->lines)
+                {
+                    std::shared_ptr<Player> p;
+                    try
+                    {
+                        p = ClubManager::DecodeRecord(line);
+                    }
+                    catch (const std::exception&)
+                    {
+                        // Пошкоджений рядок відкидає validate.
+                    }
+                    parsed.players.push_back(std::move(p));
+                }
+                stats.items += batch->lines.size();
+            }
+            stats.busyNs += Lap(mark);
+
+            if (!out.Push(std::move(parsed))) break;
+            stats.waitNs += Lap(mark);
+        }
+        stats.waitNs += Lap(mark);
+    }
+
+    /// Етап validate: порядок файлу, відомий тип, унікальний ID.
+    void ValidateStage(BoundedQueue<PlayerBatch>& in,
+                       BoundedQueue<PlayerBatch>& out, IngestStageStats& stats)
+    {
+        auto mark = Clock::now();
+        std::map<std::uint64_t, PlayerBatch> early; ///< Обігнали попередні.
+        std::uint64_t next = 0;
+        std::unordered_set<int> seen;
+
+        bool open = true;
+        while (open)
+        {
+            auto batch = in.Pop();
+            stats.waitNs += Lap(mark);
+            if (!batch) break;
+            early.emplace(batch->sequence, std::move(*batch));
+
+            while (open && !early.empty() && early.begin()->first == next)
+            {
+                PlayerBatch ready = std::move(early.begin()->second);
+                early.erase(early.begin());
+                ++next;
+
+                auto& players = ready.players;
+                const auto kept = std::remove_if(
+                    players.begin(), players.end(),
+                    [&seen](const std::shared_ptr<Player>& p)
+                    {
+                        if (!p || p->GetPlayerId() < 0) return true;
+                        return p->GetPlayerId() != 0 &&
+                            !seen.insert(p->GetPlayerId()).second;
+                    });
+                stats.items += players.size();
+                ready.rejected = static_cast<std::size_t>(
+                    players.end() - kept);
+                players.erase(kept, players.end());
+                stats.busyNs += Lap(mark);
+
+                open = out.Push(std::move(ready));
+                stats.waitNs += Lap(mark);
+            }
+        }
+        out.Close();
+    }
+}
+
+namespace FootballManagement
+{
+    IngestPipeline::IngestPipeline(IngestOptions options)
+        : options_(options)
+    {
+        if (options_.parseWorkers == 0)
+            options_.parseWorkers =
+                std::max(1u, std::thread::hardware_concurrency());
+        if (options_.batchLines == 0) options_.batchLines = 1;
+        if (options_.readChunk == 0) options_.readChunk = 1;
+    }
+
+    IngestReport IngestPipeline::Run(const std::string& path,
+                                     ClubManager& club) const
+    {
+        FM_TRACE_SCOPE("IngestPipeline::Run");
+        auto start = Clock::now();
+
+        IngestReport report;
+        IngestStageStats read{"read"};
+        IngestStageStats split{"split"};
+        std::vector<IngestStageStats> parse(options_.parseWorkers,
+                                            IngestStageStats{"parse"});
+        IngestStageStats validate{"validate"};
+        IngestStageStats insert{"insert"};
+        bool readOk = false;
+        bool headerSeen = false;
+
+        {
+            Channels channels(options_.queueCapacity);
+            auto& threads = channels.threads;
+            threads.emplace_back([&]()
+            {
+                ReadStage(path, options_.readChunk, channels.chunks, read,
+                          readOk);
+            });
+            threads.emplace_back([&]()
+            {
+                SplitStage(options_.batchLines, channels.chunks,
+                           channels.lines, split);
+            });
+
+            // Останній потік parse закриває чергу для validate.
+            auto running = std::make_shared<std::atomic<unsigned>>(
+                options_.parseWorkers);
+            for (auto& stats : parse)
+                threads.emplace_back([&channels, &stats, running]()
+                {
+                    ParseStage(channels.lines, channels.parsed, stats);
+                    if (running->fetch_sub(1) == 1) channels.parsed.Close();
+                });
+            threads.emplace_back([&]()
+            {
+                ValidateStage(channels.parsed, channels.valid, validate);
+            });
+
+            // Етап insert: ClubManager змінюється лише в потоці виклику.
+            auto mark = Clock::now();
+            while (auto batch = channels.valid.Pop())
+            {
+                insert.waitNs += Lap(mark);
+                if (batch->hasHeader)
+                {
+                    club.ResetFromHeader(batch->header);
+                    headerSeen = true;
+                }
+                report.skipped += batch->rejected;
+                for (const auto& p : batch->players)
+                    ++(club.AdoptLoadedPlayer(p) ? report.inserted
+                                                 : report.skipped);
+                insert.items += batch->players.size();
+                insert.busyNs += Lap(mark);
+            }
+        }
+
+        if (!headerSeen) club.ResetFromHeader({});
+
+        IngestStageStats parseTotal{"parse"};
+        for (const auto& stats : parse)
+        {
+            parseTotal.items += stats.items;
+            parseTotal.busyNs += stats.busyNs;
+            parseTotal.waitNs += stats.waitNs;
+        }
+        report.stages = {read, split, parseTotal, validate, insert};
+        report.ok = readOk;
+        std::error_code ec;
+        report.fileMissing = !readOk && !std::filesystem::exists(path, ec);
+        report.totalNs = Lap(start);
+
+        if (report.fileMissing)
+            Console() << "[ІНФО] Файлу гравців немає, склад порожній: "
+                << path << "\n";
+        else if (!readOk)
+            Console() << "[ПОМИЛКА] Не вдалося прочитати файл гравців: "
+                << path << "\n";
+        else if (report.skipped > 0)
+            Console() << "[ПОПЕРЕДЖЕННЯ] Пропущено рядків гравців: "
+                << report.skipped << " (невідомий role або повтор ID).\n";
+        return report;
+    }
+}
@@ -0,0 +1,377 @@
+#include "../include/LeagueManager.h"
+#include "../include/Console.h"
+#include "../include/ContractedPlayer.h"
+#include "../include/Trace.h"
+
+#include <iostream>
+#include <stdexcept>
+
+namespace
+{
+    /// Виконати крок трансферу; його виняток отримає той, хто чекає future.
+    template <typename Step>
+    void Guarded(const std::shared_ptr<std::promise<bool>>& result,
+                 Step&& step)
+    {
+        try
+        {
+            step();
+        }
+        catch (...)
+        {
+            result->set_exception(std::current_exception());
+        }
+    }
+}
+
+namespace FootballManagement
+{
+    LeagueManager::LeagueManager(unsigned shardCount)
+        : nextClubId_(1),
+          pending_(0)
+    {
+        if (shardCount == 0)
+            shardCount = std::max(1u, std::thread::hardware_concurrency());
+
+        shards_.reserve(shardCount);
+        for (unsigned i = 0; i < shardCount; ++i)
+            shards_.push_back(std::make_unique<Shard>());
+        for (auto& shard : shards_)
+            shard->worker = std::thread([this, s = shard.get()]()
+            {
+                ShardLoop(*s);
+            });
+    }
+
+    LeagueManager::~LeagueManager()
+    {
+        // Спершу завершуються ланцюжки повідомлень між шардами.
+        WaitIdle();
+        for (auto& shard : shards_)
+        {
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                shard->stopping = true;
+            }
+            shard->wake.notify_one();
+        }
+        for (auto& shard : shards_)
+            if (shard->worker.joinable()) shard->worker.join();
+    }
+
+    void LeagueManager::ShardLoop(Shard& shard)
+    {
+        ScopedConsoleMute mute;
+        for (;;)
+        {
+            std::function<void()> message;
+            {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                shard.wake.wait(lock, [&shard]()
+                {
+                    return shard.stopping || !shard.mailbox.empty();
+                });
+                if (shard.mailbox.empty()) break; // stopping і скринька порожня
+                message = std::move(shard.mailbox.front());
+                shard.mailbox.pop_front();
+            }
+            // Виняток повідомлення не має зупиняти шард і WaitIdle().
+            try
+            {
+                message();
+            }
+            catch (const std::exception& e)
+            {
+                Console() << "[ПОМИЛКА] Повідомлення шарду: " << e.what()
+                    << "\n";
+            }
+
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            if (--pending_ == 0) idle_.notify_all();
+        }
+
+        // Клуби та гравці знищуються потоком, що ними володів.
+        shard.clubs.clear();
+    }
+
+    void LeagueManager::Post(std::size_t shard,
+                             std::function<void()> message) const
+    {
+        Shard& target = *shards_[shard];
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            ++pending_;
+        }
+        {
+            std::lock_guard<std::mutex> lock(target.mutex);
+            target.mailbox.push_back(std::move(message));
+        }
+        target.wake.notify_one();
+    }
+
+    std::size_t LeagueManager::RequireShard(int clubId) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(directoryMutex_);
+            if (clubNames_.count(clubId) == 0)
+                throw std::invalid_argument(
+                    "Клубу з ID " + std::to_string(clubId) + " немає в лізі.");
+        }
+        return ShardOf(clubId);
+    }
+
+    int LeagueManager::AddClub(const std::string& name, double budget)
+    {
+        if (name.empty())
+            throw std::invalid_argument("Назва клубу не може бути порожньою.");
+        if (budget < 0.0)
+            throw std::invalid_argument("Бюджет не може бути від’ємним.");
+
+        int clubId;
+        {
+            std::lock_guard<std::mutex> lock(directoryMutex_);
+            clubId = nextClubId_++;
+            clubNames_.emplace(clubId, name);
+        }
+
+        // Скринька FIFO: наступні повідомлення шарду вже бачать клуб.
+        Shard* shard = shards_[ShardOf(clubId)].get();
+        Post(ShardOf(clubId), [shard, clubId, name, budget]()
+        {
+            shard->clubs.emplace(
+                clubId, std::make_unique<ClubManager>(name, budget));
+        });
+        return clubId;
+    }
+
+    unsigned LeagueManager::GetShardCount() const
+    {
+        return static_cast<unsigned>(shards_.size());
+    }
+
+    std::size_t LeagueManager::GetClubCount() const
+    {
+        std::lock_guard<std::mutex> lock(directoryMutex_);
+        return clubNames_.size();
+    }
+
+    std::vector<int> LeagueManager::GetClubIds() const
+    {
+        std::vector<int> ids;
+        {
+            std::lock_guard<std::mutex> lock(directoryMutex_);
+            ids.reserve(clubNames_.size());
+            for (const auto& [id, _] : clubNames_) ids.push_back(id);
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    std::string LeagueManager::GetClubName(int clubId) const
+    {
+        std::lock_guard<std::mutex> lock(directoryMutex_);
+        const auto it = clubNames_.find(clubId);
+        return it == clubNames_.end() ? std::string() : it->second;
+    }
+
+    std::future<bool> LeagueManager::TransferPlayer(int playerId,
+                                                    int fromClubId,
+                                                    int toClubId, double fee)
+    {
+        auto result = std::make_shared<std::promise<bool>>();
+        auto future = result->get_future();
+
+        if (fromClubId == toClubId || fee < 0.0 ||
+            GetClubName(fromClubId).empty() || GetClubName(toClubId).empty())
+        {
+            Console() << "[ПОМИЛКА] Некоректний трансфер між клубами "
+                << fromClubId << " і " << toClubId << ".\n";
+            result->set_value(false);
+            return future;
+        }
+
+        const std::size_t buyerShard = ShardOf(toClubId);
+        const std::size_t sellerShard = ShardOf(fromClubId);
+        Shard* buyer = shards_[buyerShard].get();
+        Shard* seller = shards_[sellerShard].get();
+
+        // Крок 4: продавець отримує суму або свого гравця назад.
+        auto settle = [seller, fromClubId, fee, result](
+            std::shared_ptr<ContractedPlayer> returned)
+        {
+            Guarded(result, [&]()
+            {
+                ClubManager& club = *seller->clubs.at(fromClubId);
+                if (returned)
+                {
+                    club.AddPlayer(std::move(returned));
+                    result->set_value(false);
+                    return;
+                }
+                club.SetTransferBudget(club.GetTransferBudget() + fee);
+                result->set_value(true);
+            });
+        };
+
+        // Крок 3: покупець приймає гравця або повертає резерв.
+        auto complete = [this, buyer, sellerShard, toClubId, fee, result,
+                settle](std::shared_ptr<ContractedPlayer> player)
+        {
+            Guarded(result, [&]()
+            {
+                ClubManager& club = *buyer->clubs.at(toClubId);
+                bool held = false;
+                if (player)
+                {
+                    // AddPlayer сам змінює ID, зайнятий у складі покупця.
+                    try
+                    {
+                        club.AddPlayer(player);
+                        held = club.FindPlayerById(player->GetPlayerId()) ==
+                            player;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        Console() << "[ПОМИЛКА] " << e.what() << "\n";
+                    }
+                }
+
+                if (!held)
+                {
+                    club.SetTransferBudget(club.GetTransferBudget() + fee);
+                    if (!player)
+                    {
+                        result->set_value(false);
+                        return;
+                    }
+                }
+                else
+                {
+                    // Контракт переписується, лише коли гравець уже тут.
+                    player->TransferToClub(club.GetClubName(), fee);
+                    player.reset();
+                }
+
+                Post(sellerShard, [settle, player = std::move(player)]()
+                    mutable
+                {
+                    settle(std::move(player));
+                });
+            });
+        };
+
+        // Крок 2: продавець віддає гравця (або відмовляє).
+        auto release = [this, seller, buyerShard, fromClubId, playerId, fee,
+                complete]()
+        {
+            std::shared_ptr<ContractedPlayer> moved;
+            try
+            {
+                ClubManager& club = *seller->clubs.at(fromClubId);
+                const auto cp = std::dynamic_pointer_cast<ContractedPlayer>(
+                    club.FindPlayerById(playerId));
+                if (cp && cp->IsListedForTransfer() &&
+                    fee >= cp->GetTransferFee())
+                {
+                    club.RemovePlayers(playerId);
+                    moved = cp;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                // Без гравця крок 3 поверне покупцю резерв.
+                Console() << "[ПОМИЛКА] " << e.what() << "\n";
+                moved.reset();
+            }
+
+            Post(buyerShard, [complete, moved = std::move(moved)]() mutable
+            {
+                complete(std::move(moved));
+            });
+        };
+
+        // Крок 1: покупець резервує суму.
+        Post(buyerShard, [this, buyer, sellerShard, toClubId, fee, result,
+                 release]()
+        {
+            Guarded(result, [&]()
+            {
+                ClubManager& club = *buyer->clubs.at(toClubId);
+                if (club.GetTransferBudget() < fee)
+                {
+                    result->set_value(false);
+                    return;
+                }
+                club.SetTransferBudget(club.GetTransferBudget() - fee);
+
+                Post(sellerShard, release);
+            });
+        });
+
+        return future;
+    }
+
+    void LeagueManager::WaitIdle() const
+    {
+        std::unique_lock<std::mutex> lock(idleMutex_);
+        idle_.wait(lock, [this]() { return pending_ == 0; });
+    }
+
+    std::vector<LeaguePlayerSnapshot> LeagueManager::CollectSnapshots(
+        const std::function<std::vector<std::shared_ptr<Player>>(
+            const ClubManager&)>& query) const
+    {
+        auto rows = ForEachClub([&query](const ClubManager& club)
+        {
+            std::vector<LeaguePlayerSnapshot> found;
+            for (const auto& p : query(club))
+            {
+                LeaguePlayerSnapshot snapshot;
+                snapshot.clubName = club.GetClubName();
+                snapshot.player = p->Clone();
+                found.push_back(std::move(snapshot));
+            }
+            return found;
+        });
+
+        std::vector<LeaguePlayerSnapshot> result;
+        for (auto& [clubId, found] : rows)
+        {
+            for (auto& snapshot : found)
+            {
+                snapshot.clubId = clubId;
+                result.push_back(std::move(snapshot));
+            }
+        }
+        return result;
+    }
+
+    std::vector<LeaguePlayerSnapshot>
+    LeagueManager::SearchByName(const std::string& q) const
+    {
+        FM_TRACE_SCOPE("LeagueManager::SearchByName");
+        return CollectSnapshots([&q](const ClubManager& club)
+        {
+            return club.SearchByName(q);
+        });
+    }
+
+    std::vector<LeaguePlayerSnapshot>
+    LeagueManager::FilterByStatus(const std::string& status) const
+    {
+        FM_TRACE_SCOPE("LeagueManager::FilterByStatus");
+        return CollectSnapshots([&status](const ClubManager& club)
+        {
+            return club.FilterByStatus(status);
+        });
+    }
+
+    std::size_t LeagueManager::GetTotalPlayerCount() const
+    {
+        std::size_t total = 0;
+        for (const auto& [_, count] : ForEachClub(
+                 [](const ClubManager& club) { return club.GetAll().size(); }))
+            total += count;
+        return total;
+    }
+}
@@ -1,5 +1,4 @@
 #include "../include/Menu.h"
-#include "../include/SeedDemo.h"
 
 #include "../include/ContractedPlayer.h"
 #include "../include/FreeAgent.h"
@@ -8,6 +7,7 @@
 #include "../include/FileManager.h"
 #include "../include/Utils.h"
 #include "../include/InputValidator.h"
+#include "../include/Trace.h"
 
 #include <iostream>
 #include <string>
@@ -15,62 +15,72 @@
 #include <stdexcept>
 #include <iomanip>
 #include <limits>
+#include <vector>
 
 namespace FootballManagement
 {
     Menu::Menu(std::shared_ptr<ClubManager> clubManager)
         : clubManager_(std::move(clubManager)),
           fileManager_(),
-          isRunning_(true)
+          userStore_(fileManager_),
+          startup_(clubManager_, fileManager_),
+          metricsExporter_(fileManager_),
+          isRunning_(true),
+          lossySaveAllowed_(false)
     {
     }
 
-    void Menu::LoadAllData() const
+    void Menu::LoadAllData()
     {
-        try
-        {
-            const auto userLines = fileManager_.LoadFromFile(USERS_FILE_NAME);
-            AuthManager::GetInstance().DeserializeAllUsers(userLines);
-            std::cout << "[ІНФО] Дані користувачів завантажено.\n";
-        }
-        catch (const std::exception& e)
-        {
-            std::cout << "[ПОМИЛКА] Не вдалося завантажити користувачів: "
-                << e.what() << "\n";
-        }
+        FM_TRACE_SCOPE("Menu::LoadAllData");
+        // Повертається, щойно готові користувачі; склад вантажиться у фоні.
+        startup_.Start(AuthManager::GetInstance(), userStore_);
+    }
 
-        try
-        {
-            const auto playerLines = fileManager_.LoadFromFile(
-                PLAYERS_DATA_FILE);
-            clubManager_->DeserializeAllPlayers(playerLines);
-            std::cout << "[ІНФО] Дані гравців завантажено.\n";
-        }
-        catch (const std::exception& e)
-        {
-            std::cout << "[ПОМИЛКА] Не вдалося завантажити гравців: "
-                << e.what() << "\n";
+    void Menu::SaveAllData()
+    {
+        FM_TRACE_SCOPE("Menu::SaveAllData");
+        // Як --allow-lossy-load у пакетного інструмента й сервера: неповний
+        // склад перезаписує файл лише з явної згоди.
+        if (startup_.IsRosterLossy() && !lossySaveAllowed_)
+        {
+            std::cout << "[ПОПЕРЕДЖЕННЯ] Склад завантажено не повністю. "
+                "Збереження перезапише " << PLAYERS_DATA_FILE
+                << " без незавантажених гравців.\n";
+            if (!InputValidator::GetYesNoInput("Все одно зберегти?"))
+            {
+                std::cout << "[ІНФО] Дані не збережено.\n";
+                return;
+            }
+            lossySaveAllowed_ = true;
         }
+        std::cout << "[ІНФО] Збереження даних...\n";
+        std::vector<FileSaveRequest> files(1);
+        files[0].fileName = PLAYERS_DATA_FILE;
+        files[0].object = &startup_.Roster();
 
-        if (clubManager_->GetAll().empty())
+        // Зміни користувачів уже в журналі; знімок переписуємо лише за
+        // порогом — у тому ж пакеті, що й склад.
+        const bool compactUsers = userStore_.IsCompactionDue();
+        if (compactUsers)
+            files.push_back(
+                userStore_.SnapshotRequest(AuthManager::GetInstance()));
+
+        if (!fileManager_.SaveBatch(files))
         {
-            std::cout << "[ІНФО] Склад порожній — додаю демо-гравців.\n";
-            SeedDemoData(*clubManager_);
-            fileManager_.SaveToFile(PLAYERS_DATA_FILE, *clubManager_);
+            std::cout << "[ПОМИЛКА] Не всі дані збережено.\n";
+            return;
         }
-    }
-
-    void Menu::SaveAllData() const
-    {
-        std::cout << "[ІНФО] Збереження даних...\n";
-        fileManager_.SaveToFile(USERS_FILE_NAME, AuthManager::GetInstance());
-        fileManager_.SaveToFile(PLAYERS_DATA_FILE, *clubManager_);
+        if (compactUsers) userStore_.FinishCompaction();
         std::cout << "[УСПІХ] Усі дані збережено.\n";
     }
 
     void Menu::Run()
     {
         LoadAllData();
+        // Холодний старт записується одразу, навіть якщо сеанс обірветься.
+        if constexpr (TRACING_ENABLED)
+            Tracer::GetInstance().WriteChromeTrace(fileManager_);
         authenticateUser();
 
         if (!AuthManager::GetInstance().IsLoggedIn())
@@ -79,6 +89,13 @@ namespace FootballManagement
             return;
         }
 
+        // Далі склад змінюється від імені користувача — з його правами.
+        startup_.Roster().SetActorPermissions(
+            AuthManager::GetInstance().GetCurrentUser()->GetPermissions());
+        // Тепер у трасі є й фонове завантаження складу.
+        if constexpr (TRACING_ENABLED)
+            Tracer::GetInstance().WriteChromeTrace(fileManager_);
+
         while (isRunning_)
         {
             displayMainMenu();
@@ -137,10 +154,11 @@ namespace FootballManagement
                                            ? UserRole::Admin
                                            : UserRole::StandardUser);
 
-                if (AuthManager::GetInstance().Register(login, password, role))
+                auto& auth = AuthManager::GetInstance();
+                if (auth.Register(login, password, role))
                 {
-                    fileManager_.SaveToFile(USERS_FILE_NAME,
-                                            AuthManager::GetInstance());
+                    if (const auto user = auth.FindUser(login))
+                        userStore_.RecordPut(*user);
                     std::cout << "[УСПІХ] Обліковий запис створено.\n";
                 }
             }
@@ -165,7 +183,7 @@ namespace FootballManagement
         std::cout << "3. Пошук / Сортування / Фільтрація\n";
         std::cout << "4. Трансферний ринок (Підписати агента)\n";
 
-        if (AuthManager::GetInstance().GetCurrentUser()->IsAdmin())
+        if (AuthManager::GetInstance().CurrentUserCan(Permission::ManageUsers))
             std::cout << "5. Керування користувачами (Admin)\n";
 
         std::cout << "6. Рейтинг і стати\n";
@@ -178,8 +196,11 @@ namespace FootballManagement
 
     void Menu::handleMainMenu(int choice)
     {
-        const auto user = AuthManager::GetInstance().GetCurrentUser();
-        const bool isAdmin = user->IsAdmin();
+        const auto& auth = AuthManager::GetInstance();
+        const bool canManageUsers =
+            auth.CurrentUserCan(Permission::ManageUsers);
+        const bool canEditPlayers =
+            auth.CurrentUserCan(Permission::EditPlayers);
 
         switch (choice)
         {
@@ -192,7 +213,7 @@ namespace FootballManagement
         case 4: transferFlow();
             break;
         case 5:
-            if (isAdmin) manageUsersFlow();
+            if (canManageUsers) manageUsersFlow();
             else std::cout << "[ВІДМОВА] Необхідні права адміністратора.\n";
             break;
 
@@ -208,6 +229,11 @@ namespace FootballManagement
                     int c = InputValidator::GetIntInRange("Ваш вибір: ", 0, 3);
                     if (c == 0) break;
                     if (c == 1) RatingShowAndSortFlow();
+                    if (c >= 2 && !canEditPlayers)
+                    {
+                        std::cout << "[ВІДМОВА] Недостатньо прав.\n";
+                        continue;
+                    }
                     if (c == 2) EditPlayerStatsFlow();
                     if (c == 3) AdjustMarketValuePercentFlow();
                 }
@@ -291,7 +317,7 @@ namespace FootballManagement
         {
             auto gk = std::make_shared<Goalkeeper>(
                 name, age, nationality, origin, height, weight, value);
-            clubManager_->AddPlayer(gk);
+            startup_.Roster().AddPlayer(gk);
             std::cout << "[УСПІХ] Воротаря додано.\n";
             return;
         }
@@ -311,7 +337,7 @@ namespace FootballManagement
             auto p = std::make_shared<ContractedPlayer>(
                 name, age, nationality, origin, height, weight, value,
                 position, salary, contractUntil);
-            clubManager_->AddPlayer(p);
+            startup_.Roster().AddPlayer(p);
             std::cout << "[УСПІХ] Контрактного гравця додано.\n";
         }
         else
@@ -326,7 +352,7 @@ namespace FootballManagement
             auto a = std::make_shared<FreeAgent>(
                 name, age, nationality, origin, height, weight, value,
                 position, expectedSalary, lastClub);
-            clubManager_->AddPlayer(a);
+            startup_.Roster().AddPlayer(a);
             std::cout << "[УСПІХ] Вільного агента додано.\n";
         }
     }
@@ -337,17 +363,7 @@ namespace FootballManagement
         int id = InputValidator::GetIntInput("Введіть ID гравця (0 - назад): ");
         if (id == 0) return;
 
-        auto& players = clubManager_->GetAll();
-        std::shared_ptr<Player> player = nullptr;
-
-        for (const auto& p : players)
-        {
-            if (p && p->GetPlayerId() == id)
-            {
-                player = p;
-                break;
-            }
-        }
+        const auto player = startup_.Roster().FindPlayerById(id);
         if (!player)
         {
             std::cout << "[ПОМИЛКА] Гравця з таким ID не знайдено.\n";
@@ -413,7 +429,7 @@ namespace FootballManagement
         try
         {
             int id = std::stoi(raw);
-            clubManager_->RemovePlayers(id);
+            startup_.Roster().RemovePlayers(id);
             std::cout << "[УСПІХ] Якщо гравець існував — видалено.\n";
         }
         catch (...)
@@ -424,7 +440,7 @@ namespace FootballManagement
 
     void Menu::viewPlayersFlow() const
     {
-        clubManager_->ViewAllPlayers();
+        startup_.Roster().ViewAllPlayers();
         std::cout << "Натисніть Enter, щоб повернутись у меню...";
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         std::cin.get();
@@ -449,7 +465,7 @@ namespace FootballManagement
                     InputValidator::GetNonEmptyString(
                         "Ім’я або частина (0 - назад): ");
                 if (q == "0") continue;
-                const auto res = clubManager_->SearchByName(q);
+                const auto res = startup_.Roster().SearchByName(q);
                 for (const auto& p : res)
                 {
                     p->ShowInfo();
@@ -462,8 +478,8 @@ namespace FootballManagement
             }
             else if (choice == 2)
             {
-                clubManager_->SortByPerformanceRating();
-                clubManager_->ViewAllPlayers();
+                startup_.Roster().SortByPerformanceRating();
+                startup_.Roster().ViewAllPlayers();
                 std::cout << "Натисніть Enter, щоб продовжити...";
                 std::cin.ignore(std::numeric_limits<std::streamsize>::max(),
                                 '\n');
@@ -474,7 +490,7 @@ namespace FootballManagement
                 std::string st = InputValidator::GetNonEmptyString(
                     "Статус (0 - назад): ");
                 if (st == "0") continue;
-                const auto res = clubManager_->FilterByStatus(st);
+                const auto res = startup_.Roster().FilterByStatus(st);
                 for (const auto& p : res)
                 {
                     p->ShowInfo();
@@ -496,7 +512,7 @@ namespace FootballManagement
                 "Пошук агента за ім’ям (0 - назад): ");
         if (nameQuery == "0") return;
 
-        const auto found = clubManager_->SearchByName(nameQuery);
+        const auto found = startup_.Roster().SearchByName(nameQuery);
         std::shared_ptr<FreeAgent> agent = nullptr;
         for (const auto& p : found)
         {
@@ -518,7 +534,7 @@ namespace FootballManagement
                 "Контракт до (YYYY-MM-DD) (0 - назад): ");
         if (until == "0") return;
 
-        if (clubManager_->SignFreeAgent(agent, offer, until))
+        if (startup_.Roster().SignFreeAgent(agent, offer, until))
             std::cout << "[УСПІХ] Контракт підписано.\n";
         else
             std::cout << "[ПОМИЛКА] Не вдалося підписати контракт.\n";
@@ -533,15 +549,30 @@ namespace FootballManagement
 
             std::cout << "1. Створити користувача\n";
             std::cout << "2. Видалити користувача\n";
+            std::cout << "3. Призначити власну роль (" << ROLES_CONFIG_FILE
+                << ")\n";
             std::cout << "0. Назад\n";
 
-            int choice = InputValidator::GetIntInRange("Ваш вибір: ", 0, 2);
+            int choice = InputValidator::GetIntInRange("Ваш вибір: ", 0, 3);
             if (choice == 0) return;
 
             if (choice == 1)
             {
                 adminCreateUser();
             }
+            else if (choice == 3)
+            {
+                const std::string login = InputValidator::GetNonEmptyString(
+                    "Логін (0 - назад): ");
+                if (login == "0") continue;
+                std::string roleName = InputValidator::GetNonEmptyString(
+                    "Назва ролі (- стандартна): ");
+                if (roleName == "-") roleName.clear();
+
+                auto& auth = AuthManager::GetInstance();
+                if (auth.AssignCustomRole(login, roleName))
+                    userStore_.RecordPut(*auth.FindUser(login));
+            }
             else
             {
                 std::string login =
@@ -551,9 +582,8 @@ namespace FootballManagement
 
                 if (InputValidator::GetYesNoInput("Підтвердити видалення?"))
                 {
-                    AuthManager::GetInstance().DeleteUser(login);
-                    fileManager_.SaveToFile(USERS_FILE_NAME,
-                                            AuthManager::GetInstance());
+                    if (AuthManager::GetInstance().DeleteUser(login))
+                        userStore_.RecordDelete(login);
                     std::cout << "[УСПІХ] Видалено (якщо існував).\n";
                 }
                 else
@@ -578,14 +608,15 @@ namespace FootballManagement
             "Роль (1=Admin, 2=User, 0=Назад): ", 0, 2);
         if (role == 0) return;
 
-        const bool ok = AuthManager::GetInstance().Register(
+        auto& auth = AuthManager::GetInstance();
+        const bool ok = auth.Register(
             login, password,
             (role == 1 ? UserRole::Admin : UserRole::StandardUser));
 
         if (ok)
         {
-            fileManager_.
-                SaveToFile(USERS_FILE_NAME, AuthManager::GetInstance());
+            if (const auto user = auth.FindUser(login))
+                userStore_.RecordPut(*user);
             std::cout << "[УСПІХ] Користувача створено.\n";
         }
         else
@@ -597,7 +628,7 @@ namespace FootballManagement
 
     void Menu::RatingShowAndSortFlow()
     {
-        auto& players = clubManager_->GetAll();
+        auto& players = startup_.Roster().GetAll();
         if (players.empty())
         {
             std::cout << "[ПОПЕРЕДЖЕННЯ] Немає гравців у складі.\n";
@@ -614,9 +645,9 @@ namespace FootballManagement
                 << p->CalculatePerformanceRating() << "\n";
         }
 
-        clubManager_->SortByPerformanceRating(); // спадно
+        startup_.Roster().SortByPerformanceRating(); // спадно
         std::cout << "\n[ІНФО] Відсортовано за рейтингом (спадно).\n";
-        clubManager_->ViewAllPlayers();
+        startup_.Roster().ViewAllPlayers();
     }
 
     void Menu::AdjustMarketValuePercentFlow()
@@ -631,7 +662,7 @@ namespace FootballManagement
         double percent =
             InputValidator::GetDoubleInput("Відсоток (наприклад, 10 або -5): ");
 
-        auto& players = clubManager_->GetAll();
+        auto& players = startup_.Roster().GetAll();
         if (players.empty())
         {
             std::cout << "[ПОПЕРЕДЖЕННЯ] Немає гравців.\n";
@@ -641,18 +672,15 @@ namespace FootballManagement
         if (m == 1)
         {
             int id = InputValidator::GetIntInput("ID гравця: ");
-            for (const auto& p : players)
+            if (const auto p = startup_.Roster().FindPlayerById(id))
             {
-                if (p && p->GetPlayerId() == id)
-                {
-                    double cur = p->GetMarketValue();
-                    double nv = cur * (1.0 + percent / 100.0);
-                    p->SetMarketValue(nv);
-                    std::cout << "[УСПІХ] Оновлено MV гравця " << p->GetName()
-                        << " з " << cur << " до " << nv << ".\n";
-                    SaveAllData();
-                    return;
-                }
+                double cur = p->GetMarketValue();
+                double nv = cur * (1.0 + percent / 100.0);
+                p->SetMarketValue(nv);
+                std::cout << "[УСПІХ] Оновлено MV гравця " << p->GetName()
+                    << " з " << cur << " до " << nv << ".\n";
+                SaveAllData();
+                return;
             }
             std::cout << "[ПОМИЛКА] Гравця з таким ID не знайдено.\n";
             return;
@@ -675,16 +703,7 @@ namespace FootballManagement
         int id = InputValidator::GetIntInput("ID гравця (0 - назад): ");
         if (id == 0) return;
 
-        auto& players = clubManager_->GetAll();
-        std::shared_ptr<Player> base = nullptr;
-        for (const auto& p : players)
-        {
-            if (p && p->GetPlayerId() == id)
-            {
-                base = p;
-                break;
-            }
-        }
+        const auto base = startup_.Roster().FindPlayerById(id);
         if (!base)
         {
             std::cout << "[ПОМИЛКА] Гравця не знайдено.\n";
@@ -0,0 +1,201 @@
+#include "../include/Metrics.h"
+#include "../include/Console.h"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    struct MetricInfo
+    {
+        const char* name;
+        const char* help;
+    };
+
+    constexpr std::array<MetricInfo, METRIC_COUNTER_COUNT> COUNTER_INFO = {{
+        {"footballmgmt_file_save_errors_total", "Невдалі збереження файлів."},
+        {"footballmgmt_file_load_errors_total", "Невдалі читання файлів."},
+        {"footballmgmt_search_results_total", "Гравців знайдено пошуком."},
+        {"footballmgmt_signings_total", "Підписані вільні агенти."}
+    }};
+
+    constexpr std::array<MetricInfo, METRIC_HISTOGRAM_COUNT> HISTOGRAM_INFO = {{
+        {"footballmgmt_file_save_seconds", "Тривалість FileManager::SaveToFile."},
+        {"footballmgmt_file_load_seconds", "Тривалість FileManager::LoadFromFile."},
+        {"footballmgmt_search_by_name_seconds",
+         "Тривалість ClubManager::SearchByName."},
+        {"footballmgmt_filter_by_status_seconds",
+         "Тривалість ClubManager::FilterByStatus."},
+        {"footballmgmt_sign_free_agent_seconds",
+         "Тривалість ClubManager::SignFreeAgent."}
+    }};
+
+    /// Межі кошиків у звіті: 2^k нс від ~1 мкс до ~69 с (стабільний набір).
+    constexpr unsigned EXPORT_FIRST_EXPONENT = 10;
+    constexpr unsigned EXPORT_LAST_EXPONENT = 36;
+
+    /// Виключна верхня межа кошика @p bucket (нс).
+    std::uint64_t BucketUpperBound(std::size_t bucket)
+    {
+        if (bucket < HISTOGRAM_LINEAR_LIMIT) return bucket + 1;
+
+        const std::size_t offset = bucket - HISTOGRAM_LINEAR_LIMIT;
+        const unsigned exponent = static_cast<unsigned>(
+            offset / HISTOGRAM_SUB_BUCKETS) + HISTOGRAM_SUB_BITS + 1;
+        const std::uint64_t sub = offset % HISTOGRAM_SUB_BUCKETS;
+        const unsigned shift = exponent - HISTOGRAM_SUB_BITS;
+        if (exponent == 63 && sub == HISTOGRAM_SUB_BUCKETS - 1)
+            return ~std::uint64_t{0};
+        return (HISTOGRAM_SUB_BUCKETS + sub + 1) << shift;
+    }
+}
+
+namespace FootballManagement
+{
+    std::uint64_t HistogramSnapshot::CountBelow(std::uint64_t limit) const
+    {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < buckets.size(); ++i)
+        {
+            if (BucketUpperBound(i) > limit) break;
+            total += buckets[i];
+        }
+        return total;
+    }
+
+    MetricsRegistry& MetricsRegistry::GetInstance()
+    {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    MetricsThreadBlock& MetricsRegistry::RegisterThread()
+    {
+        auto block = std::make_unique<MetricsThreadBlock>();
+        MetricsThreadBlock& ref = *block;
+        std::lock_guard lock(mutex_);
+        blocks_.push_back(std::move(block));
+        return ref;
+    }
+
+    MetricsSnapshot MetricsRegistry::Snapshot() const
+    {
+        MetricsSnapshot snapshot;
+        std::lock_guard lock(mutex_);
+        for (const auto& block : blocks_)
+        {
+            for (std::size_t c = 0; c < METRIC_COUNTER_COUNT; ++c)
+                snapshot.counters[c] +=
+                    block->counters[c].load(std::memory_order_relaxed);
+
+            for (std::size_t h = 0; h < METRIC_HISTOGRAM_COUNT; ++h)
+            {
+                const auto& source = block->histograms[h];
+                auto& target = snapshot.histograms[h];
+                for (std::size_t b = 0; b < HISTOGRAM_BUCKET_COUNT; ++b)
+                {
+                    const std::uint64_t n =
+                        source.buckets[b].load(std::memory_order_relaxed);
+                    target.buckets[b] += n;
+                    target.count += n;
+                }
+                target.sum += source.sum.load(std::memory_order_relaxed);
+            }
+        }
+        return snapshot;
+    }
+
+    std::string MetricsRegistry::RenderPrometheus() const
+    {
+        const MetricsSnapshot snapshot = Snapshot();
+        std::ostringstream ss;
+        ss << std::setprecision(9);
+
+        for (std::size_t c = 0; c < METRIC_COUNTER_COUNT; ++c)
+        {
+            const MetricInfo& info = COUNTER_INFO[c];
+            ss << "# HELP " << info.name << ' ' << info.help << '\n'
+                << "# TYPE " << info.name << " counter\n"
+                << info.name << ' ' << snapshot.counters[c] << '\n';
+        }
+
+        for (std::size_t h = 0; h < METRIC_HISTOGRAM_COUNT; ++h)
+        {
+            const MetricInfo& info = HISTOGRAM_INFO[h];
+            const HistogramSnapshot& hist = snapshot.histograms[h];
+            ss << "# HELP " << info.name << ' ' << info.help << '\n'
+                << "# TYPE " << info.name << " histogram\n";
+            for (unsigned e = EXPORT_FIRST_EXPONENT; e <= EXPORT_LAST_EXPONENT;
+                 ++e)
+            {
+                const std::uint64_t limit = std::uint64_t{1} << e;
+                ss << info.name << "_bucket{le=\"" <<
+                    static_cast<double>(limit) * 1e-9 << "\"} "
+                    << hist.CountBelow(limit) << '\n';
+            }
+            ss << info.name << "_bucket{le=\"+Inf\"} " << hist.count << '\n'
+                << info.name << "_sum " <<
+                static_cast<double>(hist.sum) * 1e-9 << '\n'
+                << info.name << "_count " << hist.count << '\n';
+        }
+        return ss.str();
+    }
+
+    MetricsExporter::MetricsExporter(FileManager fileManager,
+                                     std::chrono::milliseconds interval)
+        : fileManager_(std::move(fileManager)),
+          interval_(interval)
+    {
+        if (interval_.count() <= 0)
+            throw std::invalid_argument("Період запису метрик має бути > 0.");
+
+        worker_ = std::thread([this]()
+        {
+            std::unique_lock lock(mutex_);
+            while (!wake_.wait_for(lock, interval_,
+                                   [this]() { return stopping_; }))
+            {
+                lock.unlock();
+                WriteNow();
+                lock.lock();
+            }
+        });
+    }
+
+    MetricsExporter::~MetricsExporter()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        if (worker_.joinable()) worker_.join();
+        WriteNow();
+    }
+
+    bool MetricsExporter::WriteNow() const
+    {
+        if (!fileManager_.EnsureDirectoryExists()) return false;
+
+        const std::string tempName = std::string(METRICS_FILE) + ".tmp";
+        {
+            std::ofstream file(fileManager_.GetFullPath(tempName),
+                               std::ios::out | std::ios::trunc);
+            if (!file.is_open())
+            {
+                Console() << "[ПОМИЛКА] Не вдалося записати метрики у "
+                    << tempName << ".\n";
+                return false;
+            }
+            file << MetricsRegistry::GetInstance().RenderPrometheus();
+            if (!file) return false;
+        }
+        return fileManager_.ReplaceFile(tempName, METRICS_FILE);
+    }
+}
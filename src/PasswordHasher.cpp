@@ -0,0 +1,518 @@
+#include "../include/PasswordHasher.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    // ---------------------------------------------------------------- SHA-256
+
+    constexpr std::uint32_t SHA256_K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+        0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+        0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+        0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+        0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+        0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    constexpr std::uint32_t Rotr(std::uint32_t x, int n)
+    {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    constexpr std::uint32_t Rotl(std::uint32_t x, int n)
+    {
+        return (x << n) | (x >> (32 - n));
+    }
+
+    class Sha256
+    {
+    private:
+        std::uint32_t state_[8] = {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+        std::uint8_t buffer_[64] = {};
+        std::size_t buffered_ = 0;
+        std::uint64_t totalBytes_ = 0;
+
+        void Compress(const std::uint8_t* block)
+        {
+            std::uint32_t w[64];
+            for (int i = 0; i < 16; ++i)
+                w[i] = (std::uint32_t(block[4 * i]) << 24) |
+                    (std::uint32_t(block[4 * i + 1]) << 16) |
+                    (std::uint32_t(block[4 * i + 2]) << 8) |
+                    std::uint32_t(block[4 * i + 3]);
+            for (int i = 16; i < 64; ++i)
+            {
+                const std::uint32_t s0 = Rotr(w[i - 15], 7) ^
+                    Rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                const std::uint32_t s1 = Rotr(w[i - 2], 17) ^
+                    Rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            std::uint32_t a = state_[0], b = state_[1], c = state_[2],
+                          d = state_[3], e = state_[4], f = state_[5],
+                          g = state_[6], h = state_[7];
+            for (int i = 0; i < 64; ++i)
+            {
+                const std::uint32_t s1 = Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25);
+                const std::uint32_t ch = (e & f) ^ (~e & g);
+                const std::uint32_t t1 = h + s1 + ch + SHA256_K[i] + w[i];
+                const std::uint32_t s0 = Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22);
+                const std::uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+                const std::uint32_t t2 = s0 + maj;
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+            }
+            state_[0] += a;
+            state_[1] += b;
+            state_[2] += c;
+            state_[3] += d;
+            state_[4] += e;
+            state_[5] += f;
+            state_[6] += g;
+            state_[7] += h;
+        }
+
+    public:
+        void Update(const std::uint8_t* data, std::size_t length)
+        {
+            totalBytes_ += length;
+            while (length > 0)
+            {
+                const std::size_t take = std::min(length, 64 - buffered_);
+                std::memcpy(buffer_ + buffered_, data, take);
+                buffered_ += take;
+                data += take;
+                length -= take;
+                if (buffered_ == 64)
+                {
+                    Compress(buffer_);
+                    buffered_ = 0;
+                }
+            }
+        }
+
+        void Final(std::uint8_t out[32])
+        {
+            const std::uint64_t bits = totalBytes_ * 8;
+            const std::uint8_t pad = 0x80;
+            const std::uint8_t zero = 0;
+            Update(&pad, 1);
+            while (buffered_ != 56) Update(&zero, 1);
+            std::uint8_t length[8];
+            for (int i = 0; i < 8; ++i)
+                length[i] = static_cast<std::uint8_t>(bits >> (56 - 8 * i));
+            Update(length, 8);
+            for (int i = 0; i < 8; ++i)
+            {
+                out[4 * i] = static_cast<std::uint8_t>(state_[i] >> 24);
+                out[4 * i + 1] = static_cast<std::uint8_t>(state_[i] >> 16);
+                out[4 * i + 2] = static_cast<std::uint8_t>(state_[i] >> 8);
+                out[4 * i + 3] = static_cast<std::uint8_t>(state_[i]);
+            }
+        }
+    };
+
+    // ------------------------------------------------- HMAC-SHA256 та PBKDF2
+
+    class HmacSha256
+    {
+    private:
+        Sha256 inner_;
+        Sha256 outer_;
+
+    public:
+        HmacSha256(const std::uint8_t* key, std::size_t keyLength)
+        {
+            std::uint8_t block[64] = {};
+            if (keyLength > 64)
+            {
+                Sha256 h;
+                h.Update(key, keyLength);
+                h.Final(block);
+            }
+            else
+            {
+                std::memcpy(block, key, keyLength);
+            }
+
+            std::uint8_t ipad[64];
+            std::uint8_t opad[64];
+            for (int i = 0; i < 64; ++i)
+            {
+                ipad[i] = block[i] ^ 0x36;
+                opad[i] = block[i] ^ 0x5c;
+            }
+            inner_.Update(ipad, 64);
+            outer_.Update(opad, 64);
+        }
+
+        void Update(const std::uint8_t* data, std::size_t length)
+        {
+            inner_.Update(data, length);
+        }
+
+        void Final(std::uint8_t out[32])
+        {
+            std::uint8_t innerDigest[32];
+            inner_.Final(innerDigest);
+            outer_.Update(innerDigest, 32);
+            outer_.Final(out);
+        }
+    };
+
+    /// PBKDF2-HMAC-SHA256 з однією ітерацією (саме так його вживає scrypt).
+    void Pbkdf2Sha256(const std::uint8_t* password, std::size_t passwordLength,
+                      const std::uint8_t* salt, std::size_t saltLength,
+                      std::uint8_t* out, std::size_t outLength)
+    {
+        const HmacSha256 keyed(password, passwordLength);
+        for (std::uint32_t block = 1; outLength > 0; ++block)
+        {
+            HmacSha256 mac = keyed;
+            mac.Update(salt, saltLength);
+            const std::uint8_t counter[4] = {
+                static_cast<std::uint8_t>(block >> 24),
+                static_cast<std::uint8_t>(block >> 16),
+                static_cast<std::uint8_t>(block >> 8),
+                static_cast<std::uint8_t>(block)
+            };
+            mac.Update(counter, 4);
+            std::uint8_t digest[32];
+            mac.Final(digest);
+
+            const std::size_t take = std::min<std::size_t>(32, outLength);
+            std::memcpy(out, digest, take);
+            out += take;
+            outLength -= take;
+        }
+    }
+
+    // ---------------------------------------------------------------- scrypt
+
+    void Salsa20_8(std::uint32_t b[16])
+    {
+        std::uint32_t x[16];
+        std::memcpy(x, b, sizeof(x));
+        for (int i = 0; i < 8; i += 2)
+        {
+            x[4] ^= Rotl(x[0] + x[12], 7);
+            x[8] ^= Rotl(x[4] + x[0], 9);
+            x[12] ^= Rotl(x[8] + x[4], 13);
+            x[0] ^= Rotl(x[12] + x[8], 18);
+            x[9] ^= Rotl(x[5] + x[1], 7);
+            x[13] ^= Rotl(x[9] + x[5], 9);
+            x[1] ^= Rotl(x[13] + x[9], 13);
+            x[5] ^= Rotl(x[1] + x[13], 18);
+            x[14] ^= Rotl(x[10] + x[6], 7);
+            x[2] ^= Rotl(x[14] + x[10], 9);
+            x[6] ^= Rotl(x[2] + x[14], 13);
+            x[10] ^= Rotl(x[6] + x[2], 18);
+            x[3] ^= Rotl(x[15] + x[11], 7);
+            x[7] ^= Rotl(x[3] + x[15], 9);
+            x[11] ^= Rotl(x[7] + x[3], 13);
+            x[15] ^= Rotl(x[11] + x[7], 18);
+            x[1] ^= Rotl(x[0] + x[3], 7);
+            x[2] ^= Rotl(x[1] + x[0], 9);
+            x[3] ^= Rotl(x[2] + x[1], 13);
+            x[0] ^= Rotl(x[3] + x[2], 18);
+            x[6] ^= Rotl(x[5] + x[4], 7);
+            x[7] ^= Rotl(x[6] + x[5], 9);
+            x[4] ^= Rotl(x[7] + x[6], 13);
+            x[5] ^= Rotl(x[4] + x[7], 18);
+            x[11] ^= Rotl(x[10] + x[9], 7);
+            x[8] ^= Rotl(x[11] + x[10], 9);
+            x[9] ^= Rotl(x[8] + x[11], 13);
+            x[10] ^= Rotl(x[9] + x[8], 18);
+            x[12] ^= Rotl(x[15] + x[14], 7);
+            x[13] ^= Rotl(x[12] + x[15], 9);
+            x[14] ^= Rotl(x[13] + x[12], 13);
+            x[15] ^= Rotl(x[14] + x[13], 18);
+        }
+        for (int i = 0; i < 16; ++i) b[i] += x[i];
+    }
+
+    /// scryptBlockMix: in і out — по 2r блоків по 16 слів.
+    void BlockMix(const std::uint32_t* in, std::uint32_t* out, std::uint32_t r)
+    {
+        std::uint32_t x[16];
+        std::memcpy(x, in + (2 * r - 1) * 16, sizeof(x));
+        for (std::uint32_t i = 0; i < 2 * r; ++i)
+        {
+            for (int k = 0; k < 16; ++k) x[k] ^= in[i * 16 + k];
+            Salsa20_8(x);
+            // Парні блоки — у першу половину, непарні — у другу.
+            std::memcpy(out + ((i / 2) + (i % 2) * r) * 16, x, sizeof(x));
+        }
+    }
+
+    void RoMix(std::uint8_t* block, std::uint32_t r, std::uint64_t n,
+               std::vector<std::uint32_t>& v)
+    {
+        const std::size_t words = 32 * r;
+        std::vector<std::uint32_t> x(words);
+        std::vector<std::uint32_t> y(words);
+
+        for (std::size_t k = 0; k < words; ++k)
+            x[k] = std::uint32_t(block[4 * k]) |
+                (std::uint32_t(block[4 * k + 1]) << 8) |
+                (std::uint32_t(block[4 * k + 2]) << 16) |
+                (std::uint32_t(block[4 * k + 3]) << 24);
+
+        for (std::uint64_t i = 0; i < n; ++i)
+        {
+            std::memcpy(&v[i * words], x.data(), words * 4);
+            BlockMix(x.data(), y.data(), r);
+            x.swap(y);
+        }
+
+        for (std::uint64_t i = 0; i < n; ++i)
+        {
+            const std::uint64_t j = x[(2 * r - 1) * 16] & (n - 1);
+            const std::uint32_t* vj = &v[j * words];
+            for (std::size_t k = 0; k < words; ++k) x[k] ^= vj[k];
+            BlockMix(x.data(), y.data(), r);
+            x.swap(y);
+        }
+
+        for (std::size_t k = 0; k < words; ++k)
+        {
+            block[4 * k] = static_cast<std::uint8_t>(x[k]);
+            block[4 * k + 1] = static_cast<std::uint8_t>(x[k] >> 8);
+            block[4 * k + 2] = static_cast<std::uint8_t>(x[k] >> 16);
+            block[4 * k + 3] = static_cast<std::uint8_t>(x[k] >> 24);
+        }
+    }
+
+    // ---------------------------------------------------------------- base64
+
+    constexpr char BASE64[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string Base64Encode(const std::vector<std::uint8_t>& data)
+    {
+        std::string out;
+        out.reserve((data.size() + 2) / 3 * 4);
+        std::uint32_t acc = 0;
+        int bits = 0;
+        for (const std::uint8_t byte : data)
+        {
+            acc = (acc << 8) | byte;
+            bits += 8;
+            while (bits >= 6)
+            {
+                bits -= 6;
+                out += BASE64[(acc >> bits) & 0x3F];
+            }
+        }
+        if (bits > 0) out += BASE64[(acc << (6 - bits)) & 0x3F];
+        return out;
+    }
+
+    bool Base64Decode(const std::string& text, std::vector<std::uint8_t>& out)
+    {
+        out.clear();
+        std::uint32_t acc = 0;
+        int bits = 0;
+        for (const char c : text)
+        {
+            const char* pos = std::strchr(BASE64, c);
+            if (c == '\0' || !pos) return false;
+            acc = (acc << 6) | static_cast<std::uint32_t>(pos - BASE64);
+            bits += 6;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                out.push_back(static_cast<std::uint8_t>(acc >> bits));
+            }
+        }
+        return true;
+    }
+
+    const std::string HASH_PREFIX = "$scrypt$";
+    constexpr std::size_t SALT_BYTES = 16;
+    constexpr std::size_t DIGEST_BYTES = 32;
+    /// У скільки разів збережений хеш може бути дорожчим за нові.
+    constexpr std::size_t MAX_VERIFY_COST_FACTOR = 4;
+
+    std::mutex defaultsMutex;
+    KdfParams defaults;
+}
+
+namespace FootballManagement
+{
+    std::size_t KdfParams::MemoryBytes() const
+    {
+        return static_cast<std::size_t>(128) * r * (std::size_t(1) << logN);
+    }
+
+    void KdfParams::Validate() const
+    {
+        if (logN < 1 || logN > 24)
+            throw std::invalid_argument("scrypt: ln має бути в межах 1..24.");
+        if (r < 1 || r > 64)
+            throw std::invalid_argument("scrypt: r має бути в межах 1..64.");
+        if (p < 1 || p > 16)
+            throw std::invalid_argument("scrypt: p має бути в межах 1..16.");
+    }
+
+    KdfParams PasswordHasher::GetDefaultParams()
+    {
+        std::lock_guard<std::mutex> lock(defaultsMutex);
+        return defaults;
+    }
+
+    void PasswordHasher::SetDefaultParams(const KdfParams& params)
+    {
+        params.Validate();
+        std::lock_guard<std::mutex> lock(defaultsMutex);
+        defaults = params;
+    }
+
+    std::vector<std::uint8_t> PasswordHasher::Scrypt(
+        const std::string& password, const std::string& salt,
+        const KdfParams& params, std::size_t length)
+    {
+        params.Validate();
+        const std::uint32_t r = params.r;
+        const std::uint64_t n = std::uint64_t(1) << params.logN;
+        const std::size_t blockBytes = 128 * r;
+        const auto* pw = reinterpret_cast<const std::uint8_t*>(password.data());
+
+        std::vector<std::uint8_t> b(blockBytes * params.p);
+        Pbkdf2Sha256(pw, password.size(),
+                     reinterpret_cast<const std::uint8_t*>(salt.data()),
+                     salt.size(), b.data(), b.size());
+
+        std::vector<std::uint32_t> v(static_cast<std::size_t>(n) * 32 * r);
+        for (std::uint32_t i = 0; i < params.p; ++i)
+            RoMix(b.data() + i * blockBytes, r, n, v);
+
+        std::vector<std::uint8_t> out(length);
+        Pbkdf2Sha256(pw, password.size(), b.data(), b.size(), out.data(),
+                     out.size());
+        return out;
+    }
+
+    std::string PasswordHasher::Hash(const std::string& password)
+    {
+        return Hash(password, GetDefaultParams());
+    }
+
+    std::string PasswordHasher::Hash(const std::string& password,
+                                     const KdfParams& params)
+    {
+        thread_local std::random_device device;
+        std::vector<std::uint8_t> salt(SALT_BYTES);
+        for (auto& byte : salt)
+            byte = static_cast<std::uint8_t>(device());
+
+        const std::string saltText = Base64Encode(salt);
+        const auto digest = Scrypt(password, saltText, params, DIGEST_BYTES);
+
+        std::ostringstream ss;
+        ss << HASH_PREFIX << "ln=" << params.logN << ",r=" << params.r
+            << ",p=" << params.p << '$' << saltText << '$'
+            << Base64Encode(digest);
+        return ss.str();
+    }
+
+    bool PasswordHasher::Verify(const std::string& password,
+                                const std::string& encoded)
+    {
+        if (!IsEncodedHash(encoded)) return false;
+
+        const auto paramsEnd = encoded.find('$', HASH_PREFIX.size());
+        if (paramsEnd == std::string::npos) return false;
+        const auto saltEnd = encoded.find('$', paramsEnd + 1);
+        if (saltEnd == std::string::npos) return false;
+
+        KdfParams params;
+        unsigned r = 0;
+        unsigned p = 0;
+        char tail = 0;
+        const std::string paramText = encoded.substr(
+            HASH_PREFIX.size(), paramsEnd - HASH_PREFIX.size());
+        if (std::sscanf(paramText.c_str(), "ln=%d,r=%u,p=%u%c", &params.logN,
+                        &r, &p, &tail) != 3)
+            return false;
+        params.r = r;
+        params.p = p;
+
+        // Вартість береться з users.txt: відредагований запис не повинен
+        // змушувати вхід виділяти гігабайти пам'яті.
+        try
+        {
+            params.Validate();
+        }
+        catch (const std::invalid_argument&)
+        {
+            return false;
+        }
+        const KdfParams limit = GetDefaultParams();
+        const std::size_t budget = MAX_VERIFY_COST_FACTOR *
+            limit.MemoryBytes();
+        if (params.MemoryBytes() > budget ||
+            params.MemoryBytes() * params.p > budget * limit.p)
+            return false;
+
+        const std::string saltText = encoded.substr(
+            paramsEnd + 1, saltEnd - paramsEnd - 1);
+        std::vector<std::uint8_t> expected;
+        if (!Base64Decode(encoded.substr(saltEnd + 1), expected) ||
+            expected.size() != DIGEST_BYTES)
+            return false;
+
+        try
+        {
+            const auto actual = Scrypt(password, saltText, params,
+                                       expected.size());
+            return ConstantTimeEquals(
+                std::string(actual.begin(), actual.end()),
+                std::string(expected.begin(), expected.end()));
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    bool PasswordHasher::IsEncodedHash(const std::string& value)
+    {
+        return value.compare(0, HASH_PREFIX.size(), HASH_PREFIX) == 0;
+    }
+
+    bool PasswordHasher::ConstantTimeEquals(const std::string& a,
+                                            const std::string& b)
+    {
+        if (a.size() != b.size()) return false;
+
+        volatile unsigned char diff = 0;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            diff = diff | static_cast<unsigned char>(a[i] ^ b[i]);
+        return diff == 0;
+    }
+}
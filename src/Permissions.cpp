@@ -0,0 +1,59 @@
+#include "../include/Permissions.h"
+
+#include <iostream>
+#include <array>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    constexpr std::array<const char*, PERMISSION_COUNT> PERMISSION_NAMES = {
+        "edit_players", "sign_agents", "manage_users", "view_finances"
+    };
+
+    std::string Trim(const std::string& s)
+    {
+        const auto first = s.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return {};
+        const auto last = s.find_last_not_of(" \t\r");
+        return s.substr(first, last - first + 1);
+    }
+}
+
+namespace FootballManagement
+{
+    std::optional<Permission> ParsePermission(const std::string& name)
+    {
+        for (std::size_t i = 0; i < PERMISSION_NAMES.size(); ++i)
+            if (name == PERMISSION_NAMES[i])
+                return static_cast<Permission>(i);
+        return std::nullopt;
+    }
+
+    PermissionSet ParseRoleLine(const std::string& line, std::string& roleName)
+    {
+        const auto colon = line.find(':');
+        roleName = Trim(line.substr(0, colon));
+        if (roleName.empty())
+            throw std::invalid_argument("Порожня назва ролі.");
+
+        PermissionSet set = NO_PERMISSIONS;
+        if (colon == std::string::npos) return set;
+
+        std::stringstream ss(line.substr(colon + 1));
+        std::string token;
+        while (std::getline(ss, token, ','))
+        {
+            token = Trim(token);
+            if (token.empty()) continue;
+
+            const auto permission = ParsePermission(token);
+            if (!permission)
+                throw std::invalid_argument("Невідоме право: " + token);
+            set |= PermissionBit(*permission);
+        }
+        return set;
+    }
+}
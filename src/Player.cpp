@@ -1,8 +1,7 @@
 #include "../include/Player.h"
+#include "../include/Console.h"
 
 #include <iostream>
-#include <regex>
-#include <sstream>
 #include <stdexcept>
 #include <utility>
 
@@ -17,7 +16,10 @@ namespace FootballManagement
           height_(0.0),
           weight_(0.0),
           marketValue_(0.0),
-          injured_(false)
+          injured_(false),
+          version_(0),
+          dirtyFields_(0),
+          observer_(nullptr)
     {
     }
 
@@ -32,7 +34,10 @@ namespace FootballManagement
           height_(height),
           weight_(weight),
           marketValue_(marketValue),
-          injured_(false)
+          injured_(false),
+          version_(0),
+          dirtyFields_(0),
+          observer_(nullptr)
     {
         if (age <= 0) throw std::invalid_argument("Вік має бути додатним.");
         if (height <= 0.0)
@@ -46,7 +51,22 @@ namespace FootballManagement
                 "Ринкова вартість не може бути від'ємною.");
     }
 
-    Player::Player(const Player& other) = default;
+    Player::Player(const Player& other)
+        : playerId_(other.playerId_),
+          name_(other.name_),
+          age_(other.age_),
+          nationality_(other.nationality_),
+          origin_(other.origin_),
+          height_(other.height_),
+          weight_(other.weight_),
+          marketValue_(other.marketValue_),
+          injured_(other.injured_),
+          injuryHistory_(other.injuryHistory_),
+          version_(other.version_),
+          dirtyFields_(other.dirtyFields_),
+          observer_(nullptr)
+    {
+    }
 
     Player::Player(Player&& other) noexcept
         : playerId_(other.playerId_),
@@ -58,7 +78,10 @@ namespace FootballManagement
           weight_(other.weight_),
           marketValue_(other.marketValue_),
           injured_(other.injured_),
-          injuryHistory_(std::move(other.injuryHistory_))
+          injuryHistory_(std::move(other.injuryHistory_)),
+          version_(other.version_),
+          dirtyFields_(other.dirtyFields_),
+          observer_(nullptr)
     {
         other.playerId_ = 0;
         other.injured_ = false;
@@ -78,6 +101,8 @@ namespace FootballManagement
             marketValue_ = other.marketValue_;
             injured_ = other.injured_;
             injuryHistory_ = other.injuryHistory_;
+            version_ = other.version_;
+            dirtyFields_ = other.dirtyFields_;
         }
         return *this;
     }
@@ -96,6 +121,8 @@ namespace FootballManagement
             marketValue_ = other.marketValue_;
             injured_ = other.injured_;
             injuryHistory_ = std::move(other.injuryHistory_);
+            version_ = other.version_;
+            dirtyFields_ = other.dirtyFields_;
 
             other.playerId_ = 0;
             other.injured_ = false;
@@ -105,15 +132,15 @@ namespace FootballManagement
 
     Player::~Player() noexcept
     {
-        std::cout << "[ДЕБАГ] Гравець \"" << name_
+        Console() << "[ДЕБАГ] Гравець \"" << name_
             << "\" (ID: " << playerId_ << ") видалений.\n";
     }
 
     int Player::GetPlayerId() const { return playerId_; }
-    std::string Player::GetName() const { return name_; }
+    const std::string& Player::GetName() const { return name_; }
     int Player::GetAge() const { return age_; }
-    std::string Player::GetNationality() const { return nationality_; }
-    std::string Player::GetOrigin() const { return origin_; }
+    const std::string& Player::GetNationality() const { return nationality_; }
+    const std::string& Player::GetOrigin() const { return origin_; }
     double Player::GetHeight() const { return height_; }
     double Player::GetWeight() const { return weight_; }
     double Player::GetMarketValue() const { return marketValue_; }
@@ -129,7 +156,11 @@ namespace FootballManagement
         if (playerId <= 0)
             throw std::invalid_argument(
                 "Ідентифікатор гравця має бути додатним.");
+        const int oldId = playerId_;
         playerId_ = playerId;
+        if (observer_ && oldId != playerId)
+            observer_->OnPlayerIdChanged(*this, oldId);
+        MarkDirty(PlayerField::Id);
     }
 
     void Player::SetName(const std::string& name)
@@ -137,6 +168,7 @@ namespace FootballManagement
         if (name.empty())
             throw std::invalid_argument("Ім'я гравця не може бути порожнім.");
         name_ = name;
+        MarkDirty(PlayerField::Name);
     }
 
     void Player::SetAge(int age)
@@ -144,6 +176,7 @@ namespace FootballManagement
         if (age <= 0)
             throw std::invalid_argument("Вік повинен бути додатним.");
         age_ = age;
+        MarkDirty(PlayerField::Age);
     }
 
 
@@ -153,11 +186,13 @@ namespace FootballManagement
             throw std::invalid_argument(
                 "Національність не може бути порожньою.");
         nationality_ = nationality;
+        MarkDirty(PlayerField::Nationality);
     }
 
     void Player::SetOrigin(const std::string& origin)
     {
         origin_ = origin.empty() ? "Невідомий" : origin;
+        MarkDirty(PlayerField::Origin);
     }
 
     void Player::SetHeight(double height)
@@ -165,6 +200,7 @@ namespace FootballManagement
         if (height <= 0.0)
             throw std::invalid_argument("Зріст має бути додатним.");
         height_ = height;
+        MarkDirty(PlayerField::Physical);
     }
 
     void Player::SetWeight(double weight)
@@ -172,6 +208,7 @@ namespace FootballManagement
         if (weight <= 0.0)
             throw std::invalid_argument("Вага має бути додатною.");
         weight_ = weight;
+        MarkDirty(PlayerField::Physical);
     }
 
     void Player::SetMarketValue(double value)
@@ -180,6 +217,7 @@ namespace FootballManagement
             throw std::invalid_argument(
                 "Ринкова вартість не може бути від'ємною.");
         marketValue_ = value;
+        MarkDirty(PlayerField::MarketValue);
     }
 
     void Player::ReportInjury(const std::string& type, int recoveryDays)
@@ -197,15 +235,17 @@ namespace FootballManagement
         inj.dateOccurred = "сьогодні";
 
         injuryHistory_.push_back(std::move(inj));
+        MarkDirty(PlayerField::Injury);
 
-        std::cout << "Гравець \"" << name_ << "\" отримав травму: " << type
+        Console() << "Гравець \"" << name_ << "\" отримав травму: " << type
             << ". Орієнтовне відновлення: " << recoveryDays << " днів.\n";
     }
 
     void Player::ReturnToFitness()
     {
         injured_ = false;
-        std::cout << "Гравець \"" << name_ << "\" відновився після травми.\n";
+        MarkDirty(PlayerField::Injury);
+        Console() << "Гравець \"" << name_ << "\" відновився після травми.\n";
     }
 
     void Player::UpdateMarketValue(double percentageChange)
@@ -213,43 +253,25 @@ namespace FootballManagement
         const double factor = 1.0 + (percentageChange / 100.0);
         marketValue_ *= factor;
         if (marketValue_ < 0.0) marketValue_ = 0.0;
+        MarkDirty(PlayerField::MarketValue);
     }
 
-    std::string Player::SerializeBase() const
+    std::uint64_t Player::GetVersion() const { return version_; }
+    PlayerFieldMask Player::GetDirtyFields() const { return dirtyFields_; }
+    bool Player::IsDirty() const { return dirtyFields_ != 0; }
+    void Player::ClearDirtyFields() { dirtyFields_ = 0; }
+
+    void Player::SetObserver(IPlayerObserver* observer)
     {
-        std::ostringstream ss;
-        ss << "\"id\":" << playerId_ << ','
-            << "\"name\":\"" << name_ << "\","
-            << "\"age\":" << age_ << ','
-            << "\"nationality\":\"" << nationality_ << "\","
-            << "\"origin\":\"" << origin_ << "\","
-            << "\"height\":" << height_ << ','
-            << "\"weight\":" << weight_ << ','
-            << "\"marketValue\":" << marketValue_ << ','
-            << "\"injured\":" << (injured_ ? "true" : "false");
-        return ss.str();
+        observer_ = observer;
     }
 
-    void Player::DeserializeBase(const std::string& json)
-    {
-        std::regex r("\"(.*?)\"\\s*:\\s*\"?(.*?)\"?(,|})");
-        auto begin = std::sregex_iterator(json.begin(), json.end(), r);
-        auto end = std::sregex_iterator();
+    IPlayerObserver* Player::GetObserver() const { return observer_; }
 
-        for (auto it = begin; it != end; ++it)
-        {
-            const std::string key = (*it)[1].str();
-            const std::string value = (*it)[2].str();
-
-            if (key == "id") playerId_ = std::stoi(value);
-            else if (key == "name") name_ = value;
-            else if (key == "age") age_ = std::stoi(value);
-            else if (key == "nationality") nationality_ = value;
-            else if (key == "origin") origin_ = value;
-            else if (key == "height") height_ = std::stod(value);
-            else if (key == "weight") weight_ = std::stod(value);
-            else if (key == "marketValue") marketValue_ = std::stod(value);
-            else if (key == "injured") injured_ = (value == "true");
-        }
+    void Player::MarkDirty(PlayerFieldMask fields)
+    {
+        ++version_;
+        dirtyFields_ |= fields;
+        if (observer_) observer_->OnPlayerChanged(*this, fields);
     }
 }
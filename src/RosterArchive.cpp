@@ -0,0 +1,450 @@
+#include "../include/RosterArchive.h"
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'F', 'M', 'R', 'A'};
+    constexpr std::uint32_t FORMAT_VERSION = 1;
+    constexpr std::size_t HEADER_SIZE = 8; ///< MAGIC + версія.
+    constexpr std::size_t TRAILER_SIZE = 12; ///< footerOffset + MAGIC.
+    constexpr std::size_t BLOCK_ENTRY_SIZE = 24;
+    constexpr std::size_t ID_ENTRY_SIZE = 8;
+
+    // ---------------- little-endian ----------------
+
+    void PutU32(std::string& out, std::uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i)
+            out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+
+    void PutU64(std::string& out, std::uint64_t v)
+    {
+        for (int i = 0; i < 8; ++i)
+            out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+
+    std::uint32_t GetU32(const char* p)
+    {
+        std::uint32_t v = 0;
+        for (int i = 3; i >= 0; --i)
+            v = (v << 8) | static_cast<unsigned char>(p[i]);
+        return v;
+    }
+
+    std::uint64_t GetU64(const char* p)
+    {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; --i)
+            v = (v << 8) | static_cast<unsigned char>(p[i]);
+        return v;
+    }
+
+    // ---------------- LZ-кодек блоку ----------------
+    //
+    // Послідовність: токен (старші 4 біти — довжина літералів, молодші —
+    // довжина збігу − 4; 15 означає «далі байти-продовження по 255»),
+    // літерали, 2-байтовий зсув збігу. Остання послідовність — лише літерали.
+
+    constexpr std::size_t MIN_MATCH = 4;
+    constexpr std::size_t MAX_OFFSET = 0xFFFF;
+    constexpr int HASH_BITS = 13;
+
+    std::uint32_t HashAt(const char* p)
+    {
+        std::uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return (v * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void PutLength(std::string& out, std::size_t len)
+    {
+        while (len >= 255)
+        {
+            out.push_back(static_cast<char>(255));
+            len -= 255;
+        }
+        out.push_back(static_cast<char>(len));
+    }
+
+    void PutSequence(std::string& out, const char* literals,
+                     std::size_t literalLen, std::size_t offset,
+                     std::size_t matchLen)
+    {
+        const std::size_t litCode = std::min<std::size_t>(literalLen, 15);
+        const std::size_t matchCode = matchLen == 0
+                                          ? 0
+                                          : std::min<std::size_t>(
+                                              matchLen - MIN_MATCH, 15);
+        out.push_back(static_cast<char>((litCode << 4) | matchCode));
+        if (litCode == 15) PutLength(out, literalLen - 15);
+        out.append(literals, literalLen);
+        if (matchLen == 0) return;
+
+        out.push_back(static_cast<char>(offset & 0xFF));
+        out.push_back(static_cast<char>(offset >> 8));
+        if (matchCode == 15) PutLength(out, matchLen - MIN_MATCH - 15);
+    }
+
+    std::string Compress(const std::string& raw)
+    {
+        std::string out;
+        out.reserve(raw.size() / 2 + 16);
+
+        const char* base = raw.data();
+        const std::size_t n = raw.size();
+        std::array<std::uint32_t, 1u << HASH_BITS> table{};
+        table.fill(UINT32_MAX);
+
+        std::size_t anchor = 0;
+        std::size_t i = 0;
+        while (n >= MIN_MATCH && i + MIN_MATCH <= n)
+        {
+            const std::uint32_t h = HashAt(base + i);
+            const std::uint32_t candidate = table[h];
+            table[h] = static_cast<std::uint32_t>(i);
+
+            if (candidate == UINT32_MAX || i - candidate > MAX_OFFSET ||
+                std::memcmp(base + candidate, base + i, MIN_MATCH) != 0)
+            {
+                ++i;
+                continue;
+            }
+
+            std::size_t len = MIN_MATCH;
+            while (i + len < n && base[candidate + len] == base[i + len]) ++len;
+
+            PutSequence(out, base + anchor, i - anchor, i - candidate, len);
+            i += len;
+            anchor = i;
+        }
+
+        PutSequence(out, base + anchor, n - anchor, 0, 0);
+        return out;
+    }
+
+    std::size_t ReadLength(const std::string& in, std::size_t& pos,
+                           std::size_t code)
+    {
+        std::size_t len = code;
+        if (code != 15) return len;
+        while (true)
+        {
+            if (pos >= in.size())
+                throw std::runtime_error("Пошкоджений блок (довжина).");
+            const auto b = static_cast<unsigned char>(in[pos++]);
+            len += b;
+            if (b != 255) return len;
+        }
+    }
+
+    std::string Decompress(const std::string& in, std::size_t rawSize)
+    {
+        std::string out(rawSize, '\0');
+        char* dst = out.data();
+        std::size_t written = 0;
+
+        std::size_t pos = 0;
+        while (pos < in.size())
+        {
+            const auto token = static_cast<unsigned char>(in[pos++]);
+            const std::size_t literalLen = ReadLength(in, pos, token >> 4);
+            if (literalLen > in.size() - pos || literalLen > rawSize - written)
+                throw std::runtime_error("Пошкоджений блок (літерали).");
+            std::memcpy(dst + written, in.data() + pos, literalLen);
+            written += literalLen;
+            pos += literalLen;
+            if (pos == in.size()) break;
+
+            if (in.size() - pos < 2)
+                throw std::runtime_error("Пошкоджений блок (зсув).");
+            const std::size_t offset =
+                static_cast<unsigned char>(in[pos]) |
+                (static_cast<std::size_t>(static_cast<unsigned char>(
+                    in[pos + 1])) << 8);
+            pos += 2;
+            const std::size_t matchLen =
+                ReadLength(in, pos, token & 0x0F) + MIN_MATCH;
+            if (offset == 0 || offset > written ||
+                matchLen > rawSize - written)
+                throw std::runtime_error("Пошкоджений блок (збіг).");
+
+            const char* from = dst + written - offset;
+            if (offset >= matchLen)
+            {
+                std::memcpy(dst + written, from, matchLen);
+            }
+            else
+            {
+                // Збіг перекриває власний результат — лише побайтово.
+                for (std::size_t k = 0; k < matchLen; ++k)
+                    dst[written + k] = from[k];
+            }
+            written += matchLen;
+        }
+
+        if (written != rawSize)
+            throw std::runtime_error("Пошкоджений блок (розмір).");
+        return out;
+    }
+
+    /// ID із запису виду {"id":N,...}, або std::nullopt.
+    std::optional<int> RecordId(const std::string& record)
+    {
+        constexpr const char* PREFIX = "{\"id\":";
+        constexpr std::size_t PREFIX_LEN = 6;
+        if (record.compare(0, PREFIX_LEN, PREFIX) != 0) return std::nullopt;
+
+        try
+        {
+            return std::stoi(record.substr(PREFIX_LEN, 12));
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    std::string ReadRange(const std::string& path, std::uint64_t offset,
+                          std::size_t size)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            throw std::runtime_error("Не вдалося відкрити архів: " + path);
+
+        std::string data(size, '\0');
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(data.data(), static_cast<std::streamsize>(size));
+        if (static_cast<std::size_t>(file.gcount()) != size)
+            throw std::runtime_error("Архів обрізаний: " + path);
+        return data;
+    }
+}
+
+namespace FootballManagement
+{
+    void RosterArchive::Write(const std::string& path,
+                              const std::vector<std::string>& records,
+                              std::size_t recordsPerBlock)
+    {
+        if (recordsPerBlock == 0) recordsPerBlock = 1;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            throw std::runtime_error("Не вдалося відкрити файл для запису.");
+
+        std::string header(MAGIC, sizeof(MAGIC));
+        PutU32(header, FORMAT_VERSION);
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+        std::vector<RosterBlockInfo> blocks;
+        std::vector<std::pair<int, std::uint32_t>> ids;
+        std::uint64_t offset = HEADER_SIZE;
+        std::string raw;
+
+        for (std::size_t first = 0; first < records.size();
+             first += recordsPerBlock)
+        {
+            const std::size_t last = std::min(records.size(),
+                                              first + recordsPerBlock);
+            raw.clear();
+            for (std::size_t r = first; r < last; ++r)
+            {
+                raw += records[r];
+                raw += '\n';
+                if (const auto id = RecordId(records[r]))
+                    ids.emplace_back(*id, static_cast<std::uint32_t>(r));
+            }
+
+            const std::string packed = Compress(raw);
+            file.write(packed.data(),
+                       static_cast<std::streamsize>(packed.size()));
+
+            RosterBlockInfo info;
+            info.offset = offset;
+            info.compressedSize = static_cast<std::uint32_t>(packed.size());
+            info.rawSize = static_cast<std::uint32_t>(raw.size());
+            info.firstRecord = static_cast<std::uint32_t>(first);
+            info.recordCount = static_cast<std::uint32_t>(last - first);
+            blocks.push_back(info);
+            offset += packed.size();
+        }
+
+        std::sort(ids.begin(), ids.end());
+
+        std::string footer;
+        PutU32(footer, static_cast<std::uint32_t>(records.size()));
+        PutU32(footer, static_cast<std::uint32_t>(blocks.size()));
+        PutU32(footer, static_cast<std::uint32_t>(ids.size()));
+        for (const auto& b : blocks)
+        {
+            PutU64(footer, b.offset);
+            PutU32(footer, b.compressedSize);
+            PutU32(footer, b.rawSize);
+            PutU32(footer, b.firstRecord);
+            PutU32(footer, b.recordCount);
+        }
+        for (const auto& [id, record] : ids)
+        {
+            PutU32(footer, static_cast<std::uint32_t>(id));
+            PutU32(footer, record);
+        }
+        PutU64(footer, offset);
+        footer.append(MAGIC, sizeof(MAGIC));
+
+        file.write(footer.data(), static_cast<std::streamsize>(footer.size()));
+        if (!file)
+            throw std::runtime_error("Помилка запису архіву: " + path);
+    }
+
+    void RosterArchive::Open(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            throw std::runtime_error("Не вдалося відкрити архів: " + path);
+        const auto fileSize = static_cast<std::uint64_t>(file.tellg());
+        file.close();
+
+        if (fileSize < HEADER_SIZE + TRAILER_SIZE)
+            throw std::runtime_error("Файл не є архівом складу: " + path);
+
+        const std::string header = ReadRange(path, 0, HEADER_SIZE);
+        const std::string trailer = ReadRange(path, fileSize - TRAILER_SIZE,
+                                              TRAILER_SIZE);
+        if (std::memcmp(header.data(), MAGIC, sizeof(MAGIC)) != 0 ||
+            std::memcmp(trailer.data() + 8, MAGIC, sizeof(MAGIC)) != 0)
+            throw std::runtime_error("Файл не є архівом складу: " + path);
+        if (GetU32(header.data() + 4) != FORMAT_VERSION)
+            throw std::runtime_error("Непідтримувана версія архіву: " + path);
+
+        const std::uint64_t footerOffset = GetU64(trailer.data());
+        if (footerOffset < HEADER_SIZE ||
+            footerOffset + 12 > fileSize - TRAILER_SIZE)
+            throw std::runtime_error("Пошкоджений індекс архіву: " + path);
+
+        const std::string footer = ReadRange(
+            path, footerOffset, fileSize - TRAILER_SIZE - footerOffset);
+        const char* p = footer.data();
+        const std::uint32_t recordCount = GetU32(p);
+        const std::uint32_t blockCount = GetU32(p + 4);
+        const std::uint32_t idCount = GetU32(p + 8);
+        if (footer.size() != 12 + blockCount * BLOCK_ENTRY_SIZE +
+            static_cast<std::size_t>(idCount) * ID_ENTRY_SIZE)
+            throw std::runtime_error("Пошкоджений індекс архіву: " + path);
+        p += 12;
+
+        std::vector<RosterBlockInfo> blocks(blockCount);
+        for (auto& b : blocks)
+        {
+            b.offset = GetU64(p);
+            b.compressedSize = GetU32(p + 8);
+            b.rawSize = GetU32(p + 12);
+            b.firstRecord = GetU32(p + 16);
+            b.recordCount = GetU32(p + 20);
+            p += BLOCK_ENTRY_SIZE;
+            if (b.offset + b.compressedSize > footerOffset)
+                throw std::runtime_error("Пошкоджений індекс архіву: " + path);
+        }
+
+        std::vector<std::pair<int, std::uint32_t>> ids(idCount);
+        for (auto& [id, record] : ids)
+        {
+            id = static_cast<int>(GetU32(p));
+            record = GetU32(p + 4);
+            p += ID_ENTRY_SIZE;
+        }
+
+        path_ = path;
+        blocks_ = std::move(blocks);
+        idIndex_ = std::move(ids);
+        recordCount_ = recordCount;
+    }
+
+    std::vector<std::string> RosterArchive::ReadBlock(std::size_t index) const
+    {
+        const RosterBlockInfo& b = blocks_.at(index);
+        const std::string raw = Decompress(
+            ReadRange(path_, b.offset, b.compressedSize), b.rawSize);
+
+        // Кожен запис закінчується '\n', тож записів не більше за байти.
+        std::vector<std::string> records;
+        records.reserve(std::min<std::size_t>(b.recordCount, raw.size()));
+        std::size_t start = 0;
+        while (start < raw.size())
+        {
+            const std::size_t end = raw.find('\n', start);
+            if (end == std::string::npos)
+                throw std::runtime_error("Пошкоджений блок (обірваний запис).");
+            if (records.size() == b.recordCount)
+                throw std::runtime_error(
+                    "Пошкоджений блок (кількість записів).");
+            records.emplace_back(raw, start, end - start);
+            start = end + 1;
+        }
+        if (records.size() != b.recordCount)
+            throw std::runtime_error("Пошкоджений блок (кількість записів).");
+        return records;
+    }
+
+    std::vector<std::string> RosterArchive::ReadAll() const
+    {
+        std::vector<std::string> records;
+        records.reserve(recordCount_);
+        for (std::size_t i = 0; i < blocks_.size(); ++i)
+        {
+            auto block = ReadBlock(i);
+            std::move(block.begin(), block.end(), std::back_inserter(records));
+        }
+        return records;
+    }
+
+    std::optional<std::string> RosterArchive::ReadRecord(
+        std::size_t index) const
+    {
+        if (index >= recordCount_) return std::nullopt;
+
+        const auto it = std::upper_bound(
+            blocks_.begin(), blocks_.end(), index,
+            [](std::size_t value, const RosterBlockInfo& b)
+            {
+                return value < b.firstRecord;
+            });
+        if (it == blocks_.begin()) return std::nullopt;
+
+        const auto blockIndex = static_cast<std::size_t>(
+            std::distance(blocks_.begin(), it) - 1);
+        auto records = ReadBlock(blockIndex);
+        const std::size_t local = index - blocks_[blockIndex].firstRecord;
+        if (local >= records.size()) return std::nullopt;
+        return std::move(records[local]);
+    }
+
+    std::optional<std::string> RosterArchive::FindById(int playerId) const
+    {
+        const auto it = std::lower_bound(
+            idIndex_.begin(), idIndex_.end(), playerId,
+            [](const std::pair<int, std::uint32_t>& entry, int id)
+            {
+                return entry.first < id;
+            });
+        if (it == idIndex_.end() || it->first != playerId) return std::nullopt;
+        return ReadRecord(it->second);
+    }
+
+    std::size_t RosterArchive::GetRecordCount() const
+    {
+        return recordCount_;
+    }
+
+    std::size_t RosterArchive::GetBlockCount() const
+    {
+        return blocks_.size();
+    }
+}
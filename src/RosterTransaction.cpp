@@ -0,0 +1,46 @@
+#include "../include/RosterTransaction.h"
+
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace FootballManagement
+{
+    RosterOperation RosterOperation::Signing(std::shared_ptr<Player> agent,
+                                             double salary,
+                                             const std::string& contractUntil)
+    {
+        return {TransactionKind::Signing, 0, std::move(agent), salary,
+                contractUntil};
+    }
+
+    RosterOperation RosterOperation::TransferIn(std::shared_ptr<Player> player,
+                                                double fee)
+    {
+        return {TransactionKind::TransferIn, 0, std::move(player), fee, ""};
+    }
+
+    RosterOperation RosterOperation::TransferOut(int playerId,
+                                                 const std::string& buyer,
+                                                 double fee)
+    {
+        return {TransactionKind::TransferOut, playerId, nullptr, fee, buyer};
+    }
+
+    RosterOperation RosterOperation::SalaryChange(int playerId,
+                                                  double newSalary)
+    {
+        return {TransactionKind::SalaryChange, playerId, nullptr, newSalary,
+                ""};
+    }
+
+    std::string TransactionRecord::Serialize() const
+    {
+        std::ostringstream ss;
+        ss << batchId << ":" << (committed ? "COMMIT" : "ROLLBACK") << ":"
+            << operationCount << ":"
+            << std::fixed << std::setprecision(2) << budgetBefore << ":"
+            << budgetAfter << ":" << message;
+        return ss.str();
+    }
+}
@@ -0,0 +1,366 @@
+#include "../include/SeasonSimulator.h"
+#include "../include/Console.h"
+#include "../include/FieldPlayer.h"
+#include "../include/Goalkeeper.h"
+
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    /// Склад клубу на сезон та ваги для розподілу подій між гравцями.
+    struct Lineup
+    {
+        Goalkeeper* keeper = nullptr;
+        std::vector<FieldPlayer*> outfield;
+        std::vector<double> shotWeights;
+        std::vector<double> passWeights;
+        std::vector<double> tackleWeights;
+        double strength = 1.0;
+    };
+
+    /// Події одного польового гравця в одному матчі.
+    struct FieldLine
+    {
+        int goals = 0;
+        int assists = 0;
+        int shots = 0;
+        int tackles = 0;
+        int keyPasses = 0;
+    };
+
+    /// Події однієї команди в одному матчі.
+    struct SideEvents
+    {
+        std::vector<FieldLine> lines;
+        int conceded = 0;
+        int saves = 0;
+    };
+
+    struct MatchEvents
+    {
+        SideEvents home;
+        SideEvents away;
+    };
+
+    Lineup BuildLineup(const ClubManager& club)
+    {
+        constexpr std::size_t MAX_OUTFIELD = 10;
+        Lineup lineup;
+        double ratingSum = 0.0;
+
+        for (const auto& p : club.GetAll())
+        {
+            if (!p || p->IsInjured()) continue;
+
+            if (auto* gk = dynamic_cast<Goalkeeper*>(p.get()))
+            {
+                if (!lineup.keeper) lineup.keeper = gk;
+                continue;
+            }
+
+            auto* fp = dynamic_cast<FieldPlayer*>(p.get());
+            if (!fp || lineup.outfield.size() >= MAX_OUTFIELD) continue;
+
+            lineup.outfield.push_back(fp);
+            ratingSum += fp->CalculatePerformanceRating();
+
+            switch (fp->GetPosition())
+            {
+            case Position::Forward:
+                lineup.shotWeights.push_back(4.0);
+                lineup.passWeights.push_back(2.0);
+                lineup.tackleWeights.push_back(1.0);
+                break;
+            case Position::Midfielder:
+                lineup.shotWeights.push_back(2.0);
+                lineup.passWeights.push_back(3.0);
+                lineup.tackleWeights.push_back(2.0);
+                break;
+            case Position::Defender:
+                lineup.shotWeights.push_back(1.0);
+                lineup.passWeights.push_back(1.0);
+                lineup.tackleWeights.push_back(3.0);
+                break;
+            case Position::Goalkeeper:
+                lineup.shotWeights.push_back(0.1);
+                lineup.passWeights.push_back(0.5);
+                lineup.tackleWeights.push_back(0.5);
+                break;
+            }
+        }
+
+        if (!lineup.outfield.empty())
+            lineup.strength = 1.0 + ratingSum / lineup.outfield.size();
+        return lineup;
+    }
+
+    /**
+     * Атака однієї команди: удари, голи, асисти, ключові паси,
+     * відбори суперника та сейви його воротаря. Повертає кількість голів.
+     */
+    int PlayAttack(std::mt19937_64& rng, const Lineup& attack,
+                   const Lineup& defense, SideEvents& atk, SideEvents& dfn,
+                   double advantage)
+    {
+        const double share = attack.strength /
+            (attack.strength + defense.strength);
+
+        if (!defense.outfield.empty())
+        {
+            std::poisson_distribution<int> tacklesDist(32.0 * (1.0 - share));
+            std::discrete_distribution<std::size_t> tackler(
+                defense.tackleWeights.begin(), defense.tackleWeights.end());
+            for (int t = tacklesDist(rng); t > 0; --t)
+                ++dfn.lines[tackler(rng)].tackles;
+        }
+
+        if (attack.outfield.empty()) return 0;
+
+        std::poisson_distribution<int> shotsDist(24.0 * share * advantage);
+        std::poisson_distribution<int> passesDist(12.0 * share * advantage);
+        std::discrete_distribution<std::size_t> shooter(
+            attack.shotWeights.begin(), attack.shotWeights.end());
+        std::discrete_distribution<std::size_t> passer(
+            attack.passWeights.begin(), attack.passWeights.end());
+        std::bernoulli_distribution onTarget(0.35);
+        std::bernoulli_distribution converts(0.30);
+        std::bernoulli_distribution assisted(0.70);
+
+        const std::size_t n = attack.outfield.size();
+        int goals = 0;
+        int saves = 0;
+
+        for (int s = shotsDist(rng); s > 0; --s)
+        {
+            const std::size_t i = shooter(rng);
+            ++atk.lines[i].shots;
+            if (!onTarget(rng)) continue;
+
+            if (!converts(rng))
+            {
+                ++saves;
+                continue;
+            }
+
+            ++goals;
+            ++atk.lines[i].goals;
+            if (n > 1 && assisted(rng))
+            {
+                std::size_t j = passer(rng);
+                if (j == i) j = (j + 1) % n;
+                ++atk.lines[j].assists;
+                ++atk.lines[j].keyPasses;
+            }
+        }
+
+        for (int k = passesDist(rng); k > 0; --k)
+            ++atk.lines[passer(rng)].keyPasses;
+
+        dfn.conceded += goals;
+        dfn.saves += saves;
+        return goals;
+    }
+
+    /// Виконати fn(i) для i ∈ [0; count) у кількох потоках.
+    template <typename Fn>
+    void ParallelFor(std::size_t count, unsigned threads, Fn&& fn)
+    {
+        if (threads > count) threads = static_cast<unsigned>(count);
+        if (threads <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i) fn(i);
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&]()
+            {
+                for (std::size_t i = next.fetch_add(1); i < count;
+                     i = next.fetch_add(1))
+                    fn(i);
+            });
+        }
+        for (auto& w : workers) w.join();
+    }
+
+    void ApplySide(const Lineup& lineup, const SideEvents& side)
+    {
+        for (std::size_t i = 0; i < lineup.outfield.size(); ++i)
+        {
+            FieldPlayer* fp = lineup.outfield[i];
+            const FieldLine& line = side.lines[i];
+
+            fp->RegisterMatchPlayed();
+            if (line.goals > 0 || line.assists > 0 || line.shots > 0)
+                fp->UpdateAttackingStats(line.goals, line.assists, line.shots);
+            if (line.tackles > 0) fp->UpdateDefensiveStats(line.tackles);
+            for (int k = 0; k < line.keyPasses; ++k) fp->RegisterKeyPass();
+        }
+
+        // UpdateMatchStats сам реєструє «сухий» матч, якщо пропущено 0.
+        if (lineup.keeper)
+            lineup.keeper->UpdateMatchStats(side.conceded, side.saves);
+    }
+}
+
+namespace FootballManagement
+{
+    SeasonSimulator::SeasonSimulator(std::uint64_t seed, unsigned threadCount)
+        : seed_(seed),
+          threadCount_(threadCount)
+    {
+        if (threadCount_ == 0)
+            threadCount_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<FixtureResult>
+    SeasonSimulator::BuildFixtures(std::size_t clubCount)
+    {
+        std::vector<FixtureResult> fixtures;
+        if (clubCount < 2) return fixtures;
+
+        // Для непарної кількості клубів додаємо «вихідний» слот.
+        const std::size_t n = clubCount + (clubCount % 2);
+        const int roundsPerLeg = static_cast<int>(n - 1);
+        fixtures.reserve(clubCount * (clubCount - 1));
+
+        std::vector<std::size_t> seats(n);
+        for (std::size_t i = 0; i < n; ++i) seats[i] = i;
+
+        std::vector<FixtureResult> firstLeg;
+        for (int r = 0; r < roundsPerLeg; ++r)
+        {
+            for (std::size_t i = 0; i < n / 2; ++i)
+            {
+                std::size_t home = seats[i];
+                std::size_t away = seats[n - 1 - i];
+                if (home >= clubCount || away >= clubCount) continue;
+                if (i == 0 && r % 2 == 1) std::swap(home, away);
+                firstLeg.push_back({r + 1, home, away, 0, 0});
+            }
+            // Метод кола: перше місце фіксоване, решта обертається.
+            std::rotate(seats.begin() + 1, seats.end() - 1, seats.end());
+        }
+
+        fixtures = firstLeg;
+        for (const auto& f : firstLeg)
+            fixtures.push_back({f.round + roundsPerLeg, f.awayClub, f.homeClub,
+                                0, 0});
+        return fixtures;
+    }
+
+    SeasonReport SeasonSimulator::SimulateSeason(
+        const std::vector<std::shared_ptr<ClubManager>>& clubs) const
+    {
+        if (clubs.size() < 2)
+            throw std::invalid_argument(
+                "Для сезону потрібно щонайменше два клуби.");
+        for (const auto& c : clubs)
+            if (!c) throw std::invalid_argument("Порожній клуб у лізі.");
+
+        SeasonReport report;
+        report.fixtures = BuildFixtures(clubs.size());
+
+        std::vector<Lineup> lineups;
+        lineups.reserve(clubs.size());
+        for (const auto& c : clubs) lineups.push_back(BuildLineup(*c));
+
+        // 1) Генерація подій: кожен матч незалежний і має власне зерно.
+        std::vector<MatchEvents> events(report.fixtures.size());
+        ParallelFor(report.fixtures.size(), threadCount_, [&](std::size_t i)
+        {
+            auto& f = report.fixtures[i];
+            auto& ev = events[i];
+            const Lineup& home = lineups[f.homeClub];
+            const Lineup& away = lineups[f.awayClub];
+            ev.home.lines.assign(home.outfield.size(), {});
+            ev.away.lines.assign(away.outfield.size(), {});
+
+            std::mt19937_64 rng(MixSeed(seed_ ^ MixSeed(i)));
+            f.homeGoals = PlayAttack(rng, home, away, ev.home, ev.away, 1.1);
+            f.awayGoals = PlayAttack(rng, away, home, ev.away, ev.home, 1.0);
+        });
+
+        // 2) Застосування: клуби незалежні, матчі клубу — у порядку турів.
+        std::vector<std::vector<std::size_t>> clubFixtures(clubs.size());
+        for (std::size_t i = 0; i < report.fixtures.size(); ++i)
+        {
+            clubFixtures[report.fixtures[i].homeClub].push_back(i);
+            clubFixtures[report.fixtures[i].awayClub].push_back(i);
+        }
+
+        ParallelFor(clubs.size(), threadCount_, [&](std::size_t c)
+        {
+            for (const std::size_t i : clubFixtures[c])
+            {
+                const bool home = report.fixtures[i].homeClub == c;
+                ApplySide(lineups[c], home ? events[i].home : events[i].away);
+            }
+        });
+
+        // 3) Турнірна таблиця.
+        report.table.resize(clubs.size());
+        for (std::size_t c = 0; c < clubs.size(); ++c)
+        {
+            report.table[c].club = c;
+            report.table[c].clubName = clubs[c]->GetClubName();
+        }
+        for (const auto& f : report.fixtures)
+        {
+            auto& h = report.table[f.homeClub];
+            auto& a = report.table[f.awayClub];
+            ++h.played;
+            ++a.played;
+            h.goalsFor += f.homeGoals;
+            h.goalsAgainst += f.awayGoals;
+            a.goalsFor += f.awayGoals;
+            a.goalsAgainst += f.homeGoals;
+
+            if (f.homeGoals > f.awayGoals)
+            {
+                ++h.wins;
+                ++a.losses;
+                h.points += 3;
+            }
+            else if (f.homeGoals < f.awayGoals)
+            {
+                ++a.wins;
+                ++h.losses;
+                a.points += 3;
+            }
+            else
+            {
+                ++h.draws;
+                ++a.draws;
+                ++h.points;
+                ++a.points;
+            }
+        }
+        std::sort(report.table.begin(), report.table.end(),
+                  [](const StandingRow& x, const StandingRow& y)
+                  {
+                      if (x.points != y.points) return x.points > y.points;
+                      const int dx = x.goalsFor - x.goalsAgainst;
+                      const int dy = y.goalsFor - y.goalsAgainst;
+                      if (dx != dy) return dx > dy;
+                      if (x.goalsFor != y.goalsFor)
+                          return x.goalsFor > y.goalsFor;
+                      return x.club < y.club;
+                  });
+
+        Console() << "[ІНФО] Сезон зіграно: " << report.fixtures.size()
+            << " матчів, клубів " << clubs.size() << ".\n";
+        return report;
+    }
+}
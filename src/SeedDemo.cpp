@@ -4,13 +4,46 @@
 #include "../include/ContractedPlayer.h"
 #include "../include/Goalkeeper.h"
 #include "../include/Utils.h"
+#include "../include/Console.h"
+#include "../include/Trace.h"
 
 #include <memory>
+#include <random>
+#include <string>
+
+namespace
+{
+    const char* const FIRST_NAMES[] = {
+        "Георгій", "Ілля", "Руслан", "Роман", "Олександр", "Микола",
+        "Віталій", "Андрій", "Артем", "Тарас", "Сергій", "Євген"
+    };
+
+    const char* const LAST_NAMES[] = {
+        "Бущан", "Забарний", "Маліновський", "Яремчук", "Зінченко",
+        "Матвієнко", "Миколенко", "Ярмоленко", "Довбик", "Степаненко",
+        "Судаков", "Мудрик"
+    };
+
+    const char* const CITIES[] = {
+        "Київ", "Львів", "Житомир", "Харків", "Одеса", "Дніпро"
+    };
+
+    const char* const CLUBS[] = {
+        "Bournemouth", "Genoa", "Valencia", "Girona", "Chelsea", "Arsenal"
+    };
+
+    template <typename T, std::size_t N>
+    const T& Pick(std::mt19937_64& rng, const T (&items)[N])
+    {
+        return items[rng() % N];
+    }
+}
 
 namespace FootballManagement
 {
     void SeedDemoData(ClubManager& cm)
     {
+        FM_TRACE_SCOPE("SeedDemoData");
         auto bushchan = std::make_shared<Goalkeeper>(
             "Георгій Бущан", 30, "Україна", "Київ",
             1.96, 85.0, 7'000'000.0);
@@ -20,7 +53,7 @@ namespace FootballManagement
             "Ілля Забарний", 22, "Україна", "Київ",
             1.89, 80.0, 28'000'000.0, Position::Defender,
             1'500'000.0, "2029-06-30");
-        zabarnyi->GetContractDetails().SetClubName("Bournemouth");
+        zabarnyi->SetClubName("Bournemouth");
         cm.AddPlayer(zabarnyi);
 
         auto malynovskyiFA = std::make_shared<FreeAgent>(
@@ -33,7 +66,97 @@ namespace FootballManagement
             "Роман Яремчук", 29, "Україна", "Львів",
             1.91, 82.0, 6'000'000.0, Position::Forward,
             1'000'000.0, "2027-06-30");
-        yaremchuk->GetContractDetails().SetClubName("Valencia");
+        yaremchuk->SetClubName("Valencia");
         cm.AddPlayer(yaremchuk);
     }
+
+    void SeedSyntheticRoster(ClubManager& cm, std::size_t count,
+                             std::uint64_t seed)
+    {
+        ScopedConsoleMute mute;
+        std::mt19937_64 rng(MixSeed(seed));
+        std::uniform_int_distribution<int> ageDist(17, 37);
+        std::uniform_real_distribution<double> heightDist(1.68, 1.98);
+        std::uniform_real_distribution<double> weightDist(62.0, 92.0);
+        std::uniform_real_distribution<double> valueDist(100'000.0,
+                                                         60'000'000.0);
+        std::uniform_real_distribution<double> salaryDist(200'000.0,
+                                                          5'000'000.0);
+        std::uniform_int_distribution<int> gamesDist(0, 38);
+        std::uniform_int_distribution<int> yearDist(2026, 2031);
+        std::bernoulli_distribution injured(0.05);
+        std::bernoulli_distribution listed(0.10);
+        const Position positions[] = {
+            Position::Defender, Position::Midfielder, Position::Forward
+        };
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::string name = std::string(Pick(rng, FIRST_NAMES)) + " "
+                + Pick(rng, LAST_NAMES) + " " + std::to_string(i + 1);
+            const int age = ageDist(rng);
+            const double height = heightDist(rng);
+            const double weight = weightDist(rng);
+            const double value = valueDist(rng);
+            const int games = gamesDist(rng);
+            const unsigned kind = rng() % 10;
+
+            std::shared_ptr<Player> player;
+            if (kind == 0)
+            {
+                auto gk = std::make_shared<Goalkeeper>(
+                    name, age, "Україна", Pick(rng, CITIES), height, weight,
+                    value);
+                std::poisson_distribution<int> conceded(1.2);
+                std::poisson_distribution<int> saves(3.0);
+                for (int g = 0; g < games; ++g)
+                    gk->UpdateMatchStats(conceded(rng), saves(rng));
+                player = gk;
+            }
+            else
+            {
+                const Position pos = Pick(rng, positions);
+                const double attack = pos == Position::Forward ? 0.45
+                                    : pos == Position::Midfielder ? 0.15
+                                    : 0.05;
+                std::shared_ptr<FieldPlayer> fp;
+                if (kind <= 7)
+                {
+                    const std::string until = std::to_string(yearDist(rng))
+                        + "-06-30";
+                    auto cp = std::make_shared<ContractedPlayer>(
+                        name, age, "Україна", Pick(rng, CITIES), height,
+                        weight, value, pos, salaryDist(rng), until);
+                    if (listed(rng)) cp->ListForTransfer(value * 1.2);
+                    fp = cp;
+                }
+                else
+                {
+                    fp = std::make_shared<FreeAgent>(
+                        name, age, "Україна", Pick(rng, CITIES), height,
+                        weight, value, pos, salaryDist(rng),
+                        Pick(rng, CLUBS));
+                }
+
+                if (games > 0)
+                {
+                    const int goals = std::poisson_distribution<int>(
+                        attack * games)(rng);
+                    const int assists = std::poisson_distribution<int>(
+                        0.2 * games)(rng);
+                    for (int g = 0; g < games; ++g) fp->RegisterMatchPlayed();
+                    fp->UpdateAttackingStats(
+                        goals, assists,
+                        goals * 4 + static_cast<int>(rng() % 20));
+                    fp->UpdateDefensiveStats(static_cast<int>(rng() % 80));
+                }
+                player = fp;
+            }
+
+            if (injured(rng))
+                player->ReportInjury("Синтетична травма",
+                                     7 + static_cast<int>(rng() % 60));
+            cm.AddPlayer(player);
+        }
+    }
 }
@@ -0,0 +1,166 @@
+#include "../include/SessionCache.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <random>
+
+namespace
+{
+    constexpr std::size_t TOKEN_BYTES = 32;
+
+    std::string RandomToken()
+    {
+        static constexpr char HEX[] = "0123456789abcdef";
+        thread_local std::random_device device;
+
+        std::string token;
+        token.reserve(TOKEN_BYTES * 2);
+        for (std::size_t i = 0; i < TOKEN_BYTES; i += 4)
+        {
+            std::uint32_t word = device();
+            for (int b = 0; b < 4; ++b, word >>= 8)
+            {
+                token += HEX[(word >> 4) & 0xF];
+                token += HEX[word & 0xF];
+            }
+        }
+        return token;
+    }
+}
+
+namespace FootballManagement
+{
+    SessionCache::SessionCache(std::chrono::seconds ttl)
+        : ttl_(ttl)
+    {
+    }
+
+    SessionCache::Shard& SessionCache::ShardFor(const std::string& token)
+    {
+        return shards_[std::hash<std::string>{}(token) % SHARD_COUNT];
+    }
+
+    const SessionCache::Shard& SessionCache::ShardFor(
+        const std::string& token) const
+    {
+        return shards_[std::hash<std::string>{}(token) % SHARD_COUNT];
+    }
+
+    std::string SessionCache::Issue(const std::string& userName, UserRole role,
+                                    PermissionSet permissions)
+    {
+        const auto now = Clock::now();
+        std::string token = RandomToken();
+        Shard& shard = ShardFor(token);
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.sessions.size() >= shard.purgeAt)
+        {
+            for (auto it = shard.sessions.begin(); it != shard.sessions.end();)
+            {
+                if (it->second.expiresAt <= now) it = shard.sessions.erase(it);
+                else ++it;
+            }
+            shard.purgeAt = std::max<std::size_t>(1024,
+                                                  2 * shard.sessions.size());
+        }
+        shard.sessions[token] = SessionInfo{userName, role, permissions,
+                                             now + ttl_};
+        return token;
+    }
+
+    std::optional<SessionInfo> SessionCache::Resolve(
+        const std::string& token) const
+    {
+        const Shard& shard = ShardFor(token);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+        const auto it = shard.sessions.find(token);
+        if (it == shard.sessions.end() || it->second.expiresAt <= Clock::now())
+            return std::nullopt;
+        return it->second;
+    }
+
+    bool SessionCache::Revoke(const std::string& token)
+    {
+        Shard& shard = ShardFor(token);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.sessions.erase(token) > 0;
+    }
+
+    std::size_t SessionCache::RevokeUser(const std::string& userName)
+    {
+        std::size_t revoked = 0;
+        for (auto& shard : shards_)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            for (auto it = shard.sessions.begin(); it != shard.sessions.end();)
+            {
+                if (it->second.userName == userName)
+                {
+                    it = shard.sessions.erase(it);
+                    ++revoked;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        return revoked;
+    }
+
+    void SessionCache::Clear()
+    {
+        for (auto& shard : shards_)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.sessions.clear();
+        }
+    }
+
+    std::size_t SessionCache::PurgeExpired()
+    {
+        const auto now = Clock::now();
+        std::size_t purged = 0;
+        for (auto& shard : shards_)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            for (auto it = shard.sessions.begin(); it != shard.sessions.end();)
+            {
+                if (it->second.expiresAt <= now)
+                {
+                    it = shard.sessions.erase(it);
+                    ++purged;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        return purged;
+    }
+
+    std::size_t SessionCache::Size() const
+    {
+        std::size_t total = 0;
+        for (const auto& shard : shards_)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            total += shard.sessions.size();
+        }
+        return total;
+    }
+
+    void SessionCache::SetTtl(std::chrono::seconds ttl)
+    {
+        ttl_ = ttl;
+    }
+
+    std::chrono::seconds SessionCache::GetTtl() const
+    {
+        return ttl_;
+    }
+}
@@ -0,0 +1,118 @@
+#include "../include/StartupLoader.h"
+#include "../include/Console.h"
+#include "../include/Permissions.h"
+#include "../include/SeedDemo.h"
+#include "../include/Trace.h"
+
+#include <iostream>
+#include <chrono>
+#include <utility>
+
+namespace FootballManagement
+{
+    StartupLoader::StartupLoader(std::shared_ptr<ClubManager> clubManager,
+                                 FileManager fileManager)
+        : fileManager_(std::move(fileManager)),
+          clubManager_(std::move(clubManager))
+    {
+    }
+
+    StartupLoader::~StartupLoader()
+    {
+        if (rosterReady_.valid()) rosterReady_.wait();
+    }
+
+    void StartupLoader::LoadRoster()
+    {
+        FM_TRACE_SCOPE("StartupLoader::LoadRoster");
+        ScopedConsoleMute mute;
+        try
+        {
+            // Лише індекс (id, ім'я, тип); повні записи — при зверненні.
+            clubManager_->IndexAllPlayers(
+                fileManager_.LoadFileContent(PLAYERS_DATA_FILE));
+        }
+        catch (const std::exception& e)
+        {
+            rosterError_ = e.what();
+        }
+
+        // Файл не прочитано — демо-склад перезаписав би його.
+        if (rosterError_.empty() && clubManager_->GetPlayerCount() == 0 &&
+            clubManager_->GetUnreadableCount() == 0)
+        {
+            FM_TRACE_SCOPE("SeedDemoRoster");
+            SeedDemoData(*clubManager_);
+            fileManager_.SaveToFile(PLAYERS_DATA_FILE, *clubManager_);
+            rosterSeeded_ = true;
+        }
+    }
+
+    void StartupLoader::Start(AuthManager& auth, UserStore& userStore)
+    {
+        FM_TRACE_SCOPE("StartupLoader::Start");
+        // Склад — у фоні; ролі та користувачі потрібні для входу вже зараз.
+        rosterReady_ = std::async(std::launch::async, [this]()
+        {
+            LoadRoster();
+        }).share();
+
+        try
+        {
+            // Власні ролі — до користувачів, щоб одразу підставити їхні права.
+            if (fileManager_.FileExists(ROLES_CONFIG_FILE))
+            {
+                FM_TRACE_SCOPE("LoadRoles");
+                auth.LoadCustomRoles(
+                    fileManager_.LoadFromFile(ROLES_CONFIG_FILE));
+            }
+
+            // Знімок + журнал; хеші замість відкритих паролів пишуться одразу.
+            userStore.Load(auth);
+            Console() << "[ІНФО] Дані користувачів завантажено.\n";
+        }
+        catch (const std::exception& e)
+        {
+            Console() << "[ПОМИЛКА] Не вдалося завантажити користувачів: "
+                << e.what() << "\n";
+        }
+    }
+
+    bool StartupLoader::IsRosterReady() const
+    {
+        return !rosterReady_.valid() ||
+            rosterReady_.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready;
+    }
+
+    bool StartupLoader::IsRosterLossy() const
+    {
+        static_cast<void>(Roster());
+        return !rosterError_.empty();
+    }
+
+    ClubManager& StartupLoader::Roster() const
+    {
+        if (rosterReady_.valid())
+        {
+            FM_TRACE_SCOPE("StartupLoader::WaitRoster");
+            rosterReady_.wait();
+        }
+
+        if (!rosterReported_ && rosterReady_.valid())
+        {
+            rosterReported_ = true;
+            if (!rosterError_.empty())
+                Console() << "[ПОМИЛКА] Не вдалося завантажити гравців: "
+                    << rosterError_ << "\n";
+            else
+                Console() << "[ІНФО] Дані гравців завантажено.\n";
+            if (rosterSeeded_)
+                Console() << "[ІНФО] Склад порожній — додано демо-гравців.\n";
+            if (const auto n = clubManager_->GetUnreadableCount(); n > 0)
+                Console() << "[ПОПЕРЕДЖЕННЯ] Не вдалося прочитати рядків "
+                    "гравців: " << n << ". Вони збережуться у файлі без змін.\n";
+        }
+        return *clubManager_;
+    }
+}
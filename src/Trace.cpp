@@ -0,0 +1,152 @@
+#include "../include/Trace.h"
+#include "../include/Console.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    /// Рядок JSON без керівних символів (назви областей — літерали).
+    void AppendJsonString(std::ostringstream& ss, const char* text)
+    {
+        ss << '"';
+        for (const char* c = text; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\') ss << '\\';
+            ss << *c;
+        }
+        ss << '"';
+    }
+}
+
+namespace FootballManagement
+{
+    Tracer::Tracer() : epoch_(Clock::now())
+    {
+    }
+
+    Tracer& Tracer::GetInstance()
+    {
+        static Tracer instance;
+        return instance;
+    }
+
+    Tracer::ThreadBuffer& Tracer::LocalBuffer()
+    {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer)
+        {
+            auto created = std::make_unique<ThreadBuffer>();
+            std::lock_guard lock(mutex_);
+            created->threadId = static_cast<std::uint32_t>(buffers_.size()) + 1;
+            buffer = created.get();
+            buffers_.push_back(std::move(created));
+        }
+        return *buffer;
+    }
+
+    std::uint64_t Tracer::Now() const
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - epoch_).count());
+    }
+
+    std::uint32_t Tracer::Enter()
+    {
+        return LocalBuffer().depth++;
+    }
+
+    void Tracer::Leave(const char* name, std::uint64_t startNs,
+                       std::uint32_t depth)
+    {
+        const std::uint64_t end = Now();
+        ThreadBuffer& buffer = LocalBuffer();
+        buffer.depth = depth;
+
+        std::lock_guard lock(buffer.mutex);
+        buffer.events.push_back({name, startNs, end - startNs, depth});
+    }
+
+    std::size_t Tracer::GetEventCount() const
+    {
+        std::lock_guard lock(mutex_);
+        std::size_t total = 0;
+        for (const auto& buffer : buffers_)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            total += buffer->events.size();
+        }
+        return total;
+    }
+
+    void Tracer::Clear()
+    {
+        std::lock_guard lock(mutex_);
+        for (const auto& buffer : buffers_)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            buffer->events.clear();
+        }
+    }
+
+    std::string Tracer::RenderChromeTrace() const
+    {
+        // Один процес; справжній pid для перегляду не потрібен.
+        constexpr int pid = 1;
+        std::ostringstream ss;
+        ss.setf(std::ios::fixed);
+        ss.precision(3);
+        ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        bool first = true;
+        std::lock_guard lock(mutex_);
+        for (const auto& buffer : buffers_)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+
+            if (!first) ss << ',';
+            first = false;
+            ss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+                << ",\"tid\":" << buffer->threadId
+                << ",\"args\":{\"name\":\""
+                << (buffer->threadId == 1 ? "main" : "worker")
+                << ' ' << buffer->threadId << "\"}}";
+
+            // ts/dur у мікросекундах (дробова частина — наносекунди).
+            for (const TraceEvent& e : buffer->events)
+            {
+                ss << ",{\"name\":";
+                AppendJsonString(ss, e.name);
+                ss << ",\"cat\":\"footballmgmt\",\"ph\":\"X\",\"ts\":"
+                    << static_cast<double>(e.startNs) / 1000.0
+                    << ",\"dur\":" << static_cast<double>(e.durationNs) / 1000.0
+                    << ",\"pid\":" << pid << ",\"tid\":" << buffer->threadId
+                    << ",\"args\":{\"depth\":" << e.depth << "}}";
+            }
+        }
+        ss << "]}\n";
+        return ss.str();
+    }
+
+    bool Tracer::WriteChromeTrace(const FileManager& fileManager) const
+    {
+        if (!fileManager.EnsureDirectoryExists()) return false;
+
+        const std::string tempName = std::string(TRACE_FILE) + ".tmp";
+        {
+            std::ofstream file(fileManager.GetFullPath(tempName),
+                               std::ios::out | std::ios::trunc);
+            if (!file.is_open())
+            {
+                Console() << "[ПОМИЛКА] Не вдалося записати трасування у "
+                    << tempName << ".\n";
+                return false;
+            }
+            file << RenderChromeTrace();
+            if (!file) return false;
+        }
+        return fileManager.ReplaceFile(tempName, TRACE_FILE);
+    }
+}
@@ -0,0 +1,238 @@
+#include "../include/TransferMarket.h"
+#include "../include/Console.h"
+#include "../include/FreeAgent.h"
+#include "../include/ContractedPlayer.h"
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <unordered_map>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    /// Кандидат ринку з наперед обчисленими рейтингом і вартістю.
+    struct Candidate
+    {
+        std::shared_ptr<Player> player;
+        double rating;
+        double salary;
+        double cost;
+    };
+
+    constexpr std::size_t POSITION_COUNT = 4;
+
+    /// Клуб, у складі якого зараз гравець (його спостерігач), або nullptr.
+    ClubManager* OwnerOf(const Player& p)
+    {
+        return dynamic_cast<ClubManager*>(p.GetObserver());
+    }
+
+    /// Прибрати гравця зі складу @p owner (якщо є) без повідомлень.
+    void Release(ClubManager* owner, const Player& p)
+    {
+        if (!owner) return;
+        ScopedConsoleMute mute;
+        owner->RemovePlayers(p.GetPlayerId());
+    }
+
+    /// Повернути гравця у склад @p owner, якщо угода не відбулася.
+    void Restore(ClubManager& owner, const std::shared_ptr<Player>& p)
+    {
+        ScopedConsoleMute mute;
+        owner.AddPlayer(p);
+    }
+}
+
+namespace FootballManagement
+{
+    MarketResult TransferMarket::Match(
+        const std::vector<ClubDemand>& demands,
+        const std::vector<std::shared_ptr<Player>>& pool) const
+    {
+        MarketResult result;
+
+        // 1) Кандидати за позиціями; рейтинг рахується один раз на гравця.
+        std::array<std::vector<Candidate>, POSITION_COUNT> candidates;
+        for (const auto& p : pool)
+        {
+            if (!p) continue;
+
+            Candidate c{p, 0.0, 0.0, 0.0};
+            Position position;
+            if (const auto* fa = dynamic_cast<const FreeAgent*>(p.get()))
+            {
+                if (!fa->IsAvailableForNegotiation()) continue;
+                c.salary = fa->GetExpectedSalary();
+                c.cost = c.salary;
+                position = fa->GetPosition();
+            }
+            else if (const auto* cp =
+                dynamic_cast<const ContractedPlayer*>(p.get()))
+            {
+                if (!cp->IsListedForTransfer()) continue;
+                c.salary = cp->GetContractDetails().GetSalary();
+                c.cost = cp->GetTransferFee();
+                position = cp->GetPosition();
+            }
+            else
+            {
+                continue;
+            }
+
+            c.rating = p->CalculatePerformanceRating();
+            candidates[static_cast<std::size_t>(position)].push_back(
+                std::move(c));
+        }
+
+        for (auto& bucket : candidates)
+        {
+            std::sort(bucket.begin(), bucket.end(),
+                      [](const Candidate& a, const Candidate& b)
+                      {
+                          if (a.rating != b.rating) return a.rating > b.rating;
+                          return a.cost < b.cost;
+                      });
+        }
+
+        // 2) Відкриті запити кожної позиції, впорядковані за minRating.
+        std::array<std::multimap<double, std::size_t>, POSITION_COUNT> open;
+        std::unordered_map<const ClubManager*, double> budgets;
+        for (std::size_t i = 0; i < demands.size(); ++i)
+        {
+            const auto& d = demands[i];
+            if (!d.club)
+            {
+                result.unfilled.push_back(i);
+                continue;
+            }
+            open[static_cast<std::size_t>(d.position)].emplace(d.minRating, i);
+            budgets.emplace(d.club.get(), d.club->GetTransferBudget());
+        }
+
+        // 3) Найкращі кандидати обирають найвимогливіший сумісний запит.
+        for (std::size_t pos = 0; pos < POSITION_COUNT; ++pos)
+        {
+            auto& openDemands = open[pos];
+            for (const auto& c : candidates[pos])
+            {
+                if (openDemands.empty()) break;
+
+                auto it = openDemands.upper_bound(c.rating);
+                while (it != openDemands.begin())
+                {
+                    --it;
+                    const auto& d = demands[it->second];
+                    double& budget = budgets[d.club.get()];
+                    if (c.salary > d.maxSalary || c.cost > budget) continue;
+
+                    budget -= c.cost;
+                    result.assignments.push_back(
+                        {it->second, c.player, c.salary, c.cost, c.rating});
+                    result.totalRating += c.rating;
+                    result.totalCost += c.cost;
+                    openDemands.erase(it);
+                    break;
+                }
+            }
+
+            for (const auto& [_, index] : openDemands)
+                result.unfilled.push_back(index);
+        }
+
+        std::sort(result.unfilled.begin(), result.unfilled.end());
+        std::sort(result.assignments.begin(), result.assignments.end(),
+                  [](const MarketAssignment& a, const MarketAssignment& b)
+                  {
+                      return a.demandIndex < b.demandIndex;
+                  });
+        return result;
+    }
+
+    std::size_t TransferMarket::Execute(const std::vector<ClubDemand>& demands,
+                                        const MarketResult& result) const
+    {
+        std::size_t done = 0;
+
+        for (const auto& a : result.assignments)
+        {
+            if (a.demandIndex >= demands.size() || !a.player) continue;
+            const auto& d = demands[a.demandIndex];
+            if (!d.club) continue;
+
+            // Гравець може бути у складі іншого клубу: перехід забирає його
+            // звідти, щоб один об'єкт не опинився у двох складах.
+            ClubManager* seller = OwnerOf(*a.player);
+            if (seller == d.club.get()) continue; // уже у складі покупця
+            if (seller && !HasPermission(seller->GetActorPermissions(),
+                                         Permission::EditPlayers))
+            {
+                Console() << "[ВІДМОВА] Клуб \"" << seller->GetClubName()
+                    << "\" не може відпустити " << a.player->GetName()
+                    << ".\n";
+                continue;
+            }
+
+            if (auto fa = std::dynamic_pointer_cast<FreeAgent>(a.player))
+            {
+                Release(seller, *fa);
+                if (d.club->SignFreeAgent(fa, a.salary, d.contractUntil))
+                    ++done;
+                else if (seller)
+                    Restore(*seller, fa); // підписання не відбулося
+                continue;
+            }
+
+            auto cp = std::dynamic_pointer_cast<ContractedPlayer>(a.player);
+            if (!cp) continue;
+
+            if (a.cost > d.club->GetTransferBudget())
+            {
+                Console() << "[ПОМИЛКА] Недостатньо коштів для трансферу "
+                    << cp->GetName() << ".\n";
+                continue;
+            }
+            if (!HasPermission(d.club->GetActorPermissions(),
+                               Permission::EditPlayers))
+            {
+                Console() << "[ВІДМОВА] Клуб \"" << d.club->GetClubName()
+                    << "\" не може прийняти " << cp->GetName() << ".\n";
+                continue;
+            }
+
+            if (!cp->IsListedForTransfer() || a.cost < cp->GetTransferFee())
+            {
+                // Відхилена пропозиція нічого не змінює, лише пояснює причину.
+                cp->TransferToClub(d.club->GetClubName(), a.cost);
+                continue;
+            }
+
+            // Контракт переписується лише тоді, коли гравець уже у складі
+            // покупця: продавцю повертається гравець з незмінним контрактом.
+            // AddPlayer змінює ID, якщо він уже зайнятий у складі покупця.
+            Release(seller, *cp);
+            {
+                ScopedConsoleMute mute;
+                d.club->AddPlayer(cp);
+            }
+            if (d.club->FindPlayerById(cp->GetPlayerId()) != cp)
+            {
+                if (seller) Restore(*seller, cp);
+                continue;
+            }
+            cp->TransferToClub(d.club->GetClubName(), a.cost);
+
+            d.club->SetTransferBudget(d.club->GetTransferBudget() - a.cost);
+            if (seller)
+                seller->SetTransferBudget(seller->GetTransferBudget() +
+                                          a.cost);
+            ++done;
+        }
+
+        Console() << "[ІНФО] Трансферний ринок: виконано угод " << done
+            << " з " << result.assignments.size() << ".\n";
+        return done;
+    }
+}
@@ -1,4 +1,6 @@
 #include "../include/User.h"
+#include "../include/Console.h"
+#include "../include/PasswordHasher.h"
 
 #include <iostream>
 #include <sstream>
@@ -10,37 +12,49 @@ namespace FootballManagement
 {
     User::User()
         : userName_("guest"),
-          password_(""),
-          userRole_(UserRole::Guest)
+          passwordHash_(),
+          userRole_(UserRole::Guest),
+          customRole_(),
+          permissions_(DefaultPermissions(UserRole::Guest))
     {
     }
 
     User::User(const std::string& userName, const std::string& password,
                UserRole userRole)
         : userName_(userName),
-          password_(password),
-          userRole_(userRole)
+          passwordHash_(),
+          userRole_(userRole),
+          customRole_(),
+          permissions_(DefaultPermissions(userRole))
     {
         if (userName_.empty())
             throw std::invalid_argument("Логін не може бути порожнім.");
-        if (userRole_ != UserRole::Guest && password_.size() < 6)
+        if (userRole_ != UserRole::Guest && password.size() < 6)
             throw std::runtime_error(
                 "Пароль має містити щонайменше 6 символів.");
+        if (!password.empty()) passwordHash_ = PasswordHasher::Hash(password);
     }
 
     User::User(const User& other)
         : userName_(other.userName_),
-          password_(other.password_),
-          userRole_(other.userRole_)
+          passwordHash_(other.passwordHash_),
+          userRole_(other.userRole_),
+          customRole_(other.customRole_),
+          permissions_(other.permissions_),
+          migrated_(other.migrated_)
     {
     }
 
     User::User(User&& other) noexcept
         : userName_(std::move(other.userName_)),
-          password_(std::move(other.password_)),
-          userRole_(other.userRole_)
+          passwordHash_(std::move(other.passwordHash_)),
+          userRole_(other.userRole_),
+          customRole_(std::move(other.customRole_)),
+          permissions_(other.permissions_),
+          migrated_(other.migrated_)
     {
         other.userRole_ = UserRole::Guest;
+        other.permissions_ = NO_PERMISSIONS;
     }
 
     User& User::operator=(const User& other)
@@ -48,8 +62,11 @@ namespace FootballManagement
         if (this != &other)
         {
             userName_ = other.userName_;
-            password_ = other.password_;
+            passwordHash_ = other.passwordHash_;
             userRole_ = other.userRole_;
+            customRole_ = other.customRole_;
+            permissions_ = other.permissions_;
+            migrated_ = other.migrated_;
         }
         return *this;
     }
@@ -59,21 +76,28 @@ namespace FootballManagement
         if (this != &other)
         {
             userName_ = std::move(other.userName_);
-            password_ = std::move(other.password_);
+            passwordHash_ = std::move(other.passwordHash_);
             userRole_ = other.userRole_;
+            customRole_ = std::move(other.customRole_);
+            permissions_ = other.permissions_;
+            migrated_ = other.migrated_;
             other.userRole_ = UserRole::Guest;
+            other.permissions_ = NO_PERMISSIONS;
         }
         return *this;
     }
 
     User::~User() noexcept
     {
-        std::cout << "[ДЕБАГ] Користувача \"" << userName_ << "\" знищено.\n";
+        Console() << "[ДЕБАГ] Користувача \"" << userName_ << "\" знищено.\n";
     }
 
     std::string User::GetUserName() const { return userName_; }
-    std::string User::GetPassword() const { return password_; }
+    std::string User::GetPasswordHash() const { return passwordHash_; }
+    bool User::WasMigrated() const { return migrated_; }
     UserRole User::GetUserRole() const { return userRole_; }
+    const std::string& User::GetCustomRole() const { return customRole_; }
+    PermissionSet User::GetPermissions() const { return permissions_; }
 
     void User::SetUserName(const std::string& userName)
     {
@@ -87,40 +111,56 @@ namespace FootballManagement
         return userRole_ == UserRole::Admin;
     }
 
+    bool User::HasPermission(Permission permission) const
+    {
+        return FootballManagement::HasPermission(permissions_, permission);
+    }
+
     bool User::ChangePassword(const std::string& oldPassword,
                               const std::string& newPassword)
     {
         if (!VerifyPassword(oldPassword))
         {
-            std::cout << "[ПОМИЛКА] Невірний поточний пароль.\n";
+            Console() << "[ПОМИЛКА] Невірний поточний пароль.\n";
             return false;
         }
 
         if (newPassword.length() < 6)
         {
-            std::cout <<
+            Console() <<
                 "[ПОМИЛКА] Новий пароль занадто короткий (мінімум 6 символів).\n";
             return false;
         }
 
-        password_ = newPassword;
-        std::cout << "[УСПІХ] Пароль для користувача \"" << userName_
+        passwordHash_ = PasswordHasher::Hash(newPassword);
+        Console() << "[УСПІХ] Пароль для користувача \"" << userName_
             << "\" змінено.\n";
         return true;
     }
 
     bool User::VerifyPassword(const std::string& inputPassword) const
     {
-        return password_ == inputPassword;
+        if (passwordHash_.empty()) return inputPassword.empty();
+        return PasswordHasher::Verify(inputPassword, passwordHash_);
     }
 
     void User::SetRole(UserRole newRole)
     {
         userRole_ = newRole;
-        std::cout << "[ІНФО] Роль користувача \"" << userName_
+        customRole_.clear();
+        permissions_ = DefaultPermissions(newRole);
+        Console() << "[ІНФО] Роль користувача \"" << userName_
             << "\" встановлено.\n";
     }
 
+    void User::SetCustomRole(const std::string& roleName,
+                             PermissionSet permissions)
+    {
+        customRole_ = roleName;
+        permissions_ = roleName.empty() ? DefaultPermissions(userRole_)
+                                        : permissions;
+    }
+
     void User::ShowUserInfo() const
     {
         std::string roleStr;
@@ -134,13 +174,15 @@ namespace FootballManagement
             break;
         }
 
-        std::cout << "Користувач: " << userName_
+        if (!customRole_.empty()) roleStr += " / " + customRole_;
+
+        Console() << "Користувач: " << userName_
             << " | Роль: " << roleStr << "\n";
     }
 
     void User::Logout()
     {
-        std::cout << "[ІНФО] Користувач \"" << userName_
+        Console() << "[ІНФО] Користувач \"" << userName_
             << "\" вийшов із системи.\n";
     }
 
@@ -148,8 +190,9 @@ namespace FootballManagement
     std::string User::Serialize() const
     {
         std::stringstream ss;
-        ss << userName_ << ":" << password_ << ":"
+        ss << userName_ << ":" << passwordHash_ << ":"
             << static_cast<int>(userRole_);
+        if (!customRole_.empty()) ss << ":" << customRole_;
         return ss.str();
     }
 
@@ -164,12 +207,22 @@ namespace FootballManagement
             while (std::getline(ss, token, ':'))
                 parts.push_back(token);
 
-            if (parts.size() != 3)
+            if (parts.size() != 3 && parts.size() != 4)
                 throw std::runtime_error(
-                    "Некоректний формат рядка користувача (очікується 3 частини).");
+                    "Некоректний формат рядка користувача (очікується 3-4 частини).");
 
             userName_ = parts[0];
-            password_ = parts[1];
+            migrated_ = false;
+            if (parts[1].empty() || PasswordHasher::IsEncodedHash(parts[1]))
+            {
+                passwordHash_ = parts[1];
+            }
+            else
+            {
+                // Застарілий users.txt: пароль відкритим текстом.
+                passwordHash_ = PasswordHasher::Hash(parts[1]);
+                migrated_ = true;
+            }
 
             int roleInt = std::stoi(parts[2]);
             switch (roleInt)
@@ -182,15 +235,21 @@ namespace FootballManagement
                 break;
             default: throw std::out_of_range("Невідома роль.");
             }
+
+            customRole_ = parts.size() == 4 ? parts[3] : std::string();
+            permissions_ = DefaultPermissions(userRole_);
         }
         catch (const std::exception& e)
         {
-            std::cout << "[ПОМИЛКА] Не вдалося десеріалізувати користувача: "
+            Console() << "[ПОМИЛКА] Не вдалося десеріалізувати користувача: "
                 << e.what() << "\n";
 
             userName_ = "guest";
-            password_.clear();
+            passwordHash_.clear();
+            migrated_ = false;
             userRole_ = UserRole::Guest;
+            customRole_.clear();
+            permissions_ = NO_PERMISSIONS;
         }
     }
 }
@@ -0,0 +1,140 @@
+#include "../include/UserStore.h"
+#include "../include/Console.h"
+#include "../include/Trace.h"
+
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr const char* PUT_PREFIX = "PUT|";
+    constexpr const char* DEL_PREFIX = "DEL|";
+    constexpr std::size_t PREFIX_LENGTH = 4;
+
+    /// Логін — частина рядка користувача до першої двокрапки.
+    std::string UserNameOf(const std::string& userLine)
+    {
+        return userLine.substr(0, userLine.find(':'));
+    }
+}
+
+namespace FootballManagement
+{
+    UserStore::UserStore(FileManager fileManager, std::size_t compactThreshold)
+        : fileManager_(std::move(fileManager)),
+          compactThreshold_(compactThreshold == 0 ? 1 : compactThreshold)
+    {
+    }
+
+    void UserStore::Load(AuthManager& auth)
+    {
+        FM_TRACE_SCOPE("UserStore::Load");
+        // std::map: останній запис на логін перемагає, порядок — за логіном.
+        std::map<std::string, std::string> merged;
+        for (auto& line : fileManager_.LoadFromFile(USERS_FILE_NAME))
+        {
+            std::string name = UserNameOf(line);
+            merged[std::move(name)] = std::move(line);
+        }
+
+        pendingRecords_ = 0;
+        if (fileManager_.FileExists(USERS_LOG_FILE))
+        {
+            for (const auto& record : fileManager_.LoadFromFile(USERS_LOG_FILE))
+            {
+                ++pendingRecords_;
+                const std::string body = record.size() > PREFIX_LENGTH
+                                             ? record.substr(PREFIX_LENGTH)
+                                             : std::string();
+                if (record.rfind(PUT_PREFIX, 0) == 0 && !body.empty())
+                {
+                    merged[UserNameOf(body)] = body;
+                }
+                else if (record.rfind(DEL_PREFIX, 0) == 0 && !body.empty())
+                {
+                    merged.erase(body);
+                }
+                else
+                {
+                    Console() << "[ПОПЕРЕДЖЕННЯ] Пропущено запис журналу "
+                        "користувачів: " << record << "\n";
+                }
+            }
+        }
+
+        std::vector<std::string> lines;
+        lines.reserve(merged.size());
+        for (auto& [_, line] : merged) lines.push_back(std::move(line));
+        auth.DeserializeAllUsers(lines);
+
+        // Хеші замість відкритих паролів / адміністратор за замовчуванням
+        // мають потрапити на диск одразу.
+        if (auth.GetMigratedUserCount() > 0 || merged.empty())
+            Compact(auth);
+        else
+            CompactIfNeeded(auth);
+    }
+
+    bool UserStore::AppendRecord(const std::string& record)
+    {
+        if (!fileManager_.AppendLine(USERS_LOG_FILE, record)) return false;
+        ++pendingRecords_;
+        return true;
+    }
+
+    bool UserStore::RecordPut(const User& user)
+    {
+        return AppendRecord(PUT_PREFIX + user.Serialize());
+    }
+
+    bool UserStore::RecordDelete(const std::string& userName)
+    {
+        return AppendRecord(DEL_PREFIX + userName);
+    }
+
+    FileSaveRequest UserStore::SnapshotRequest(const AuthManager& auth) const
+    {
+        // Тимчасовий файл, fsync і лише потім атомарна підміна: обрив
+        // посередині залишає або старий знімок із журналом, або новий.
+        FileSaveRequest request;
+        request.fileName = USERS_FILE_NAME;
+        request.object = &auth;
+        request.atomic = true;
+        return request;
+    }
+
+    void UserStore::FinishCompaction()
+    {
+        if (fileManager_.FileExists(USERS_LOG_FILE))
+            fileManager_.DeleteFile(USERS_LOG_FILE);
+        pendingRecords_ = 0;
+
+        Console() << "[ІНФО] Знімок користувачів ущільнено.\n";
+    }
+
+    bool UserStore::Compact(const AuthManager& auth)
+    {
+        FM_TRACE_SCOPE("UserStore::Compact");
+        if (!fileManager_.SaveBatch({SnapshotRequest(auth)})) return false;
+        FinishCompaction();
+        return true;
+    }
+
+    bool UserStore::IsCompactionDue() const
+    {
+        return pendingRecords_ >= compactThreshold_;
+    }
+
+    bool UserStore::CompactIfNeeded(const AuthManager& auth)
+    {
+        if (!IsCompactionDue()) return false;
+        return Compact(auth);
+    }
+
+    std::size_t UserStore::GetPendingRecords() const
+    {
+        return pendingRecords_;
+    }
+}
@@ -0,0 +1,239 @@
+#include "../include/ValueForecaster.h"
+#include "../include/Console.h"
+#include "../include/FieldPlayer.h"
+#include "../include/Goalkeeper.h"
+#include "../include/WorkStealingPool.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace
+{
+    using namespace FootballManagement;
+
+    /// Очікувані події за матч для одного гравця.
+    struct Profile
+    {
+        bool keeper = false;
+        double goals = 0.0;
+        double assists = 0.0;
+        double shots = 0.0;
+        double tackles = 0.0;
+        double keyPasses = 0.0;
+        double conceded = 0.0;
+        double saves = 0.0;
+    };
+
+    /// Мінімум матчів, після якого історія гравця важливіша за типовий профіль.
+    constexpr int HISTORY_MIN_GAMES = 5;
+
+    Profile BuildProfile(const Player& p)
+    {
+        Profile profile;
+
+        if (const auto* gk = dynamic_cast<const Goalkeeper*>(&p))
+        {
+            profile.keeper = true;
+            profile.conceded = 1.2;
+            profile.saves = 3.0;
+            const int games = gk->GetMatchesPlayed();
+            if (games >= HISTORY_MIN_GAMES)
+            {
+                profile.conceded = static_cast<double>(gk->GetGoalsConceded())
+                    / games;
+                profile.saves = static_cast<double>(gk->GetSavesTotal()) / games;
+            }
+            return profile;
+        }
+
+        const auto* fp = dynamic_cast<const FieldPlayer*>(&p);
+        if (!fp) return profile;
+
+        switch (fp->GetPosition())
+        {
+        case Position::Forward:
+            profile = {false, 0.45, 0.20, 2.5, 0.8, 1.0, 0.0, 0.0};
+            break;
+        case Position::Midfielder:
+            profile = {false, 0.15, 0.25, 1.2, 1.8, 1.8, 0.0, 0.0};
+            break;
+        case Position::Defender:
+            profile = {false, 0.05, 0.08, 0.5, 2.8, 0.6, 0.0, 0.0};
+            break;
+        case Position::Goalkeeper:
+            profile = {false, 0.0, 0.02, 0.05, 0.5, 0.3, 0.0, 0.0};
+            break;
+        }
+
+        const int games = fp->GetTotalGames();
+        if (games >= HISTORY_MIN_GAMES)
+        {
+            const double g = games;
+            profile.goals = fp->GetTotalGoals() / g;
+            profile.assists = fp->GetTotalAssists() / g;
+            profile.shots = fp->GetTotalShots() / g;
+            profile.tackles = fp->GetTotalTackles() / g;
+            profile.keyPasses = fp->GetKeyPasses() / g;
+        }
+        return profile;
+    }
+
+    int DrawCount(std::mt19937_64& rng, double mean)
+    {
+        if (mean <= 0.0) return 0;
+        return std::poisson_distribution<int>(mean)(rng);
+    }
+
+    /// Один сезон сценарію: вік, травми, накопичення статистики.
+    void SimulateSeason(Player& player, const Profile& profile,
+                        const ForecastConfig& config, std::mt19937_64& rng)
+    {
+        player.CelebrateBirthday();
+
+        auto* keeper = profile.keeper ? dynamic_cast<Goalkeeper*>(&player)
+                                      : nullptr;
+        auto* field = profile.keeper ? nullptr
+                                     : dynamic_cast<FieldPlayer*>(&player);
+
+        const int age = player.GetAge();
+        const double injuryRate = std::min(
+            0.5, config.injuryRatePerMatch * (age > 30 ? 1.0 + 0.1 * (age - 30)
+                                                       : 1.0));
+        std::bernoulli_distribution injured(injuryRate);
+        std::uniform_int_distribution<int> recovery(7, 90);
+
+        int sidelined = 0; // матчів до повернення (приблизно тиждень на матч)
+        for (int m = 0; m < config.matchesPerSeason; ++m)
+        {
+            if (sidelined > 0)
+            {
+                if (--sidelined == 0) player.ReturnToFitness();
+                continue;
+            }
+
+            if (injured(rng))
+            {
+                const int days = recovery(rng);
+                player.ReportInjury("Симульована травма", days);
+                sidelined = (days + 6) / 7;
+                continue;
+            }
+
+            if (keeper)
+            {
+                keeper->UpdateMatchStats(DrawCount(rng, profile.conceded),
+                                         DrawCount(rng, profile.saves));
+            }
+            else if (field)
+            {
+                const int goals = DrawCount(rng, profile.goals);
+                const int shots = goals + DrawCount(
+                    rng, std::max(0.0, profile.shots - profile.goals));
+                field->RegisterMatchPlayed();
+                field->UpdateAttackingStats(goals,
+                                            DrawCount(rng, profile.assists),
+                                            shots);
+                field->UpdateDefensiveStats(DrawCount(rng, profile.tackles));
+                for (int k = DrawCount(rng, profile.keyPasses); k > 0; --k)
+                    field->RegisterKeyPass();
+            }
+        }
+    }
+
+    /// Перцентиль відсортованої вибірки з лінійною інтерполяцією.
+    double Percentile(const std::vector<double>& sorted, double q)
+    {
+        if (sorted.empty()) return 0.0;
+        const double pos = q * static_cast<double>(sorted.size() - 1);
+        const auto lo = static_cast<std::size_t>(std::floor(pos));
+        const auto hi = std::min(lo + 1, sorted.size() - 1);
+        const double frac = pos - static_cast<double>(lo);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * frac;
+    }
+}
+
+namespace FootballManagement
+{
+    ValueForecaster::ValueForecaster(ForecastConfig config)
+        : config_(config)
+    {
+        if (config_.trialsPerTask == 0) config_.trialsPerTask = 1;
+        if (config_.seasons < 1) config_.seasons = 1;
+    }
+
+    std::vector<ValueForecast> ValueForecaster::Forecast(
+        const std::vector<std::shared_ptr<Player>>& players) const
+    {
+        const std::size_t trials = config_.trials;
+        std::vector<ValueForecast> result(players.size());
+        std::vector<std::vector<double>> samples(players.size());
+        std::vector<Profile> profiles(players.size());
+
+        for (std::size_t i = 0; i < players.size(); ++i)
+        {
+            if (!players[i]) continue;
+            samples[i].resize(trials);
+            profiles[i] = BuildProfile(*players[i]);
+        }
+
+        {
+            WorkStealingPool pool(config_.threads);
+            std::vector<std::mt19937_64> engines(pool.GetThreadCount());
+
+            for (std::size_t i = 0; i < players.size(); ++i)
+            {
+                if (!players[i]) continue;
+                for (std::size_t start = 0; start < trials;
+                     start += config_.trialsPerTask)
+                {
+                    const std::size_t end = std::min(
+                        trials, start + config_.trialsPerTask);
+                    pool.Submit([&, i, start, end]()
+                    {
+                        ScopedConsoleMute mute;
+                        auto& rng = engines[WorkStealingPool::
+                            CurrentWorkerIndex()];
+                        const Player& original = *players[i];
+
+                        for (std::size_t t = start; t < end; ++t)
+                        {
+                            rng.seed(MixSeed(config_.seed ^
+                                MixSeed(i * trials + t)));
+                            auto copy = original.Clone();
+                            for (int s = 0; s < config_.seasons; ++s)
+                                SimulateSeason(*copy, profiles[i], config_,
+                                               rng);
+                            samples[i][t] = copy->CalculateValue();
+                        }
+                    });
+                }
+            }
+            pool.WaitIdle();
+        }
+
+        for (std::size_t i = 0; i < players.size(); ++i)
+        {
+            if (!players[i]) continue;
+
+            auto& values = samples[i];
+            std::sort(values.begin(), values.end());
+
+            ValueForecast& f = result[i];
+            f.playerId = players[i]->GetPlayerId();
+            f.name = players[i]->GetName();
+            f.currentValue = players[i]->CalculateValue();
+            double sum = 0.0;
+            for (const double v : values) sum += v;
+            f.mean = values.empty() ? 0.0 : sum / values.size();
+            f.p10 = Percentile(values, 0.10);
+            f.p50 = Percentile(values, 0.50);
+            f.p90 = Percentile(values, 0.90);
+        }
+
+        Console() << "[ІНФО] Прогноз вартості: гравців " << players.size()
+            << ", сценаріїв на гравця " << trials << ".\n";
+        return result;
+    }
+}
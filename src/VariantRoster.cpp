@@ -0,0 +1,86 @@
+#include "../include/VariantRoster.h"
+#include "../include/ClubManager.h"
+
+#include <iostream>
+
+namespace FootballManagement
+{
+    VariantRoster::VariantRoster(const ClubManager& club)
+    {
+        for (const auto& p : club.GetAll())
+        {
+            if (const auto* c = dynamic_cast<const ContractedPlayer*>(p.get()))
+                contracted_.push_back(*c);
+            else if (const auto* a = dynamic_cast<const FreeAgent*>(p.get()))
+                freeAgents_.push_back(*a);
+            else if (const auto* g = dynamic_cast<const Goalkeeper*>(p.get()))
+                goalkeepers_.push_back(*g);
+        }
+    }
+
+    void VariantRoster::Add(PlayerVariant player)
+    {
+        std::visit([this](auto&& p)
+        {
+            using T = std::decay_t<decltype(p)>;
+            if constexpr (std::is_same_v<T, ContractedPlayer>)
+                contracted_.push_back(std::move(p));
+            else if constexpr (std::is_same_v<T, FreeAgent>)
+                freeAgents_.push_back(std::move(p));
+            else
+                goalkeepers_.push_back(std::move(p));
+        }, std::move(player));
+    }
+
+    std::size_t VariantRoster::Size() const
+    {
+        return contracted_.size() + freeAgents_.size() + goalkeepers_.size();
+    }
+
+    void VariantRoster::Clear()
+    {
+        contracted_.clear();
+        freeAgents_.clear();
+        goalkeepers_.clear();
+    }
+
+    double VariantRoster::TotalValue() const
+    {
+        double total = 0.0;
+        ForEach([&total](const auto& p) { total += p.CalculateValue(); });
+        return total;
+    }
+
+    std::vector<std::pair<int, double>> VariantRoster::RateAll() const
+    {
+        std::vector<std::pair<int, double>> ratings;
+        ratings.reserve(Size());
+        ForEach([&ratings](const auto& p)
+        {
+            ratings.emplace_back(p.GetPlayerId(),
+                                 p.CalculatePerformanceRating());
+        });
+        return ratings;
+    }
+
+    std::vector<int>
+    VariantRoster::FilterByStatus(const std::string& status) const
+    {
+        return FilterIds([&status](const auto& p)
+        {
+            return ContainsIgnoreCase(p.GetStatus(), status);
+        });
+    }
+
+    std::vector<std::string> VariantRoster::SerializeAll() const
+    {
+        std::vector<std::string> lines;
+        lines.reserve(Size());
+        ForEach([&lines](const auto& p)
+        {
+            using T = std::decay_t<decltype(p)>;
+            lines.push_back(T::GetSchema().EncodeText(p));
+        });
+        return lines;
+    }
+}
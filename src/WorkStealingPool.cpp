@@ -0,0 +1,155 @@
+#include "../include/WorkStealingPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    thread_local int currentWorker = -1;
+    thread_local const void* currentPool = nullptr;
+}
+
+namespace FootballManagement
+{
+    WorkStealingPool::WorkStealingPool(unsigned threadCount)
+        : pending_(0),
+          queued_(0),
+          nextQueue_(0),
+          stopping_(false)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        queues_.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; ++i)
+            queues_.push_back(std::make_unique<WorkerQueue>());
+
+        workers_.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; ++i)
+            workers_.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            stopping_ = true;
+        }
+        workAvailable_.notify_all();
+        for (auto& w : workers_)
+            if (w.joinable()) w.join();
+    }
+
+    void WorkStealingPool::Submit(std::function<void()> task)
+    {
+        const auto count = static_cast<unsigned>(queues_.size());
+        const unsigned target = (currentPool == this)
+                                    ? static_cast<unsigned>(currentWorker)
+                                    : static_cast<unsigned>(
+                                        nextQueue_.fetch_add(1) % count);
+
+        pending_.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(queues_[target]->mutex);
+            queues_[target]->tasks.push_back(std::move(task));
+        }
+        queued_.fetch_add(1);
+
+        // Порожнє захоплення закриває вікно між перевіркою умови і wait().
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+        }
+        workAvailable_.notify_one();
+    }
+
+    void WorkStealingPool::WaitIdle()
+    {
+        std::unique_lock<std::mutex> lock(stateMutex_);
+        idle_.wait(lock, [this]() { return pending_.load() == 0; });
+
+        if (firstError_)
+        {
+            auto error = firstError_;
+            firstError_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    unsigned WorkStealingPool::GetThreadCount() const
+    {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+    int WorkStealingPool::CurrentWorkerIndex()
+    {
+        return currentWorker;
+    }
+
+    bool WorkStealingPool::TryTake(unsigned index,
+                                   std::function<void()>& task)
+    {
+        {
+            auto& own = *queues_[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+
+        const auto count = static_cast<unsigned>(queues_.size());
+        for (unsigned step = 1; step < count; ++step)
+        {
+            auto& victim = *queues_[(index + step) % count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingPool::WorkerLoop(unsigned index)
+    {
+        currentWorker = static_cast<int>(index);
+        currentPool = this;
+
+        while (true)
+        {
+            std::function<void()> task;
+            if (!TryTake(index, task))
+            {
+                std::unique_lock<std::mutex> lock(stateMutex_);
+                workAvailable_.wait(lock, [this]()
+                {
+                    return stopping_ || queued_.load() > 0;
+                });
+                if (stopping_ && queued_.load() == 0) return;
+                continue;
+            }
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(stateMutex_);
+                if (!firstError_) firstError_ = std::current_exception();
+            }
+
+            if (pending_.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(stateMutex_);
+                idle_.notify_all();
+            }
+        }
+    }
+}
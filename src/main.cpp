@@ -3,6 +3,8 @@
 
 #include "../include/Menu.h"
 #include "../include/ClubManager.h"
+#include "../include/FileManager.h"
+#include "../include/Trace.h"
 
 int main()
 {
@@ -18,6 +20,9 @@ int main()
         Menu menu(club);
         menu.Run();
 
+        if constexpr (TRACING_ENABLED)
+            Tracer::GetInstance().WriteChromeTrace(FileManager());
+
         return 0;
     }
     catch (const std::exception& e)
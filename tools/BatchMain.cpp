@@ -0,0 +1,157 @@
+#include "../include/BatchProcessor.h"
+#include "../include/ClubManager.h"
+#include "../include/Console.h"
+#include "../include/FileManager.h"
+#include "../include/IngestPipeline.h"
+#include "../include/Utils.h"
+
+#include <iostream>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace
+{
+    using namespace FootballManagement;
+    using Clock = std::chrono::steady_clock;
+
+    void PrintUsage(const char* program)
+    {
+        std::cout << "Використання: " << program
+            << " [--data-dir=КАТАЛОГ] [--dry-run] [--allow-lossy-load]"
+            " [--verbose] [сценарій|-]\n"
+            << "  Завантажує " << PLAYERS_DATA_FILE << " один раз, виконує"
+            " сценарій (файл або stdin)\n"
+            << "  і зберігає склад один раз наприкінці.\n"
+            << "  --dry-run  виконати без збереження\n"
+            << "  --allow-lossy-load  працювати, навіть якщо частину рядків\n"
+            << "             складу не вдалося прочитати (їх буде втрачено\n"
+            << "             під час збереження)\n"
+            << "  --verbose  показувати повідомлення моделі\n";
+    }
+
+    long long ElapsedMs(Clock::time_point since)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - since).count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace FootballManagement;
+
+    std::ios::sync_with_stdio(false);
+
+    std::string dataDir = "data/";
+    std::string scriptPath = "-";
+    bool dryRun = false;
+    bool allowLossyLoad = false;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+        if (arg == "--dry-run") dryRun = true;
+        else if (arg == "--allow-lossy-load") allowLossyLoad = true;
+        else if (arg == "--verbose") verbose = true;
+        else if (arg.rfind("--data-dir=", 0) == 0) dataDir = arg.substr(11);
+        else if (arg.size() > 1 && arg[0] == '-' && arg != "-")
+        {
+            std::cerr << "[ПОМИЛКА] Невідомий параметр: " << arg << "\n";
+            PrintUsage(argv[0]);
+            return 2;
+        }
+        else scriptPath = arg;
+    }
+
+    try
+    {
+        std::optional<ScopedConsoleMute> mute;
+        if (!verbose) mute.emplace();
+
+        const FileManager fileManager(dataDir);
+        ClubManager club;
+
+        auto stage = Clock::now();
+        const IngestReport report = IngestPipeline().Run(
+            fileManager.GetFullPath(PLAYERS_DATA_FILE), club);
+        std::cout << "[ІНФО] Завантажено гравців: " << club.GetAll().size()
+            << " (" << ElapsedMs(stage) << " мс).\n";
+        if (report.IsLossy())
+        {
+            std::cerr << "[ПОМИЛКА] Склад завантажено не повністю"
+                << (report.ok ? "" : " (файл не дочитано)")
+                << ": пропущено рядків " << report.skipped << ".\n";
+            if (!allowLossyLoad)
+            {
+                std::cerr << "         Збереження перезаписало б "
+                    << PLAYERS_DATA_FILE << " без них. Виправте файл або"
+                    " запустіть з --allow-lossy-load.\n";
+                return 1;
+            }
+            std::cerr << "[ПОПЕРЕДЖЕННЯ] --allow-lossy-load: пропущені"
+                " рядки буде втрачено під час збереження.\n";
+        }
+
+        std::ifstream file;
+        if (scriptPath != "-")
+        {
+            file.open(scriptPath);
+            if (!file.is_open())
+            {
+                std::cerr << "[ПОМИЛКА] Не вдалося відкрити сценарій: "
+                    << scriptPath << "\n";
+                return 1;
+            }
+        }
+
+        stage = Clock::now();
+        BatchProcessor processor(club);
+        const BatchSummary summary = processor.Run(
+            scriptPath == "-" ? std::cin : file);
+
+        for (const auto& error : summary.errors)
+            std::cerr << "[ПОМИЛКА] " << error << "\n";
+
+        std::cout << "[ІНФО] Операцій: " << summary.lines
+            << ", виконано: " << summary.applied
+            << ", помилок: " << summary.errors.size()
+            << " (" << ElapsedMs(stage) << " мс).\n"
+            << "       додано: " << summary.added
+            << ", видалено: " << summary.removed
+            << ", переоцінено: " << summary.revalued
+            << ", підписано: " << summary.signings
+            << ", продано: " << summary.transfers << ".\n";
+
+        if (dryRun)
+        {
+            std::cout << "[ІНФО] --dry-run: зміни не збережено.\n";
+        }
+        else
+        {
+            stage = Clock::now();
+            if (!fileManager.SaveToFile(PLAYERS_DATA_FILE, club))
+            {
+                std::cerr << "[ПОМИЛКА] Не вдалося зберегти склад.\n";
+                return 1;
+            }
+            std::cout << "[УСПІХ] Склад збережено (" << ElapsedMs(stage)
+                << " мс).\n";
+        }
+
+        return summary.errors.empty() ? 0 : 3;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[КРИТИЧНА ПОМИЛКА] " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,374 @@
+#include "LocalServer.h"
+#include "../include/Console.h"
+
+#include <iostream>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr std::uint64_t LISTEN_KEY = 0;
+    constexpr std::uint64_t WAKE_KEY = 1;
+    constexpr std::uint64_t SIGNAL_KEY = 2;
+    constexpr std::uint64_t FIRST_CONNECTION_KEY = 16;
+
+    constexpr std::size_t MAX_FRAME = 1u << 20; ///< 1 МіБ на запит.
+    constexpr int MAX_EVENTS = 256;
+
+    [[noreturn]] void ThrowErrno(const std::string& what)
+    {
+        throw std::runtime_error(what + ": " + std::strerror(errno));
+    }
+
+    void AddToEpoll(int epollFd, int fd, std::uint64_t key, std::uint32_t events)
+    {
+        epoll_event ev{};
+        ev.events = events;
+        ev.data.u64 = key;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) != 0)
+            ThrowErrno("epoll_ctl");
+    }
+
+    void AppendFrame(std::string& out, const std::string& payload)
+    {
+        const auto n = static_cast<std::uint32_t>(payload.size());
+        out.push_back(static_cast<char>((n >> 24) & 0xFF));
+        out.push_back(static_cast<char>((n >> 16) & 0xFF));
+        out.push_back(static_cast<char>((n >> 8) & 0xFF));
+        out.push_back(static_cast<char>(n & 0xFF));
+        out += payload;
+    }
+
+    std::uint32_t ReadFrameLength(const std::string& in)
+    {
+        const auto* b = reinterpret_cast<const unsigned char*>(in.data());
+        return (static_cast<std::uint32_t>(b[0]) << 24) |
+            (static_cast<std::uint32_t>(b[1]) << 16) |
+            (static_cast<std::uint32_t>(b[2]) << 8) |
+            static_cast<std::uint32_t>(b[3]);
+    }
+
+    /// Чи є в буфері кадр, який Dispatch() ще може взяти (або відхилити).
+    bool HasFrame(const std::string& in)
+    {
+        if (in.size() < 4) return false;
+        const std::uint32_t length = ReadFrameLength(in);
+        return length > MAX_FRAME ||
+            in.size() >= 4 + static_cast<std::size_t>(length);
+    }
+}
+
+namespace FootballManagement
+{
+    LocalServer::LocalServer(ClubService& service, std::string socketPath,
+                             unsigned workers)
+        : service_(service),
+          socketPath_(std::move(socketPath)),
+          nextConnectionId_(FIRST_CONNECTION_KEY)
+    {
+        sockaddr_un addr{};
+        if (socketPath_.empty() || socketPath_.size() >= sizeof(addr.sun_path))
+            throw std::runtime_error("Некоректний шлях до сокета.");
+
+        // Сигнали блокуються до запуску пулу, щоб їх успадкували всі потоки
+        // і SIGINT/SIGTERM приходили лише через signalfd.
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        signalFd_ = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+        if (signalFd_ < 0) ThrowErrno("signalfd");
+
+        wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wakeFd_ < 0) ThrowErrno("eventfd");
+
+        listenFd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                           0);
+        if (listenFd_ < 0) ThrowErrno("socket");
+
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, socketPath_.c_str(), socketPath_.size());
+        unlink(socketPath_.c_str());
+        if (bind(listenFd_, reinterpret_cast<sockaddr*>(&addr),
+                 sizeof(addr)) != 0)
+            ThrowErrno("bind " + socketPath_);
+        if (listen(listenFd_, SOMAXCONN) != 0) ThrowErrno("listen");
+
+        epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+        if (epollFd_ < 0) ThrowErrno("epoll_create1");
+        AddToEpoll(epollFd_, listenFd_, LISTEN_KEY, EPOLLIN);
+        AddToEpoll(epollFd_, wakeFd_, WAKE_KEY, EPOLLIN);
+        AddToEpoll(epollFd_, signalFd_, SIGNAL_KEY, EPOLLIN);
+
+        pool_ = std::make_unique<WorkStealingPool>(workers);
+    }
+
+    LocalServer::~LocalServer()
+    {
+        if (pool_) pool_->WaitIdle();
+        pool_.reset();
+
+        for (auto& [_, c] : connections_) close(c.fd);
+        for (const int fd : {listenFd_, epollFd_, wakeFd_, signalFd_})
+            if (fd >= 0) close(fd);
+        if (listenFd_ >= 0) unlink(socketPath_.c_str());
+    }
+
+    void LocalServer::Run()
+    {
+        Console() << "[ІНФО] Робочих потоків: "
+            << pool_->GetThreadCount() << ".\n";
+
+        epoll_event events[MAX_EVENTS];
+        bool running = true;
+        while (running)
+        {
+            const int n = epoll_wait(epollFd_, events, MAX_EVENTS, -1);
+            if (n < 0)
+            {
+                if (errno == EINTR) continue;
+                ThrowErrno("epoll_wait");
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                const std::uint64_t key = events[i].data.u64;
+                const std::uint32_t mask = events[i].events;
+
+                if (key == LISTEN_KEY) Accept();
+                else if (key == WAKE_KEY) DrainCompletions();
+                else if (key == SIGNAL_KEY) running = false;
+                else
+                {
+                    if (mask & (EPOLLIN | EPOLLHUP | EPOLLERR)) ReadFrom(key);
+                    if ((mask & EPOLLOUT) && connections_.count(key))
+                        WriteTo(key);
+                }
+            }
+        }
+
+        Console() << "[ІНФО] Зупинка сервера: завершуємо поточні запити.\n";
+        pool_->WaitIdle();
+        DrainCompletions();
+    }
+
+    void LocalServer::Accept()
+    {
+        while (true)
+        {
+            const int fd = accept4(listenFd_, nullptr, nullptr,
+                                   SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0)
+            {
+                if (errno == EINTR) continue;
+                return; // EAGAIN або тимчасова помилка
+            }
+
+            const std::uint64_t id = nextConnectionId_++;
+            connections_[id].fd = fd;
+            AddToEpoll(epollFd_, fd, id, EPOLLIN | EPOLLRDHUP);
+        }
+    }
+
+    void LocalServer::ReadFrom(std::uint64_t id)
+    {
+        const auto it = connections_.find(id);
+        if (it == connections_.end()) return;
+        Connection& c = it->second;
+
+        char buffer[64 * 1024];
+        while (true)
+        {
+            const ssize_t got = recv(c.fd, buffer, sizeof(buffer), 0);
+            if (got > 0)
+            {
+                c.in.append(buffer, static_cast<std::size_t>(got));
+                continue;
+            }
+            if (got < 0 && errno == EINTR) continue;
+            if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            if (got == 0)
+            {
+                // Клієнт завершив передачу: кадри, що вже в буфері, усе одно
+                // виконуються, а читати сокет (рівневий EOF) більше не треба.
+                c.inputDone = true;
+                WatchWrites(id, !c.out.empty());
+                break;
+            }
+
+            // Помилка сокета: відповідь доставити вже не вийде.
+            if (c.busy)
+            {
+                c.closing = true;
+                epoll_ctl(epollFd_, EPOLL_CTL_DEL, c.fd, nullptr);
+                c.polled = false;
+            }
+            else
+            {
+                Close(id);
+            }
+            return;
+        }
+
+        Dispatch(id);
+        CloseIfDrained(id);
+    }
+
+    void LocalServer::Dispatch(std::uint64_t id)
+    {
+        Connection& c = connections_.at(id);
+        if (c.busy || c.closing || c.in.size() < 4) return;
+
+        const std::uint32_t length = ReadFrameLength(c.in);
+        if (length > MAX_FRAME)
+        {
+            AppendFrame(c.out, "ERR|занадто великий запит");
+            WriteTo(id);
+            Close(id);
+            return;
+        }
+        if (c.in.size() < 4 + static_cast<std::size_t>(length)) return;
+
+        std::string request = c.in.substr(4, length);
+        c.in.erase(0, 4 + static_cast<std::size_t>(length));
+        c.busy = true;
+
+        pool_->Submit([this, id, request = std::move(request),
+                       session = c.session]() mutable
+        {
+            ScopedConsoleMute mute;
+            std::string response = service_.Handle(request, session);
+            {
+                std::lock_guard<std::mutex> lock(completedMutex_);
+                completed_.push_back({id, std::move(response),
+                                      std::move(session)});
+            }
+            const std::uint64_t one = 1;
+            [[maybe_unused]] const auto ignored = write(wakeFd_, &one,
+                                                        sizeof(one));
+        });
+    }
+
+    void LocalServer::DrainCompletions()
+    {
+        std::uint64_t counter = 0;
+        [[maybe_unused]] const auto ignored = read(wakeFd_, &counter,
+                                                   sizeof(counter));
+
+        std::vector<Completion> ready;
+        {
+            std::lock_guard<std::mutex> lock(completedMutex_);
+            ready.swap(completed_);
+        }
+
+        for (auto& done : ready)
+        {
+            const auto it = connections_.find(done.connection);
+            if (it == connections_.end()) continue;
+            Connection& c = it->second;
+
+            c.busy = false;
+            if (c.closing)
+            {
+                Close(done.connection);
+                continue;
+            }
+
+            c.session = std::move(done.session);
+            AppendFrame(c.out, done.response);
+            WriteTo(done.connection);
+            if (!connections_.count(done.connection)) continue;
+            Dispatch(done.connection);
+            CloseIfDrained(done.connection);
+        }
+    }
+
+    void LocalServer::WriteTo(std::uint64_t id)
+    {
+        const auto it = connections_.find(id);
+        if (it == connections_.end()) return;
+        Connection& c = it->second;
+
+        std::size_t sent = 0;
+        while (sent < c.out.size())
+        {
+            const ssize_t n = send(c.fd, c.out.data() + sent,
+                                   c.out.size() - sent, MSG_NOSIGNAL);
+            if (n > 0)
+            {
+                sent += static_cast<std::size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+            c.out.clear();
+            if (!c.busy)
+            {
+                Close(id);
+            }
+            else
+            {
+                c.closing = true;
+                epoll_ctl(epollFd_, EPOLL_CTL_DEL, c.fd, nullptr);
+                c.polled = false;
+            }
+            return;
+        }
+
+        c.out.erase(0, sent);
+        WatchWrites(id, !c.out.empty());
+        CloseIfDrained(id);
+    }
+
+    void LocalServer::WatchWrites(std::uint64_t id, bool enable)
+    {
+        Connection& c = connections_.at(id);
+        epoll_event ev{};
+        ev.data.u64 = id;
+        if (!c.inputDone)
+        {
+            ev.events = EPOLLIN | EPOLLRDHUP | (enable ? EPOLLOUT : 0u);
+            epoll_ctl(epollFd_, EPOLL_CTL_MOD, c.fd, &ev);
+            return;
+        }
+
+        // Після EOF сокет у epoll лише поки є недописані відповіді.
+        if (enable == c.polled) return;
+        ev.events = EPOLLOUT;
+        epoll_ctl(epollFd_, enable ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, c.fd, &ev);
+        c.polled = enable;
+    }
+
+    void LocalServer::CloseIfDrained(std::uint64_t id)
+    {
+        const auto it = connections_.find(id);
+        if (it == connections_.end()) return;
+        const Connection& c = it->second;
+        if (c.inputDone && !c.busy && c.out.empty() && !HasFrame(c.in))
+            Close(id);
+    }
+
+    void LocalServer::Close(std::uint64_t id)
+    {
+        const auto it = connections_.find(id);
+        if (it == connections_.end()) return;
+
+        if (it->second.polled)
+            epoll_ctl(epollFd_, EPOLL_CTL_DEL, it->second.fd, nullptr);
+        close(it->second.fd);
+        connections_.erase(it);
+    }
+}
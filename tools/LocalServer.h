@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../include/ClubService.h"
+#include "../include/WorkStealingPool.h"
+
+namespace FootballManagement
+{
+    /**
+     * @file LocalServer.h
+     * @brief Сервер запитів ClubService через UNIX-сокет (Linux, epoll).
+     * @details Кадр протоколу: 4 байти довжини (big-endian) + тіло запиту
+     *          чи відповіді у форматі ClubService. Один потік epoll читає та
+     *          пише сокети, запити виконує WorkStealingPool. На з'єднання
+     *          обробляється не більше одного запиту одночасно, тож відповіді
+     *          приходять у порядку запитів (конвеєрні запити чекають у буфері).
+     *          SIGINT/SIGTERM завершують Run() після обробки поточних запитів.
+     */
+    class LocalServer
+    {
+    private:
+        /// @brief Стан одного клієнтського з'єднання.
+        struct Connection
+        {
+            int fd = -1;
+            std::string in; ///< Прочитані, ще не розібрані байти.
+            std::string out; ///< Відповіді, ще не відправлені.
+            bool busy = false; ///< Запит виконується у пулі.
+            bool closing = false; ///< Помилка сокета під час запиту.
+            bool inputDone = false;
+            ///< Клієнт завершив передачу (recv() == 0): буферизовані кадри
+            ///< ще виконуються, після останньої відповіді з'єднання закривається.
+            bool polled = true; ///< fd зареєстровано в epoll.
+            ServiceSession session; ///< Сесія (вхід користувача).
+        };
+
+        /// @brief Готова відповідь від робочого потоку.
+        struct Completion
+        {
+            std::uint64_t connection;
+            std::string response;
+            ServiceSession session;
+        };
+
+        ClubService& service_; ///< Обробник запитів.
+        std::string socketPath_; ///< Шлях до UNIX-сокета.
+        int listenFd_ = -1;
+        int epollFd_ = -1;
+        int wakeFd_ = -1; ///< eventfd: робочі потоки будять цикл.
+        int signalFd_ = -1; ///< signalfd для SIGINT/SIGTERM.
+        std::unique_ptr<WorkStealingPool> pool_; ///< Виконавці запитів.
+
+        std::unordered_map<std::uint64_t, Connection> connections_;
+        std::uint64_t nextConnectionId_; ///< Ідентифікатор для epoll_event.data.
+
+        std::mutex completedMutex_;
+        std::vector<Completion> completed_; ///< Захищено completedMutex_.
+
+        void Accept();
+        void ReadFrom(std::uint64_t id);
+        void WriteTo(std::uint64_t id);
+        void Dispatch(std::uint64_t id);
+        void DrainCompletions();
+        void Close(std::uint64_t id);
+        void CloseIfDrained(std::uint64_t id);
+        void WatchWrites(std::uint64_t id, bool enable);
+
+    public:
+        /**
+         * @brief Створити сокет і пул.
+         * @param service Обробник запитів.
+         * @param socketPath Шлях до сокета (наявний файл буде замінено).
+         * @param workers Кількість робочих потоків (0 — апаратна).
+         * @throws std::runtime_error, якщо сокет не вдалося створити.
+         */
+        LocalServer(ClubService& service, std::string socketPath,
+                    unsigned workers = 0);
+
+        ~LocalServer();
+
+        LocalServer(const LocalServer&) = delete;
+        LocalServer& operator=(const LocalServer&) = delete;
+
+        /// @brief Обслуговувати клієнтів до SIGINT/SIGTERM.
+        void Run();
+    };
+}
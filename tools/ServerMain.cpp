@@ -0,0 +1,125 @@
+#include "LocalServer.h"
+
+#include "../include/AuthManager.h"
+#include "../include/ClubManager.h"
+#include "../include/ClubService.h"
+#include "../include/Console.h"
+#include "../include/FileManager.h"
+#include "../include/IngestPipeline.h"
+#include "../include/Metrics.h"
+#include "../include/Trace.h"
+#include "../include/UserStore.h"
+#include "../include/Utils.h"
+
+#include <iostream>
+#include <optional>
+#include <string>
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::cout << "Використання: " << program
+            << " [--socket=ШЛЯХ] [--data-dir=КАТАЛОГ] [--workers=N]"
+            " [--allow-lossy-load] [--verbose]\n"
+            << "  Тримає склад і користувачів у пам'яті та обслуговує запити\n"
+            << "  search/filter/rating/sign через UNIX-сокет (див. ClubService.h).\n"
+            << "  Склад зберігається при завершенні (SIGINT/SIGTERM).\n"
+            << "  --allow-lossy-load  стартувати, навіть якщо частину рядків\n"
+            << "  складу не вдалося прочитати (їх буде втрачено при збереженні).\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace FootballManagement;
+
+    std::string socketPath = "/tmp/footballmgmt.sock";
+    std::string dataDir = "data/";
+    unsigned workers = 0;
+    bool allowLossyLoad = false;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        try
+        {
+            if (arg == "--help" || arg == "-h")
+            {
+                PrintUsage(argv[0]);
+                return 0;
+            }
+            if (arg == "--verbose") verbose = true;
+            else if (arg == "--allow-lossy-load") allowLossyLoad = true;
+            else if (arg.rfind("--socket=", 0) == 0) socketPath = arg.substr(9);
+            else if (arg.rfind("--data-dir=", 0) == 0) dataDir = arg.substr(11);
+            else if (arg.rfind("--workers=", 0) == 0)
+                workers = static_cast<unsigned>(std::stoul(arg.substr(10)));
+            else throw std::invalid_argument(arg);
+        }
+        catch (const std::exception&)
+        {
+            std::cerr << "[ПОМИЛКА] Некоректний параметр: " << arg << "\n";
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    try
+    {
+        std::optional<ScopedConsoleMute> mute;
+        if (!verbose) mute.emplace();
+
+        const FileManager fileManager(dataDir);
+        auto& auth = AuthManager::GetInstance();
+        if (fileManager.FileExists(ROLES_CONFIG_FILE))
+            auth.LoadCustomRoles(fileManager.LoadFromFile(ROLES_CONFIG_FILE));
+        UserStore(fileManager).Load(auth);
+
+        ClubManager club;
+        const IngestReport report = IngestPipeline().Run(
+            fileManager.GetFullPath(PLAYERS_DATA_FILE), club);
+        std::cout << "[ІНФО] Завантажено гравців: " << club.GetAll().size()
+            << ".\n";
+        if (report.IsLossy())
+        {
+            std::cerr << "[ПОМИЛКА] Склад завантажено не повністю"
+                << (report.ok ? "" : " (файл не дочитано)")
+                << ": пропущено рядків " << report.skipped << ".\n";
+            if (!allowLossyLoad)
+            {
+                std::cerr << "         Збереження перезаписало б "
+                    << PLAYERS_DATA_FILE << " без них. Виправте файл або"
+                    " запустіть з --allow-lossy-load.\n";
+                return 1;
+            }
+            std::cerr << "[ПОПЕРЕДЖЕННЯ] --allow-lossy-load: пропущені"
+                " рядки буде втрачено під час збереження.\n";
+        }
+
+        ClubService service(club, auth, fileManager);
+        const MetricsExporter metrics(fileManager);
+        {
+            LocalServer server(service, socketPath, workers);
+            std::cout << "[ІНФО] Сервер слухає " << socketPath << ".\n";
+            server.Run();
+        }
+
+        const bool saved = service.Save();
+        if constexpr (TRACING_ENABLED)
+            Tracer::GetInstance().WriteChromeTrace(fileManager);
+        if (!saved)
+        {
+            std::cerr << "[ПОМИЛКА] Не вдалося зберегти склад.\n";
+            return 1;
+        }
+        std::cout << "[УСПІХ] Склад збережено. Сервер зупинено.\n";
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[КРИТИЧНА ПОМИЛКА] " << e.what() << "\n";
+        return 1;
+    }
+}